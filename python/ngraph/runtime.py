@@ -15,6 +15,7 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
+import threading
 from typing import List
 
 import numpy as np
@@ -27,6 +28,13 @@ from ngraph.utils.types import get_dtype, NumericData
 
 log = logging.getLogger(__file__)
 
+# Backends whose tensors live in host memory and can therefore be created directly over the
+# buffers of NumPy arrays instead of copying them.
+HOST_MEMORY_BACKENDS = ['CPU', 'INTERPRETER']
+
+# Some CPU kernels assume that their buffers start on a 64 byte boundary.
+BUFFER_ALIGNMENT = 64
+
 
 def runtime(backend_name='CPU'):  # type: (str) -> 'Runtime'
     """Create a Runtime object (helper factory).
@@ -65,30 +73,64 @@ class Computation:
             self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
         self.function = Function(self.node, self.parameters, 'ngraph_computation')
         self.backend = runtime.backend
+        self.zero_copy = runtime.backend_name in HOST_MEMORY_BACKENDS
+
+        self.result_element_type = self.node.get_element_type()
+        self.result_shape = self.node.get_shape()
+        self.result_dtype = get_dtype(self.result_element_type)
+        self.result_view = None
+        # Held by calls that use the tensors above, which other threads' calls share
+        self.lock = threading.Lock()
+        if not self.zero_copy:
+            # Created once and reused by every call
+            self.result_view = self.backend.create_tensor(self.result_element_type,
+                                                          self.result_shape)
 
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.node.name, params_string)
 
     def __call__(self, *input_values):  # type: (*NumericData) -> NumericData
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
-
-        result_element_type = self.node.get_element_type()
-        result_shape = self.node.get_shape()
-        result_dtype = get_dtype(result_element_type)
+        """Run computation on input values and return result.
 
-        result_view = self.runtime.backend.create_tensor(
-            result_element_type, result_shape)
-        result_arr = np.empty(result_shape, dtype=result_dtype)
+        On host memory backends, inputs that are C-contiguous, suitably aligned arrays of the
+        parameter's dtype are used in place and the result is computed directly into the
+        returned array. Other inputs are copied into tensors owned by the computation.
 
-        self.backend.call(self.function, [result_view], self.tensor_views)
-
-        Computation._read_tensor_view_to_ndarray(result_view, result_arr)
-        result_arr = result_arr.reshape(result_shape)
+        A computation may be called from several threads. Calls that use its tensors run one
+        at a time, as do calls of one function in the backend.
+        """
+        input_values = [value if isinstance(value, np.ndarray) else np.array(value)
+                        for value in input_values]
+        in_place = [self.zero_copy and Computation._can_use_in_place(value, tensor_view)
+                    for tensor_view, value in zip(self.tensor_views, input_values)]
+
+        if self.zero_copy and all(in_place):
+            return self._call(input_values, in_place)
+        with self.lock:
+            return self._call(input_values, in_place)
+
+    def _call(self, input_values, in_place):
+        # type: (List[np.ndarray], List[bool]) -> np.ndarray
+        input_views = []
+        for tensor_view, value, value_in_place in zip(self.tensor_views, input_values, in_place):
+            if value_in_place:
+                input_views.append(self.backend.create_tensor(tensor_view.element_type,
+                                                              tensor_view.shape, value))
+            else:
+                Computation._write_ndarray_to_tensor_view(value, tensor_view)
+                input_views.append(tensor_view)
+
+        if self.zero_copy:
+            result_arr = Computation._aligned_empty(self.result_shape, self.result_dtype)
+            result_view = self.backend.create_tensor(self.result_element_type,
+                                                     self.result_shape, result_arr)
+            self.backend.call(self.function, [result_view], input_views)
+            return result_arr
+
+        result_arr = np.empty(self.result_shape, dtype=self.result_dtype)
+        self.backend.call(self.function, [self.result_view], input_views)
+        Computation._read_tensor_view_to_ndarray(self.result_view, result_arr)
         return result_arr
 
     def serialize(self, indent=0):  # type: (int) -> str
@@ -103,6 +145,22 @@ class Computation:
     def _get_buffer_size(element_type, element_count):  # type: (TensorViewType, int) -> int
         return int((element_type.bitwidth / 8.0) * element_count)
 
+    @staticmethod
+    def _can_use_in_place(value, tensor_view):  # type: (np.ndarray, TensorViewType) -> bool
+        return (value.flags['C_CONTIGUOUS'] and
+                value.dtype == get_dtype(tensor_view.element_type) and
+                list(value.shape) == list(tensor_view.shape) and
+                value.ctypes.data % BUFFER_ALIGNMENT == 0)
+
+    @staticmethod
+    def _aligned_empty(shape, dtype):  # type: (List[int], np.dtype) -> np.ndarray
+        """Return an uninitialized C-contiguous array whose data is BUFFER_ALIGNMENT aligned."""
+        shape = list(shape)
+        nbytes = int(np.prod(shape)) * np.dtype(dtype).itemsize
+        raw = np.empty(nbytes + BUFFER_ALIGNMENT, dtype=np.uint8)
+        offset = -raw.ctypes.data % BUFFER_ALIGNMENT
+        return raw[offset:offset + nbytes].view(dtype).reshape(shape)
+
     @staticmethod
     def _write_ndarray_to_tensor_view(value, tensor_view):
         # type: (np.ndarray, TensorViewType) -> None
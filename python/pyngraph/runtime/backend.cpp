@@ -14,15 +14,65 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <map>
+#include <mutex>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 //#include <string>
+#include "ngraph/except.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 #include "pyngraph/runtime/backend.hpp"
 
 namespace py = pybind11;
 
+// The buffer must be a C-contiguous array holding exactly one tensor of the given type and shape
+static void check_tensor_buffer(const py::buffer_info& info,
+                                const ngraph::element::Type& element_type,
+                                const ngraph::Shape& shape)
+{
+    if (static_cast<size_t>(info.itemsize) != element_type.size() ||
+        static_cast<size_t>(info.size) != ngraph::shape_size(shape))
+    {
+        throw ngraph::ngraph_error("Buffer does not match the tensor element type and shape");
+    }
+    py::ssize_t stride = info.itemsize;
+    for (size_t i = info.shape.size(); i-- > 0;)
+    {
+        if (info.shape[i] > 1 && info.strides[i] != stride)
+        {
+            throw ngraph::ngraph_error("Buffer is not C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+}
+
+// Backends may share state such as the call frame between calls of one function, so those
+// calls run one at a time. Returns the mutex that orders them.
+static std::shared_ptr<std::mutex>
+    get_function_mutex(const std::shared_ptr<ngraph::Function>& function)
+{
+    static std::mutex registry_mutex;
+    static std::map<const ngraph::Function*,
+                    std::pair<std::weak_ptr<ngraph::Function>, std::shared_ptr<std::mutex>>>
+        registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto it = registry.find(function.get());
+    if (it != registry.end() && !it->second.first.expired())
+    {
+        return it->second.second;
+    }
+    // Forget the functions that are gone, including any earlier one at this address
+    for (auto entry = registry.begin(); entry != registry.end();)
+    {
+        entry = entry->second.first.expired() ? registry.erase(entry) : std::next(entry);
+    }
+    auto function_mutex = std::make_shared<std::mutex>();
+    registry[function.get()] = {function, function_mutex};
+    return function_mutex;
+}
+
 void regclass_pyngraph_runtime_Backend(py::module m)
 {
     py::class_<ngraph::runtime::Backend, std::shared_ptr<ngraph::runtime::Backend>> backend(
@@ -34,15 +84,35 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::TensorView>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    backend.def("create_tensor",
+                [](ngraph::runtime::Backend& self,
+                   const ngraph::element::Type& element_type,
+                   const ngraph::Shape& shape,
+                   py::buffer buffer) {
+                    py::buffer_info info = buffer.request();
+                    check_tensor_buffer(info, element_type, shape);
+                    return self.create_tensor(element_type, shape, info.ptr);
+                },
+                py::keep_alive<0, 4>()); /* Keep the buffer alive while the tensor is used */
+    // Compilation and execution do not touch Python objects, so other Python threads may run
+    // while they are in progress
     backend.def("compile",
-                (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
-                    ngraph::runtime::Backend::compile);
+                [](ngraph::runtime::Backend& self, std::shared_ptr<ngraph::Function> function) {
+                    auto function_mutex = get_function_mutex(function);
+                    py::gil_scoped_release release;
+                    std::lock_guard<std::mutex> lock(*function_mutex);
+                    self.compile(function);
+                });
     backend.def("call",
-                (void (ngraph::runtime::Backend::*)(
-                    std::shared_ptr<ngraph::Function>,
-                    const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>&,
-                    const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>&)) &
-                    ngraph::runtime::Backend::call);
+                [](ngraph::runtime::Backend& self,
+                   std::shared_ptr<ngraph::Function> function,
+                   const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>& outputs,
+                   const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>& inputs) {
+                    auto function_mutex = get_function_mutex(function);
+                    py::gil_scoped_release release;
+                    std::lock_guard<std::mutex> lock(*function_mutex);
+                    self.call(function, outputs, inputs);
+                });
     backend.def("remove_compiled_function",
                 (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
                     ngraph::runtime::Backend::remove_compiled_function);
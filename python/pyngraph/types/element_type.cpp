@@ -27,6 +27,8 @@ void regclass_pyngraph_Type(py::module m)
     py::class_<ngraph::element::Type, std::shared_ptr<ngraph::element::Type>> type(m, "Type");
     type.doc() = "ngraph.impl.Type wraps ngraph::element::Type";
     type.attr("boolean") = ngraph::element::boolean;
+    type.attr("bf16") = ngraph::element::bf16;
+    type.attr("f16") = ngraph::element::f16;
     type.attr("f32") = ngraph::element::f32;
     type.attr("f64") = ngraph::element::f64;
     type.attr("i8") = ngraph::element::i8;
@@ -16,10 +16,11 @@
 import numpy as np
 import pytest
 import json
+import threading
 
 import ngraph as ng
 from test.ngraph.util import get_runtime, run_op_node
-from ngraph.impl import Function, NodeVector
+from ngraph.impl import Function, NodeVector, Type, util
 
 
 @pytest.mark.parametrize('dtype', [np.float32, np.float64,
@@ -157,3 +158,78 @@ def test_convert_to_uint(val_type):
     expected = np.array(input_data, dtype=val_type)
     result = run_op_node([input_data], ng.convert, val_type)
     assert np.allclose(result, expected)
+
+
+def test_computation_results_are_independent():
+    runtime = get_runtime()
+
+    shape = [2, 3]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    computation = runtime.computation(parameter_a * parameter_a, parameter_a)
+
+    first = computation(np.arange(6, dtype=np.float32).reshape(shape))
+    second = computation(np.ones(shape, dtype=np.float32))
+    assert np.allclose(first, np.array([[0, 1, 4], [9, 16, 25]], dtype=np.float32))
+    assert np.allclose(second, np.ones(shape, dtype=np.float32))
+
+
+def test_computation_on_noncontiguous_and_converted_inputs():
+    runtime = get_runtime()
+
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a - parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32).T
+    value_b = np.array([[1, 1], [1, 1]], dtype=np.float64)
+    result = computation(value_a, value_b)
+    assert np.allclose(result, np.array([[0, 2], [1, 3]], dtype=np.float32))
+
+
+@pytest.config.gpu_skip(reason='GPU tensors cannot be created over host memory')
+def test_tensor_view_over_ndarray_buffer():
+    runtime = get_runtime()
+
+    array = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    tensor_view = runtime.backend.create_tensor(Type.f32, [2, 2], array)
+    array[0, 0] = 5
+
+    result = np.empty([2, 2], dtype=np.float32)
+    tensor_view.read(util.numpy_to_c(result), 0, 16)
+    assert np.allclose(result, np.array([[5, 2], [3, 4]], dtype=np.float32))
+
+    with pytest.raises(Exception):
+        runtime.backend.create_tensor(Type.f32, [2, 2], array.T)
+
+
+def test_computation_called_from_threads():
+    runtime = get_runtime()
+
+    shape = [16, 16]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b + parameter_a,
+                                      parameter_a, parameter_b)
+
+    # Transposed and float64 inputs are copied into the tensors shared by all calls
+    def run(thread_index, failures):
+        for i in range(20):
+            value_a = np.full(shape, thread_index, dtype=np.float32)
+            value_b = np.full(shape, i, dtype=np.float32)
+            if i % 3 == 1:
+                value_a = value_a.T
+            elif i % 3 == 2:
+                value_b = value_b.astype(np.float64)
+            result = computation(value_a, value_b)
+            if not np.allclose(result, np.full(shape, thread_index * (i + 1))):
+                failures.append((thread_index, i))
+
+    failures = []
+    threads = [threading.Thread(target=run, args=(thread_index, failures))
+               for thread_index in range(8)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert failures == []
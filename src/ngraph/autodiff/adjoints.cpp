@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -23,8 +25,10 @@
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/axis_set.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/add_n.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convert.hpp"
@@ -35,21 +39,6 @@
 
 using namespace ngraph;
 
-std::shared_ptr<Node> make_zero(const element::Type& element_type, const Shape& shape)
-{
-    std::shared_ptr<Node> zero = op::Constant::create(element_type, Shape{}, {0.0});
-    if (shape.size() > 0)
-    {
-        AxisSet axes;
-        for (size_t i = 0; i < shape.size(); i++)
-        {
-            axes.insert(i);
-        }
-        zero = std::make_shared<op::Broadcast>(zero, shape, axes);
-    }
-    return zero;
-}
-
 NodeVector make_zeros(std::shared_ptr<Node> x)
 {
     NodeVector zeros;
@@ -61,6 +50,13 @@ NodeVector make_zeros(std::shared_ptr<Node> x)
 }
 
 autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
+    : Adjoints(ys, cs, CheckpointPolicy())
+{
+}
+
+autodiff::Adjoints::Adjoints(const NodeVector& ys,
+                             const NodeVector& cs,
+                             const CheckpointPolicy& policy)
 {
     if (ys.size() != cs.size())
     {
@@ -91,6 +87,7 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
 
     // Nodes that have been processed
     std::unordered_set<std::shared_ptr<Node>> visited_nodes;
+    std::list<std::shared_ptr<Node>> forward_nodes;
 
     // Nodes we should check
     std::list<std::shared_ptr<Node>> nodes_to_check(ys.cbegin(), ys.cend());
@@ -116,6 +113,12 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
             }
         }
         visited_nodes.insert(node);
+        forward_nodes.push_back(node);
+    }
+
+    if (policy.strategy != CheckpointPolicy::Strategy::NONE)
+    {
+        select_checkpoints(ys, forward_nodes, policy);
     }
 
     // Second pass visits the nodes so that all users of a node's value are visited
@@ -128,6 +131,9 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
         m_adjoint_map.insert(std::make_pair(ys.at(i).get(), NodeVector{cs.at(i)}));
     }
 
+    // Nodes of the backprop graph that have been checked for forward values to recompute
+    std::unordered_set<std::shared_ptr<Node>> backprop_nodes(cs.begin(), cs.end());
+
     nodes_to_check.assign(ys.cbegin(), ys.cend());
     while (nodes_to_check.size() > 0)
     {
@@ -143,10 +149,190 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
                 nodes_to_check.push_front(arg);
             }
         }
-        node->generate_adjoints(*this, get(node));
+        NodeVector deltas = get(node);
+        node->generate_adjoints(*this, deltas);
+
+        if (policy.strategy == CheckpointPolicy::Strategy::NONE)
+        {
+            continue;
+        }
+
+        // Point the backprop nodes just generated at recomputed copies of the forward values
+        // they read. The copies are scheduled once this node's deltas are available, and so
+        // are generated nodes that only read forward values (e.g. transposed weights), which
+        // would otherwise be computed during the forward pass and held until the backprop.
+        std::list<std::shared_ptr<Node>> new_nodes;
+        for (auto arg : node->get_arguments())
+        {
+            auto adjoint_it = m_adjoint_map.find(arg.get());
+            if (adjoint_it != m_adjoint_map.end())
+            {
+                auto& arg_deltas = adjoint_it->second;
+                new_nodes.insert(new_nodes.end(), arg_deltas.begin(), arg_deltas.end());
+            }
+        }
+        while (new_nodes.size() > 0)
+        {
+            auto backprop = new_nodes.front();
+            new_nodes.pop_front();
+            if (visited_nodes.count(backprop) != 0 || !backprop_nodes.insert(backprop).second)
+            {
+                continue;
+            }
+            bool reads_backprop = false;
+            for (auto& input : backprop->get_inputs())
+            {
+                auto value = input.get_output().get_node();
+                if (m_recomputable.count(value) != 0)
+                {
+                    size_t output_index = input.get_output().get_index();
+                    input.replace_output(recompute(value, deltas)->get_outputs().at(output_index));
+                    reads_backprop = true;
+                }
+                else
+                {
+                    reads_backprop = reads_backprop || visited_nodes.count(value) == 0;
+                    new_nodes.push_back(value);
+                }
+            }
+            if (!reads_backprop && !backprop->is_constant())
+            {
+                for (auto delta : deltas)
+                {
+                    if (delta != backprop)
+                    {
+                        backprop->add_control_dependency(delta);
+                    }
+                }
+            }
+        }
     }
 }
 
+void autodiff::Adjoints::select_checkpoints(const NodeVector& ys,
+                                            const std::list<std::shared_ptr<Node>>& nodes,
+                                            const CheckpointPolicy& policy)
+{
+    std::unordered_set<std::shared_ptr<Node>> kept(ys.begin(), ys.end());
+    kept.insert(policy.checkpoints.begin(), policy.checkpoints.end());
+
+    // Parameters and constants are live for the whole computation anyway, and ops that
+    // have several outputs or call functions are not worth re-emitting.
+    std::vector<std::shared_ptr<Node>> candidates;
+    for (auto node : topological_sort(nodes))
+    {
+        if (node->is_parameter() || node->is_constant() || node->get_output_size() != 1 ||
+            !node->get_functions().empty())
+        {
+            continue;
+        }
+        if (kept.count(node) != 0)
+        {
+            m_checkpoints.push_back(node);
+            continue;
+        }
+        candidates.push_back(node);
+    }
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    // sqrt(n) segments of about equal size in bytes
+    size_t memory_budget = policy.memory_budget;
+    if (policy.strategy == CheckpointPolicy::Strategy::SQRT_N)
+    {
+        size_t total_bytes = 0;
+        for (auto node : candidates)
+        {
+            total_bytes += shape_size(node->get_shape()) * node->get_element_type().size();
+        }
+        memory_budget = total_bytes / static_cast<size_t>(std::ceil(std::sqrt(candidates.size())));
+    }
+
+    size_t segment_bytes = 0;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        auto node = candidates.at(i);
+        size_t bytes = shape_size(node->get_shape()) * node->get_element_type().size();
+        bool checkpoint = segment_bytes + bytes > memory_budget;
+        segment_bytes = checkpoint ? 0 : segment_bytes + bytes;
+        if (checkpoint)
+        {
+            m_checkpoints.push_back(node);
+        }
+        else
+        {
+            m_recomputable[node] = i;
+        }
+    }
+}
+
+std::shared_ptr<Node> autodiff::Adjoints::recompute(const std::shared_ptr<Node>& x,
+                                                    const NodeVector& triggers)
+{
+    auto recomputed_it = m_recomputed.find(x);
+    if (recomputed_it != m_recomputed.end())
+    {
+        return recomputed_it->second;
+    }
+
+    // The part of x's forward segment that has not been re-emitted yet
+    std::vector<std::shared_ptr<Node>> segment;
+    std::unordered_set<std::shared_ptr<Node>> segment_nodes{x};
+    std::list<std::shared_ptr<Node>> nodes_to_check{x};
+    while (nodes_to_check.size() > 0)
+    {
+        auto node = nodes_to_check.front();
+        nodes_to_check.pop_front();
+        segment.push_back(node);
+        for (auto arg : node->get_arguments())
+        {
+            if (m_recomputable.count(arg) != 0 && m_recomputed.count(arg) == 0 &&
+                segment_nodes.insert(arg).second)
+            {
+                nodes_to_check.push_back(arg);
+            }
+        }
+    }
+    std::sort(segment.begin(),
+              segment.end(),
+              [this](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
+                  return m_recomputable.at(a) < m_recomputable.at(b);
+              });
+
+    for (auto node : segment)
+    {
+        NodeVector args;
+        bool waits_on_segment = false;
+        for (auto arg : node->get_arguments())
+        {
+            auto arg_it = m_recomputed.find(arg);
+            if (arg_it == m_recomputed.end())
+            {
+                args.push_back(arg);
+            }
+            else
+            {
+                args.push_back(arg_it->second);
+                waits_on_segment = waits_on_segment || segment_nodes.count(arg) != 0;
+            }
+        }
+        auto copy = node->copy_with_new_args(args);
+        // Without this the copy would be scheduled as soon as its checkpoints are, and
+        // would stay live as long as the original value would have.
+        if (!waits_on_segment)
+        {
+            for (auto trigger : triggers)
+            {
+                copy->add_control_dependency(trigger);
+            }
+        }
+        m_recomputed[node] = copy;
+    }
+    return m_recomputed.at(x);
+}
+
 const NodeVector& autodiff::Adjoints::get(const std::shared_ptr<Node>& x)
 {
     auto adjoint_it = m_adjoint_map.find(x.get());
@@ -175,9 +361,17 @@ void autodiff::Adjoints::add_delta(const std::shared_ptr<Node>& x,
     }
     else
     {
+        // Accumulate all contributions with one AddN rather than a chain of Adds, widening
+        // the AddN built so far while nothing else reads it
         auto& deltas = adjoint_it->second;
-        deltas.at(output_index) = std::make_shared<op::Add>(deltas.at(output_index), delta);
-        adjoint_it->second = deltas;
+        NodeVector contributions{deltas.at(output_index)};
+        auto sum = std::dynamic_pointer_cast<op::AddN>(deltas.at(output_index));
+        if (sum && sum->get_users().empty())
+        {
+            contributions = sum->get_arguments();
+        }
+        contributions.push_back(delta);
+        deltas.at(output_index) = std::make_shared<op::AddN>(contributions);
     }
 }
 
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <list>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -37,6 +38,38 @@ namespace ngraph
 
     namespace autodiff
     {
+        /// @brief Activation recomputation (gradient checkpointing) settings for Adjoints.
+        ///
+        /// Forward values that are not checkpoints are not read by the backprop graph.
+        /// Instead the forward segment that produces them is re-emitted, starting from the
+        /// nearest checkpoints, when the backprop reaches it. This trades extra compute for
+        /// a smaller peak of live activations.
+        struct CheckpointPolicy
+        {
+            enum class Strategy
+            {
+                /// Keep every forward value for the backprop
+                NONE,
+                /// Split the n forward values into ceil(sqrt(n)) segments of about the same
+                /// size in bytes
+                SQRT_N,
+                /// Start a new segment when the recomputed values of the current one would
+                /// exceed memory_budget bytes
+                MEMORY_BUDGET
+            };
+
+            CheckpointPolicy(Strategy strategy = Strategy::NONE, size_t memory_budget = 0)
+                : strategy(strategy)
+                , memory_budget(memory_budget)
+            {
+            }
+
+            Strategy strategy;
+            size_t memory_budget;
+            /// Nodes that are always checkpoints, in addition to the selected ones
+            NodeVector checkpoints;
+        };
+
         class Adjoints
         {
         public:
@@ -46,6 +79,14 @@ namespace ngraph
             /// @param c An expression for where to evaluate the derivatives
             Adjoints(const NodeVector& y, const NodeVector& c);
 
+            /// @brief (dy/dx)(c) for all x used to compute y, recomputing forward values
+            /// that are not checkpoints
+            ///
+            /// @param y The dependent value
+            /// @param c An expression for where to evaluate the derivatives
+            /// @param policy How checkpoints are selected
+            Adjoints(const NodeVector& y, const NodeVector& c, const CheckpointPolicy& policy);
+
             Adjoints(const Adjoints& adjoints) = default;
             Adjoints& operator=(const Adjoints& adjoints) = default;
             Adjoints() = default;
@@ -78,8 +119,24 @@ namespace ngraph
 
             std::shared_ptr<Node> backprop_node(const std::shared_ptr<Node>& x);
 
+            /// @brief The forward nodes the backprop reads directly when checkpointing
+            const NodeVector& get_checkpoints() const { return m_checkpoints; }
+            /// @brief Number of forward nodes re-emitted in the backprop graph
+            size_t get_recomputed_node_count() const { return m_recomputed.size(); }
         protected:
+            void select_checkpoints(const NodeVector& ys,
+                                    const std::list<std::shared_ptr<Node>>& nodes,
+                                    const CheckpointPolicy& policy);
+
+            std::shared_ptr<Node> recompute(const std::shared_ptr<Node>& x,
+                                            const NodeVector& triggers);
+
             std::map<Node*, NodeVector> m_adjoint_map;
+            NodeVector m_checkpoints;
+            // Forward nodes whose values are recomputed, and their recomputed copies
+            std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_recomputed;
+            // Position of each recomputable forward node in the forward order
+            std::unordered_map<std::shared_ptr<Node>, size_t> m_recomputable;
         };
     }
 }
@@ -75,6 +75,13 @@ void ngraph::traverse_nodes(const Function* p, std::function<void(std::shared_pt
                 stack.push_front(arg);
             }
         }
+        for (auto dependency : n->get_control_dependencies())
+        {
+            if (instances_seen.count(dependency) == 0)
+            {
+                stack.push_front(dependency);
+            }
+        }
     }
 }
 
@@ -128,6 +135,25 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
             input->replace_output(replacement->get_outputs().at(i));
         }
     }
+
+    // Carry scheduling constraints over to the replacement
+    for (auto dependency : target->get_control_dependencies())
+    {
+        if (dependency != replacement)
+        {
+            replacement->add_control_dependency(dependency);
+        }
+    }
+    std::set<Node*> dependents{begin(target->get_control_dependents()),
+                               end(target->get_control_dependents())};
+    for (auto dependent : dependents)
+    {
+        dependent->remove_control_dependency(target);
+        if (dependent != replacement.get())
+        {
+            dependent->add_control_dependency(replacement);
+        }
+    }
 }
 
 std::list<std::shared_ptr<ngraph::Node>>
@@ -140,8 +166,21 @@ std::list<std::shared_ptr<ngraph::Node>>
     for (auto node : nodes)
     {
         node_map[node.get()] = node;
-        node_dependency_count[node.get()] = node->get_arguments().size();
-        if (node->get_arguments().size() == 0)
+    }
+
+    for (auto node : nodes)
+    {
+        size_t count = node->get_arguments().size();
+        // Control dependencies outside of nodes cannot be waited on
+        for (auto dependency : node->get_control_dependencies())
+        {
+            if (node_map.count(dependency.get()) != 0)
+            {
+                count++;
+            }
+        }
+        node_dependency_count[node.get()] = count;
+        if (count == 0)
         {
             independent_nodes.push_back(node.get());
         }
@@ -164,6 +203,14 @@ std::list<std::shared_ptr<ngraph::Node>>
                 independent_nodes.push_back(user);
             }
         }
+
+        for (auto dependent : independent_node->get_control_dependents())
+        {
+            if (node_map.count(dependent) != 0 && --node_dependency_count[dependent] == 0)
+            {
+                independent_nodes.push_back(dependent);
+            }
+        }
     }
 
     return result_list;
@@ -216,6 +263,18 @@ std::list<std::shared_ptr<ngraph::Node>>
         }
     }
 
+    // control dependencies among the cloned nodes are cloned as well
+    for (auto node : sorted_nodes)
+    {
+        for (auto dependency : node->get_control_dependencies())
+        {
+            if (node_map.exists(dependency))
+            {
+                node_map.get(node)->add_control_dependency(node_map.get(dependency));
+            }
+        }
+    }
+
     // create and return list of cloned nodes
     // order matches input list (not necessarily topological)
     std::list<std::shared_ptr<ngraph::Node>> cloned_nodes;
@@ -152,6 +152,10 @@ std::shared_ptr<Node> Node::get_argument(size_t index)
 
 Node::~Node()
 {
+    for (auto& node : m_control_dependencies)
+    {
+        node->m_control_dependents.erase(this);
+    }
     for (auto& input : m_inputs)
     {
         input.get_output().remove_input(&input);
@@ -329,3 +333,19 @@ NodeVector Node::get_users() const
 
     return result;
 }
+
+void Node::add_control_dependency(std::shared_ptr<Node> node)
+{
+    if (node.get() == this)
+    {
+        throw ngraph_error("A node cannot be a control dependency of itself");
+    }
+    m_control_dependencies.insert(node);
+    node->m_control_dependents.insert(this);
+}
+
+void Node::remove_control_dependency(std::shared_ptr<Node> node)
+{
+    m_control_dependencies.erase(node);
+    node->m_control_dependents.erase(this);
+}
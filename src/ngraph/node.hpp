@@ -191,6 +191,20 @@ namespace ngraph
         /// Get all the nodes that uses the current node
         NodeVector get_users() const;
 
+        /// Nodes that must be scheduled before this node even though none of their outputs
+        /// are arguments of this node.
+        const std::set<std::shared_ptr<Node>>& get_control_dependencies() const
+        {
+            return m_control_dependencies;
+        }
+
+        /// Nodes that have this node as a control dependency
+        const std::set<Node*>& get_control_dependents() const { return m_control_dependents; }
+        /// Order this node after node without adding a data edge
+        void add_control_dependency(std::shared_ptr<Node> node);
+
+        void remove_control_dependency(std::shared_ptr<Node> node);
+
         virtual std::shared_ptr<Node> get_default_value() const { return nullptr; }
     protected:
         void add_output(const element::Type& element_type, const Shape& shape);
@@ -204,5 +218,7 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
+        std::set<std::shared_ptr<Node>> m_control_dependencies;
+        std::set<Node*> m_control_dependents;
     };
 }
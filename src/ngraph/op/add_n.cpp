@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/add_n.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::AddN::AddN(const NodeVector& args)
+    : RequiresTensorViewArgs("AddN", args)
+{
+    if (m_inputs.size() < 1)
+    {
+        throw ngraph_error("At least one argument required");
+    }
+
+    auto& input_0 = get_inputs().at(0);
+    for (auto& input : get_inputs())
+    {
+        if (input.get_element_type() != input_0.get_element_type())
+        {
+            throw ngraph_error("Arguments must have the same tensor view element type");
+        }
+        if (input.get_shape() != input_0.get_shape())
+        {
+            throw ngraph_error("Arguments must have the same tensor view shape");
+        }
+    }
+
+    set_value_type_checked(input_0.get_element_type(), input_0.get_shape());
+}
+
+shared_ptr<Node> op::AddN::copy_with_new_args(const NodeVector& new_args) const
+{
+    return make_shared<AddN>(new_args);
+}
+
+void op::AddN::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+
+    for (auto arg : get_arguments())
+    {
+        adjoints.add_delta(arg, delta);
+    }
+}
@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise sum of any number of tensors.
+        ///
+        /// Computes the same value as a chain of Add operations, in a single pass over the
+        /// output. Autodiff uses it to accumulate the contributions to an adjoint.
+        class AddN : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs an n-ary addition operation.
+            ///
+            /// \param args Nodes that produce the input tensors, at least one; all must have
+            ///             the same element type and shape.<br>
+            /// `[d0, ...]`
+            ///
+            /// Output `[d0, ...]`
+            ///
+            AddN(const NodeVector& args);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+            virtual bool is_commutative() override { return true; }
+        };
+    }
+}
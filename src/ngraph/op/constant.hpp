@@ -21,7 +21,9 @@
 
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -193,6 +195,14 @@ namespace ngraph
                 {
                     write_buffer<char, T>(target, source, target_element_count);
                 }
+                else if (target_type == element::bf16)
+                {
+                    write_buffer<bfloat16, T>(target, source, target_element_count);
+                }
+                else if (target_type == element::f16)
+                {
+                    write_buffer<float16, T>(target, source, target_element_count);
+                }
                 else if (target_type == element::f32)
                 {
                     write_buffer<float, T>(target, source, target_element_count);
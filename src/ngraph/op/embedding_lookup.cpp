@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/embedding_lookup.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// indices_shape followed by all but the first axis of table_shape
+static Shape lookup_shape(const Shape& indices_shape, const Shape& table_shape)
+{
+    Shape result_shape = indices_shape;
+    result_shape.insert(result_shape.end(), table_shape.begin() + 1, table_shape.end());
+    return result_shape;
+}
+
+op::EmbeddingLookup::EmbeddingLookup(const shared_ptr<Node>& indices,
+                                     const shared_ptr<Node>& table)
+    : RequiresTensorViewArgs("EmbeddingLookup", {indices, table})
+{
+    if (indices->get_element_type() == element::boolean)
+    {
+        throw ngraph_error("Embedding lookup indices must not be boolean");
+    }
+    if (table->get_shape().size() == 0)
+    {
+        throw ngraph_error("Embedding lookup table must have at least one axis");
+    }
+
+    set_value_type_checked(table->get_element_type(),
+                           lookup_shape(indices->get_shape(), table->get_shape()));
+}
+
+shared_ptr<Node> op::EmbeddingLookup::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<EmbeddingLookup>(new_args.at(0), new_args.at(1));
+}
+
+void op::EmbeddingLookup::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+
+    auto indices = get_argument(0);
+    auto table = get_argument(1);
+
+    // Indices are not differentiable
+    adjoints.add_delta(table,
+                       make_shared<EmbeddingLookupBackprop>(indices, delta, table->get_shape()));
+}
+
+op::EmbeddingLookupBackprop::EmbeddingLookupBackprop(const shared_ptr<Node>& indices,
+                                                     const shared_ptr<Node>& delta,
+                                                     const Shape& table_shape)
+    : RequiresTensorViewArgs("EmbeddingLookupBackprop", {indices, delta})
+    , m_table_shape(table_shape)
+{
+    if (indices->get_element_type() == element::boolean)
+    {
+        throw ngraph_error("Embedding lookup indices must not be boolean");
+    }
+    if (table_shape.size() == 0)
+    {
+        throw ngraph_error("Embedding lookup table must have at least one axis");
+    }
+    if (delta->get_shape() != lookup_shape(indices->get_shape(), table_shape))
+    {
+        throw ngraph_error("Embedding lookup delta shape does not match indices and table shapes");
+    }
+
+    set_value_type_checked(delta->get_element_type(), table_shape);
+}
+
+shared_ptr<Node> op::EmbeddingLookupBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<EmbeddingLookupBackprop>(new_args.at(0), new_args.at(1), m_table_shape);
+}
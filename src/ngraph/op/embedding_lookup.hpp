@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Embedding lookup (gather of rows along axis 0).
+        ///
+        /// Computes the same value as `Dot(OneHot(indices, indices_shape + {n}, rank), table)`
+        /// without materializing the one-hot tensor.
+        ///
+        /// ## Inputs
+        ///
+        /// |           | Type                                  | Description                                                        |
+        /// | --------- | ------------------------------------- | ------------------------------------------------------------------ |
+        /// | `indices` | \f$E'[i_1,\dots,i_m]~(m \geq 0)\f$    | Row indices into `table`, of any non-boolean element type.         |
+        /// | `table`   | \f$E[n,d_1,\dots,d_k]~(k \geq 0)\f$   | The table to look up.                                              |
+        ///
+        /// ## Output
+        ///
+        /// | Type                                    | Description                                                                                                                                                                             |
+        /// | --------------------------------------- | --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------- |
+        /// | \f$E[i_1,\dots,i_m,d_1,\dots,d_k]\f$    | The tensor \f$T\f$, where \f$T[j_1,\dots,j_m,\dots] = \texttt{table}[\texttt{indices}[j_1,\dots,j_m],\dots]\f$. Execution fails if any index is non-integral or out of range.               |
+        class EmbeddingLookup : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs an embedding lookup operation.
+            ///
+            /// \param indices Node that produces the row indices.
+            /// \param table Node that produces the table whose rows are looked up.
+            EmbeddingLookup(const std::shared_ptr<Node>& indices,
+                            const std::shared_ptr<Node>& table);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+        };
+
+        /// \brief Gradient of EmbeddingLookup with respect to the table.
+        ///
+        /// Scatters each row of `delta` into the row of a zero tensor of the table's shape
+        /// selected by the corresponding index, adding rows that share an index. Apart from
+        /// zeroing the output, the work is proportional to the size of `delta` rather than to
+        /// the size of the one-hot product `Dot` would compute.
+        class EmbeddingLookupBackprop : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs an embedding lookup gradient operation.
+            ///
+            /// \param indices Node that produces the row indices of the forward lookup.
+            /// \param delta Node that produces the gradient of the forward lookup's output.
+            /// \param table_shape The shape of the looked up table.
+            EmbeddingLookupBackprop(const std::shared_ptr<Node>& indices,
+                                    const std::shared_ptr<Node>& delta,
+                                    const Shape& table_shape);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const Shape& get_table_shape() const { return m_table_shape; }
+        protected:
+            Shape m_table_shape;
+        };
+    }
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/softmax_cross_entropy.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks that logits and labels agree and that axes are the innermost axes of the logits, and
+// returns the axes with empty meaning all axes
+static AxisSet check_softmax_cross_entropy_args(const shared_ptr<Node>& logits,
+                                                const shared_ptr<Node>& labels,
+                                                const AxisSet& axes)
+{
+    const Shape& shape = logits->get_shape();
+    if (shape.size() == 0)
+    {
+        throw ngraph_error("Softmax cross entropy logits must have at least one axis");
+    }
+    if (labels->get_element_type() != logits->get_element_type() ||
+        labels->get_shape() != shape)
+    {
+        throw ngraph_error("Softmax cross entropy labels must match the logits");
+    }
+
+    AxisSet class_axes = axes;
+    if (class_axes.size() == 0)
+    {
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            class_axes.insert(i);
+        }
+    }
+    for (size_t i = shape.size() - class_axes.size(); i < shape.size(); i++)
+    {
+        if (class_axes.count(i) == 0)
+        {
+            throw ngraph_error("Softmax cross entropy axes must be the innermost axes");
+        }
+    }
+    return class_axes;
+}
+
+op::SoftmaxCrossEntropy::SoftmaxCrossEntropy(const shared_ptr<Node>& logits,
+                                             const shared_ptr<Node>& labels,
+                                             const AxisSet& axes)
+    : RequiresTensorViewArgs("SoftmaxCrossEntropy", {logits, labels})
+    , m_axes(check_softmax_cross_entropy_args(logits, labels, axes))
+{
+    set_value_type_checked(logits->get_element_type(), project(logits->get_shape(), m_axes));
+}
+
+shared_ptr<Node> op::SoftmaxCrossEntropy::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<SoftmaxCrossEntropy>(new_args.at(0), new_args.at(1), m_axes);
+}
+
+void op::SoftmaxCrossEntropy::generate_adjoints(autodiff::Adjoints& adjoints,
+                                                const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+
+    auto logits = get_argument(0);
+    auto labels = get_argument(1);
+
+    adjoints.add_delta(logits,
+                       make_shared<SoftmaxCrossEntropyBackprop>(logits, labels, delta, m_axes));
+
+    // Labels are usually constants; their adjoint is only built into the graph if requested
+    auto log_softmax = make_shared<op::Log>(make_shared<op::Softmax>(logits, m_axes));
+    auto delta_broadcast = make_shared<op::Broadcast>(delta, logits->get_shape(), m_axes);
+    adjoints.add_delta(labels,
+                       make_shared<op::Negative>(
+                           make_shared<op::Multiply>(delta_broadcast, log_softmax)));
+}
+
+op::SoftmaxCrossEntropyBackprop::SoftmaxCrossEntropyBackprop(const shared_ptr<Node>& logits,
+                                                             const shared_ptr<Node>& labels,
+                                                             const shared_ptr<Node>& delta,
+                                                             const AxisSet& axes)
+    : RequiresTensorViewArgs("SoftmaxCrossEntropyBackprop", {logits, labels, delta})
+    , m_axes(check_softmax_cross_entropy_args(logits, labels, axes))
+{
+    if (delta->get_element_type() != logits->get_element_type() ||
+        delta->get_shape() != project(logits->get_shape(), m_axes))
+    {
+        throw ngraph_error("Softmax cross entropy delta does not match the loss");
+    }
+
+    set_value_type_checked(logits->get_element_type(), logits->get_shape());
+}
+
+shared_ptr<Node>
+    op::SoftmaxCrossEntropyBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<SoftmaxCrossEntropyBackprop>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_axes);
+}
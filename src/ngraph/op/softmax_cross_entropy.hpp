@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Softmax cross entropy loss.
+        ///
+        /// Computes the same value as
+        /// `Negative(Sum(Multiply(labels, Log(Softmax(logits, axes))), axes))` in a single pass
+        /// over each group of logits, without forming the softmax and with the maximum
+        /// subtracted so that large logits do not overflow.
+        ///
+        /// ## Inputs
+        ///
+        /// |          | Type                              | Description                          |
+        /// | -------- | --------------------------------- | ------------------------------------ |
+        /// | `logits` | \f$E[d_1,\dots,d_n]~(n \geq 1)\f$ | The unnormalized log probabilities.  |
+        /// | `labels` | \f$E[d_1,\dots,d_n]\f$            | The target distribution.             |
+        ///
+        /// ## Attributes
+        ///
+        /// |        | Description                                                           |
+        /// | ------ | --------------------------------------------------------------------- |
+        /// | `axes` | The class axes, the innermost axes of the logits. Empty means all.    |
+        ///
+        /// ## Output
+        ///
+        /// | Type                                      | Description                           |
+        /// | ----------------------------------------- | ------------------------------------- |
+        /// | \f$E[\mathit{delete}(A,d_1,\dots,d_n)]\f$ | The loss of each group; `A` is `axes`. |
+        class SoftmaxCrossEntropy : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a softmax cross entropy operation.
+            ///
+            /// \param logits Node that produces the logits.
+            /// \param labels Node that produces the labels, of the same shape as the logits.
+            /// \param axes The innermost axes the softmax is taken over.
+            SoftmaxCrossEntropy(const std::shared_ptr<Node>& logits,
+                                const std::shared_ptr<Node>& labels,
+                                const AxisSet& axes);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const AxisSet& get_axes() const { return m_axes; }
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+            AxisSet m_axes;
+        };
+
+        /// \brief Gradient of SoftmaxCrossEntropy with respect to the logits.
+        ///
+        /// Computes `delta * (softmax(logits) * sum(labels) - labels)`, with `delta` and
+        /// `sum(labels)` broadcast along the class axes. For labels that sum to one this is
+        /// `delta * (softmax(logits) - labels)`.
+        class SoftmaxCrossEntropyBackprop : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a softmax cross entropy gradient operation.
+            ///
+            /// \param logits Node that produces the logits of the forward operation.
+            /// \param labels Node that produces the labels of the forward operation.
+            /// \param delta Node that produces the gradient of the forward operation's output.
+            /// \param axes The class axes of the forward operation.
+            SoftmaxCrossEntropyBackprop(const std::shared_ptr<Node>& logits,
+                                        const std::shared_ptr<Node>& labels,
+                                        const std::shared_ptr<Node>& delta,
+                                        const AxisSet& axes);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const AxisSet& get_axes() const { return m_axes; }
+        protected:
+            AxisSet m_axes;
+        };
+    }
+}
@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <list>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static AxisVector default_order(size_t rank)
+{
+    AxisVector order(rank);
+    iota(begin(order), end(order), 0);
+    return order;
+}
+
+// Replaces the AllReduces of bucket by one over their concatenated arguments.
+static void fuse(const NodeVector& bucket)
+{
+    NodeVector flat_args;
+    for (shared_ptr<Node> all_reduce : bucket)
+    {
+        auto arg = all_reduce->get_argument(0);
+        const Shape& shape = arg->get_shape();
+        flat_args.push_back(
+            make_shared<op::Reshape>(arg, default_order(shape.size()), Shape{shape_size(shape)}));
+    }
+    auto fused = make_shared<op::AllReduce>(make_shared<op::Concat>(flat_args, 0));
+
+    size_t offset = 0;
+    for (shared_ptr<Node> all_reduce : bucket)
+    {
+        size_t size = shape_size(all_reduce->get_shape());
+        auto slice =
+            make_shared<op::Slice>(fused, Coordinate{offset}, Coordinate{offset + size});
+        auto reshape =
+            make_shared<op::Reshape>(slice, AxisVector{0}, all_reduce->get_shape());
+        NGRAPH_DEBUG << " Fusing " << all_reduce->get_name() << " into " << fused->get_name();
+        replace_node(all_reduce, reshape);
+        offset += size;
+    }
+}
+
+pass::AllReduceBucketing::AllReduceBucketing(size_t bucket_bytes)
+    : FunctionPass()
+    , m_bucket_bytes(bucket_bytes)
+{
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> f)
+{
+    list<shared_ptr<Node>> ordered_ops = f->get_ordered_ops();
+    unordered_map<const Node*, size_t> position;
+    for (shared_ptr<Node> n : ordered_ops)
+    {
+        size_t index = position.size();
+        position[n.get()] = index;
+    }
+
+    vector<NodeVector> buckets;
+    // The bucket still being filled for each element type, and its size in bytes
+    map<element::Type, pair<NodeVector, size_t>> open_buckets;
+    // The element type of the open bucket holding each AllReduce not yet in a closed bucket
+    unordered_map<const Node*, element::Type> open_members;
+    auto close_bucket = [&](const element::Type& type) {
+        for (shared_ptr<Node> member : open_buckets.at(type).first)
+        {
+            open_members.erase(member.get());
+        }
+        buckets.push_back(open_buckets.at(type).first);
+        open_buckets.erase(type);
+    };
+
+    for (shared_ptr<Node> n : ordered_ops)
+    {
+        if (!dynamic_pointer_cast<op::AllReduce>(n))
+        {
+            continue;
+        }
+
+        // An AllReduce that depends on one in an open bucket would make the fused AllReduce
+        // depend on itself, so that bucket is closed first. A bucket then only depends on
+        // buckets closed before it, and the buckets stay acyclic.
+        if (!open_members.empty())
+        {
+            size_t first_member = position.size();
+            for (auto& member : open_members)
+            {
+                first_member = min(first_member, position.at(member.first));
+            }
+            set<element::Type> reached;
+            unordered_set<const Node*> visited;
+            vector<shared_ptr<Node>> stack{n->get_argument(0)};
+            while (!stack.empty())
+            {
+                shared_ptr<Node> node = stack.back();
+                stack.pop_back();
+                // Nothing before the first open member in execution order can depend on it
+                if (!visited.insert(node.get()).second ||
+                    position.at(node.get()) < first_member)
+                {
+                    continue;
+                }
+                auto member = open_members.find(node.get());
+                if (member != open_members.end())
+                {
+                    reached.insert(member->second);
+                }
+                for (shared_ptr<Node> arg : node->get_arguments())
+                {
+                    stack.push_back(arg);
+                }
+            }
+            for (const element::Type& type : reached)
+            {
+                close_bucket(type);
+            }
+        }
+
+        const element::Type& type = n->get_element_type();
+        auto& open_bucket = open_buckets[type];
+        open_bucket.first.push_back(n);
+        open_bucket.second += shape_size(n->get_shape()) * type.size();
+        open_members.insert({n.get(), type});
+        if (open_bucket.second >= m_bucket_bytes)
+        {
+            close_bucket(type);
+        }
+    }
+    for (auto& open_bucket : open_buckets)
+    {
+        buckets.push_back(open_bucket.second.first);
+    }
+
+    bool replaced = false;
+    for (const NodeVector& bucket : buckets)
+    {
+        if (bucket.size() > 1)
+        {
+            fuse(bucket);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceBucketing;
+    }
+}
+
+/// \brief Fuses the AllReduces of a function into buckets of about bucket_bytes each.
+///
+/// AllReduces are taken in execution order and bucketed by element type. The AllReduces of a
+/// bucket are replaced by one AllReduce of their flattened, concatenated arguments, which is
+/// sliced apart again, so many small gradients pay the latency of a single collective. A
+/// bucket is ready as soon as its last gradient is; backends that run collectives in the
+/// background, such as INTERPRETER, start it then and overlap it with the ops that follow.
+class ngraph::pass::AllReduceBucketing : public FunctionPass
+{
+public:
+    AllReduceBucketing(size_t bucket_bytes = 25 * 1024 * 1024);
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+private:
+    size_t m_bucket_bytes;
+};
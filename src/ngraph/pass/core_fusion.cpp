@@ -23,9 +23,19 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
 #include "ngraph/op/maximum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -73,3 +83,122 @@ void pass::CoreFusion::construct_relu()
     auto m = make_shared<pattern::Matcher>(max, callback);
     this->add_matcher(m);
 }
+
+// Returns the logits of a softmax over axes, either a Softmax op or one written out as
+// Divide(Exp(x), Broadcast(Sum(Exp(x), axes), axes)), optionally with
+// Subtract(x, Broadcast(Max(x, axes), axes)) in place of x. Returns nullptr otherwise.
+static shared_ptr<Node> get_softmax_logits(const shared_ptr<Node>& node, AxisSet& axes)
+{
+    if (auto softmax = dynamic_pointer_cast<op::Softmax>(node))
+    {
+        axes = softmax->get_axes();
+        return softmax->get_argument(0);
+    }
+
+    auto divide = dynamic_pointer_cast<op::Divide>(node);
+    if (!divide)
+    {
+        return nullptr;
+    }
+    auto exp = dynamic_pointer_cast<op::Exp>(divide->get_argument(0));
+    auto broadcast = dynamic_pointer_cast<op::Broadcast>(divide->get_argument(1));
+    if (!exp || !broadcast)
+    {
+        return nullptr;
+    }
+    auto sum = dynamic_pointer_cast<op::Sum>(broadcast->get_argument(0));
+    if (!sum || sum->get_argument(0) != exp ||
+        sum->get_reduction_axes() != broadcast->get_broadcast_axes())
+    {
+        return nullptr;
+    }
+    axes = sum->get_reduction_axes();
+
+    // Subtracting the maximum does not change the softmax
+    auto logits = exp->get_argument(0);
+    if (auto subtract = dynamic_pointer_cast<op::Subtract>(logits))
+    {
+        auto max_broadcast = dynamic_pointer_cast<op::Broadcast>(subtract->get_argument(1));
+        auto max = max_broadcast
+                       ? dynamic_pointer_cast<op::Max>(max_broadcast->get_argument(0))
+                       : nullptr;
+        if (max && max->get_argument(0) == subtract->get_argument(0) &&
+            max->get_reduction_axes() == axes && max_broadcast->get_broadcast_axes() == axes)
+        {
+            logits = subtract->get_argument(0);
+        }
+    }
+    return logits;
+}
+
+void pass::CoreFusion::construct_softmax_cross_entropy()
+{
+    // The loss is matched with the negation either outside or inside the Sum, as
+    // Negative(Sum(Multiply(labels, Log(softmax)))) or Sum(Negative(Multiply(...))), where
+    // softmax is any form accepted by get_softmax_logits
+    Shape shape{2, 3};
+    auto labels = make_shared<pattern::op::Label>(element::f32, shape);
+    auto softmax_label =
+        make_shared<pattern::op::Label>(element::f32, shape, [](shared_ptr<Node> n) {
+            AxisSet axes;
+            return get_softmax_logits(n, axes) != nullptr;
+        });
+    auto product = make_shared<op::Multiply>(labels, make_shared<op::Log>(softmax_label));
+
+    auto sum = make_shared<op::Sum>(product, AxisSet{1});
+    auto sum_label = make_shared<pattern::op::Label>(sum, nullptr, NodeVector{sum});
+    auto negative_sum = make_shared<op::Negative>(sum_label);
+    auto sum_negative = make_shared<op::Sum>(make_shared<op::Negative>(product), AxisSet{1});
+
+    pattern::graph_rewrite_callback callback = [labels, softmax_label, sum_label](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_softmax_cross_entropy against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        AxisSet softmax_axes;
+        auto mlogits = get_softmax_logits(pattern_map[softmax_label], softmax_axes);
+        auto mlabels = pattern_map[labels];
+        if (mlabels->get_shape() != mlogits->get_shape() ||
+            mlabels->get_element_type() != mlogits->get_element_type())
+        {
+            NGRAPH_DEBUG << "Labels " << mlabels->get_name() << " don't match the logits";
+            return false;
+        }
+
+        // The fused op takes the softmax over the innermost axes, and the loss may also be
+        // summed over outer axes, e.g. over the batch
+        auto msum = pattern_map.count(sum_label) != 0 ? pattern_map[sum_label]
+                                                      : m.get_match_root();
+        const Shape& shape = mlogits->get_shape();
+        const AxisSet& sum_axes = static_pointer_cast<op::Sum>(msum)->get_reduction_axes();
+        size_t first_class_axis = shape.size() - softmax_axes.size();
+        AxisSet outer_axes;
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            bool class_axis = softmax_axes.count(axis) != 0;
+            if (class_axis != (axis >= first_class_axis) ||
+                (class_axis && sum_axes.count(axis) == 0))
+            {
+                NGRAPH_DEBUG << "Softmax axes aren't the innermost summed axes";
+                return false;
+            }
+            if (!class_axis && sum_axes.count(axis) != 0)
+            {
+                outer_axes.insert(axis);
+            }
+        }
+
+        shared_ptr<Node> cross_entropy =
+            make_shared<op::SoftmaxCrossEntropy>(mlogits, mlabels, softmax_axes);
+        if (outer_axes.size() != 0)
+        {
+            cross_entropy = make_shared<op::Sum>(cross_entropy, outer_axes);
+        }
+        ngraph::replace_node(m.get_match_root(), cross_entropy);
+        return true;
+    };
+
+    this->add_matcher(make_shared<pattern::Matcher>(negative_sum, callback));
+    this->add_matcher(make_shared<pattern::Matcher>(sum_negative, callback));
+}
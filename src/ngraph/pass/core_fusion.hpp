@@ -33,6 +33,8 @@ public:
         : GraphRewrite()
     {
         construct_relu();
+        construct_softmax_cross_entropy();
     }
     void construct_relu();
+    void construct_softmax_cross_entropy();
 };
@@ -0,0 +1,260 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <unordered_map>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/pass/cost_model_placement.hpp"
+#include "ngraph/runtime/op_cost.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::CostModelPlacement::CostModelPlacement(const vector<DeviceModel>& devices,
+                                             const TransferModel& transfer)
+    : m_devices(devices)
+    , m_transfer(transfer)
+    , m_estimated_time_us(0)
+{
+    if (m_devices.empty())
+    {
+        throw ngraph_error("CostModelPlacement needs at least one device");
+    }
+}
+
+vector<pass::DeviceModel> pass::CostModelPlacement::get_host_devices()
+{
+    return {{Placement::CPU, 100, 20, 1, nullptr}, {Placement::INTERPRETER, 0.5, 2, 5, nullptr}};
+}
+
+namespace
+{
+    // A multi-output op and its GetOutputElements, which must share a device.
+    struct Group
+    {
+        vector<shared_ptr<Node>> nodes;
+        vector<double> time;
+        size_t device = 0;
+        double output_bytes = 0;
+        vector<size_t> producers;
+        vector<size_t> consumers;
+    };
+}
+
+bool pass::CostModelPlacement::run_on_function(shared_ptr<Function> function)
+{
+    const double unsupported = numeric_limits<double>::infinity();
+
+    vector<Group> groups;
+    unordered_map<Node*, size_t> group_of;
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<op::GetOutputElement>(node))
+        {
+            size_t group = group_of.at(node->get_arguments().at(0).get());
+            groups[group].nodes.push_back(node);
+            group_of[node.get()] = group;
+            continue;
+        }
+        group_of[node.get()] = groups.size();
+        groups.emplace_back();
+        Group& group = groups.back();
+        group.nodes.push_back(node);
+
+        bool free = node->is_parameter() || node->is_output() || node->is_constant();
+        runtime::OpCost cost = runtime::estimate_op_cost(*node);
+        for (const DeviceModel& device : m_devices)
+        {
+            if (free)
+            {
+                group.time.push_back(0);
+            }
+            else if (device.supports && !device.supports(*node))
+            {
+                group.time.push_back(unsupported);
+            }
+            else
+            {
+                // 1 GFLOP/s is 1e3 flops per microsecond, and likewise for bytes.
+                group.time.push_back(device.op_overhead_us +
+                                     max(cost.flops / (device.gflops * 1e3),
+                                         cost.bytes / (device.gbps * 1e3)));
+            }
+        }
+    }
+
+    for (size_t g = 0; g < groups.size(); g++)
+    {
+        for (shared_ptr<Node> node : groups[g].nodes)
+        {
+            for (shared_ptr<Node> arg : node->get_arguments())
+            {
+                size_t p = group_of.at(arg.get());
+                if (p == g)
+                {
+                    continue;
+                }
+                double bytes = static_cast<double>(shape_size(arg->get_output_shape(0)) *
+                                                   arg->get_output_element_type(0).size());
+                groups[p].output_bytes = max(groups[p].output_bytes, bytes);
+                if (find(groups[g].producers.begin(), groups[g].producers.end(), p) ==
+                    groups[g].producers.end())
+                {
+                    groups[g].producers.push_back(p);
+                    groups[p].consumers.push_back(g);
+                }
+            }
+        }
+    }
+
+    auto crossing = [this](double bytes) {
+        return m_transfer.boundary_us +
+               (m_transfer.gbps > 0 ? bytes / (m_transfer.gbps * 1e3) : 0);
+    };
+    // A producer's output crosses once to each other device it is consumed on.
+    auto crossings_from = [&](size_t p) {
+        set<size_t> devices;
+        for (size_t c : groups[p].consumers)
+        {
+            if (groups[c].device != groups[p].device)
+            {
+                devices.insert(groups[c].device);
+            }
+        }
+        return devices.size() * crossing(groups[p].output_bytes);
+    };
+    // Every term of the total that depends on where g is placed.
+    auto local_cost = [&](size_t g) {
+        double cost = groups[g].time[groups[g].device] + crossings_from(g);
+        for (size_t p : groups[g].producers)
+        {
+            cost += crossings_from(p);
+        }
+        return cost;
+    };
+
+    // Moves single groups to another device while that lowers the total.
+    auto improve = [&]() {
+        bool improved = true;
+        for (size_t round = 0; improved && round < 100; round++)
+        {
+            improved = false;
+            for (size_t g = 0; g < groups.size(); g++)
+            {
+                size_t current = groups[g].device;
+                size_t best_device = current;
+                double best_cost = local_cost(g);
+                for (size_t d = 0; d < m_devices.size(); d++)
+                {
+                    if (d == current || groups[g].time[d] == unsupported)
+                    {
+                        continue;
+                    }
+                    groups[g].device = d;
+                    double cost = local_cost(g);
+                    if (cost < best_cost - 1e-9)
+                    {
+                        best_cost = cost;
+                        best_device = d;
+                    }
+                }
+                groups[g].device = best_device;
+                improved = improved || best_device != current;
+            }
+        }
+    };
+    auto total_cost = [&]() {
+        double total = 0;
+        for (size_t g = 0; g < groups.size(); g++)
+        {
+            total += groups[g].time[groups[g].device] + crossings_from(g);
+        }
+        return total;
+    };
+
+    // Groups are in topological order, so producers are placed before their consumers.
+    for (size_t g = 0; g < groups.size(); g++)
+    {
+        double best = unsupported;
+        for (size_t d = 0; d < m_devices.size(); d++)
+        {
+            double cost = groups[g].time[d];
+            for (size_t p : groups[g].producers)
+            {
+                if (groups[p].device != d)
+                {
+                    cost += crossing(groups[p].output_bytes);
+                }
+            }
+            if (cost < best)
+            {
+                best = cost;
+                groups[g].device = d;
+            }
+        }
+        if (best == unsupported)
+        {
+            throw ngraph_error("No device can run " + groups[g].nodes[0]->get_name());
+        }
+    }
+    improve();
+    vector<size_t> best_devices;
+    for (const Group& group : groups)
+    {
+        best_devices.push_back(group.device);
+    }
+    m_estimated_time_us = total_cost();
+
+    // Single moves cannot leave a device the greedy start split the graph onto when every
+    // move adds a crossing, so also search from each device that can run the whole function.
+    for (size_t d = 0; d < m_devices.size(); d++)
+    {
+        bool runs_all = true;
+        for (Group& group : groups)
+        {
+            group.device = d;
+            runs_all = runs_all && group.time[d] != unsupported;
+        }
+        if (!runs_all)
+        {
+            continue;
+        }
+        improve();
+        double total = total_cost();
+        if (total < m_estimated_time_us - 1e-9)
+        {
+            m_estimated_time_us = total;
+            for (size_t g = 0; g < groups.size(); g++)
+            {
+                best_devices[g] = groups[g].device;
+            }
+        }
+    }
+
+    for (size_t g = 0; g < groups.size(); g++)
+    {
+        for (shared_ptr<Node> node : groups[g].nodes)
+        {
+            node->set_placement(m_devices[best_devices[g]].placement);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/placement.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief The speed of one device in the cost model of CostModelPlacement.
+        struct DeviceModel
+        {
+            Placement placement;
+            /// Sustained arithmetic rate, in GFLOP/s
+            double gflops;
+            /// Sustained memory bandwidth, in GB/s
+            double gbps;
+            /// Fixed cost of running one op, in microseconds
+            double op_overhead_us;
+            /// The ops the device can run; every op if empty
+            std::function<bool(const Node&)> supports;
+        };
+
+        /// \brief The cost of a tensor crossing between ops placed on different devices.
+        struct TransferModel
+        {
+            /// Fixed cost of each crossing, which splits the graph into another sub-function
+            /// call, in microseconds
+            double boundary_us = 10;
+            /// Copy bandwidth between devices, in GB/s; 0 when the tensor is passed without a
+            /// copy, as between backends that address host memory
+            double gbps = 0;
+        };
+
+        /// \brief Places each op on the device that minimizes the estimated time of the whole
+        ///   function.
+        ///
+        /// An op is estimated to take its device's overhead plus the larger of its
+        /// runtime::estimate_op_cost flops and bytes over the device's rates. Every device a
+        /// tensor is consumed on other than its producer's adds one crossing. Ops start on the
+        /// device that is cheapest given the placement of their arguments, or all on one
+        /// device, and are then moved one at a time while that lowers the total; the cheapest
+        /// of these placements is kept.
+        class CostModelPlacement : public FunctionPass
+        {
+        public:
+            CostModelPlacement(const std::vector<DeviceModel>& devices,
+                               const TransferModel& transfer = TransferModel());
+
+            bool run_on_function(std::shared_ptr<Function> function) override;
+
+            /// \brief Estimated time of the last function placed, in microseconds.
+            double get_estimated_time_us() const { return m_estimated_time_us; }
+            /// \brief Rough models of the CPU and INTERPRETER backends.
+            static std::vector<DeviceModel> get_host_devices();
+
+        private:
+            std::vector<DeviceModel> m_devices;
+            TransferModel m_transfer;
+            double m_estimated_time_us;
+        };
+    }
+}
@@ -200,6 +200,13 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
             continue;
         }
 
+        // Nodes ordered by control dependencies (e.g. recomputed activations) are
+        // intentional duplicates
+        if (!n->get_control_dependencies().empty())
+        {
+            continue;
+        }
+
         NodeKey n_key{n};
         if (expressions.count(n_key))
         {
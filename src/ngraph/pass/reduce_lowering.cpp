@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/product.hpp"
+#include "ngraph/op/reduce.hpp"
+#include "ngraph/op/reduce_window.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sum.hpp"
+#include "reduce_lowering.hpp"
+
+using namespace ngraph;
+
+#define TI(x) std::type_index(typeid(x))
+
+// If the reduction function does nothing but apply one binary op to its two parameters, return
+// that op; otherwise return nullptr. Every op we lower is commutative, so the parameters may be
+// used in either order.
+static std::shared_ptr<Node> get_reduction_op(const std::shared_ptr<Function>& f)
+{
+    auto& params = f->get_parameters();
+    auto& results = f->get_results();
+    if (params.size() != 2 || results.size() != 1)
+    {
+        return nullptr;
+    }
+
+    auto op = results.at(0)->get_argument(0);
+    if (op->get_arguments().size() != 2)
+    {
+        return nullptr;
+    }
+
+    auto a0 = op->get_argument(0);
+    auto a1 = op->get_argument(1);
+    if ((a0 == params.at(0) && a1 == params.at(1)) || (a0 == params.at(1) && a1 == params.at(0)))
+    {
+        return op;
+    }
+    return nullptr;
+}
+
+static AxisVector default_order(size_t rank)
+{
+    AxisVector order(rank);
+    std::iota(begin(order), end(order), 0);
+    return order;
+}
+
+// Returns true if init is a constant that leaves every value unchanged under the reduction op.
+static bool is_identity(const std::shared_ptr<Node>& reduction_op,
+                        const std::shared_ptr<Node>& init)
+{
+    const Node& op = *reduction_op;
+    if (TI(op) == TI(op::Add))
+    {
+        return is_zero(init);
+    }
+    if (TI(op) == TI(op::Multiply))
+    {
+        return is_one(init);
+    }
+    if (init->get_element_type().is_real())
+    {
+        if (TI(op) == TI(op::Maximum))
+        {
+            return is_equal_to_const_value("-inf", init);
+        }
+        if (TI(op) == TI(op::Minimum))
+        {
+            return is_equal_to_const_value("inf", init);
+        }
+    }
+    return false;
+}
+
+// Combines the reduced value with the broadcast initial value, as the generic kernels do by
+// seeding the accumulator with it.
+static std::shared_ptr<Node> fold_init(const std::shared_ptr<Node>& reduction_op,
+                                       const std::shared_ptr<Node>& reduced,
+                                       const std::shared_ptr<Node>& init)
+{
+    if (is_identity(reduction_op, init))
+    {
+        return reduced;
+    }
+
+    auto shape = reduced->get_shape();
+    std::shared_ptr<Node> broadcast_init = init;
+    if (shape.size() != 0)
+    {
+        AxisSet axes;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            axes.insert(i);
+        }
+        broadcast_init = std::make_shared<op::Broadcast>(init, shape, axes);
+    }
+    return reduction_op->copy_with_new_args(NodeVector{reduced, broadcast_init});
+}
+
+static bool lower_reduce(const std::shared_ptr<Function>& function,
+                         const std::shared_ptr<Node>& node)
+{
+    auto reduce = std::static_pointer_cast<op::Reduce>(node);
+    auto reduction_op = get_reduction_op(reduce->get_functions().at(0));
+    if (!reduction_op)
+    {
+        return false;
+    }
+
+    auto arg = reduce->get_argument(0);
+    auto& axes = reduce->get_reduction_axes();
+    const Node& op = *reduction_op;
+
+    std::shared_ptr<Node> reduced;
+    if (TI(op) == TI(op::Add))
+    {
+        reduced = std::make_shared<op::Sum>(arg, axes);
+    }
+    else if (TI(op) == TI(op::Multiply))
+    {
+        reduced = std::make_shared<op::Product>(arg, axes);
+    }
+    else if (TI(op) == TI(op::Maximum))
+    {
+        reduced = std::make_shared<op::Max>(arg, axes);
+    }
+    else if (TI(op) == TI(op::Minimum))
+    {
+        reduced = std::make_shared<op::Min>(arg, axes);
+    }
+    else
+    {
+        return false;
+    }
+
+    function->replace_node(node, fold_init(reduction_op, reduced, reduce->get_argument(1)));
+    return true;
+}
+
+static bool lower_reduce_window(const std::shared_ptr<Function>& function,
+                                const std::shared_ptr<Node>& node)
+{
+    auto reduce_window = std::static_pointer_cast<op::ReduceWindow>(node);
+    auto reduction_op = get_reduction_op(reduce_window->get_functions().at(0));
+    if (!reduction_op)
+    {
+        return false;
+    }
+
+    const Node& op = *reduction_op;
+    auto& element_type = node->get_element_type();
+    bool is_max = TI(op) == TI(op::Maximum);
+    // Min goes through negated MaxPool, which would overflow for the smallest signed integer.
+    // There is no sum pooling kernel, and scaling AvgPool by the window size would not give
+    // the same sums, so windowed Add stays generic like Multiply.
+    bool is_real_min = TI(op) == TI(op::Minimum) && element_type.is_real();
+    if (!is_max && !is_real_min)
+    {
+        return false;
+    }
+
+    auto arg = reduce_window->get_argument(0);
+    Shape arg_shape = arg->get_shape();
+    Shape out_shape = node->get_shape();
+    Shape window_shape = reduce_window->get_window_shape();
+    Strides window_strides = reduce_window->get_window_movement_strides();
+    if (arg_shape.size() == 0)
+    {
+        return false;
+    }
+
+    // The pooling ops slide their window over the axes after the batch and channel axes. When
+    // the window does not already leave the first two axes alone, view the tensor as a single
+    // batch item with a single channel.
+    bool pooled_layout = arg_shape.size() > 2 && window_shape.at(0) == 1 &&
+                         window_shape.at(1) == 1 && window_strides.at(0) == 1 &&
+                         window_strides.at(1) == 1;
+    Shape pool_window;
+    Strides pool_strides;
+    std::shared_ptr<Node> pool_arg = arg;
+    if (pooled_layout)
+    {
+        pool_window = Shape(window_shape.begin() + 2, window_shape.end());
+        pool_strides = Strides(window_strides.begin() + 2, window_strides.end());
+    }
+    else
+    {
+        pool_window = window_shape;
+        pool_strides = window_strides;
+        Shape pool_shape{1, 1};
+        pool_shape.insert(pool_shape.end(), arg_shape.begin(), arg_shape.end());
+        pool_arg = std::make_shared<op::Reshape>(arg, default_order(arg_shape.size()), pool_shape);
+    }
+
+    std::shared_ptr<Node> pooled;
+    if (is_max)
+    {
+        pooled = std::make_shared<op::MaxPool>(pool_arg, pool_window, pool_strides);
+    }
+    else
+    {
+        pooled = std::make_shared<op::Negative>(std::make_shared<op::MaxPool>(
+            std::make_shared<op::Negative>(pool_arg), pool_window, pool_strides));
+    }
+
+    if (!pooled_layout)
+    {
+        pooled = std::make_shared<op::Reshape>(
+            pooled, default_order(pooled->get_shape().size()), out_shape);
+    }
+
+    function->replace_node(node, fold_init(reduction_op, pooled, reduce_window->get_argument(1)));
+    return true;
+}
+
+static const std::unordered_map<std::type_index,
+                                std::function<bool(const std::shared_ptr<Function>&,
+                                                   const std::shared_ptr<Node>&)>>
+    dispatcher{{TI(op::Reduce), &lower_reduce}, {TI(op::ReduceWindow), &lower_reduce_window}};
+
+bool pass::ReduceLowering::run_on_function(std::shared_ptr<Function> function)
+{
+    bool clobbered = false;
+
+    for (const auto& n : function->get_ops())
+    {
+        // Work around a warning [-Wpotentially-evaluated-expression]
+        const Node& node = *n;
+        auto handler = dispatcher.find(TI(node));
+        if (handler != dispatcher.end())
+        {
+            clobbered = handler->second(function, n) || clobbered;
+        }
+    }
+
+    return clobbered;
+}
@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Replaces Reduce and ReduceWindow nodes whose reduction function is a single
+        ///        Add, Multiply, Maximum or Minimum of its two parameters with the dedicated
+        ///        reduction (Sum, Product, Max, Min) or pooling (MaxPool) ops.
+        ///
+        /// The initial value is folded in with the same binary op unless it is a constant
+        /// identity for it. Reductions with any other function, and windowed Add and Multiply,
+        /// are left alone and keep using the generic implementation.
+        class ReduceLowering : public FunctionPass
+        {
+        public:
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+        };
+    }
+}
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <deque>
+#include <map>
 #include <sstream>
 
 #include "ngraph/function.hpp"
@@ -152,6 +153,17 @@ static vector<unordered_set<shared_ptr<Node>>>
     return clusters;
 }
 
+// Make dst_node read par_node where it read src_node
+static void replace_input_source(const shared_ptr<Node>& src_node,
+                                 const shared_ptr<Node>& dst_node,
+                                 const shared_ptr<op::Parameter>& par_node)
+{
+    descriptor::Input* dst_input = dst_node->get_input_from(src_node);
+    descriptor::Output* src_output = src_node->get_output_to(dst_node);
+    src_output->remove_input(dst_input);
+    dst_input->replace_output(par_node, 0);
+}
+
 // Split function by placement, maximizing the span each subgraph. Each subgraph will be placed in
 // a single device.
 //
@@ -166,9 +178,9 @@ pair<vector<shared_ptr<Function>>, unordered_map<shared_ptr<op::Parameter>, shar
     // Map from (intermediate) parameter to result node, for guiding data copy among devices
     unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> map_parameter_to_result;
 
-    // Split neighboring nodes if they belong to different clusters
-    // TODO: optimization to group multiple result node from the same source,
-    //       and to group the parameter node in the same cluster with the same result node source
+    // Split neighboring nodes if they belong to different clusters. A source feeding several
+    // clusters gets one Result, and each of those clusters one Parameter for it, however many
+    // of its nodes consume the source.
     unordered_map<shared_ptr<Node>, unordered_set<shared_ptr<Node>>*> map_node_to_cluster;
     for (auto& cluster : clusters)
     {
@@ -177,13 +189,40 @@ pair<vector<shared_ptr<Function>>, unordered_map<shared_ptr<op::Parameter>, shar
             map_node_to_cluster[node] = &cluster;
         }
     }
+    unordered_map<shared_ptr<Node>, shared_ptr<op::Result>> map_source_to_result;
+    map<pair<shared_ptr<Node>, unordered_set<shared_ptr<Node>>*>, shared_ptr<op::Parameter>>
+        map_source_to_parameter;
     for (auto dst_node : f->get_ordered_ops())
     {
         for (auto src_node : dst_node->get_arguments())
         {
             auto src_cluster = map_node_to_cluster.at(src_node);
             auto dst_cluster = map_node_to_cluster.at(dst_node);
-            if (src_cluster != dst_cluster)
+            if (src_cluster == dst_cluster)
+            {
+                continue;
+            }
+
+            auto key = make_pair(src_node, dst_cluster);
+            auto par_it = map_source_to_parameter.find(key);
+            auto res_it = map_source_to_result.find(src_node);
+            if (par_it != map_source_to_parameter.end())
+            {
+                // Read the Parameter this cluster already has for src_node
+                replace_input_source(src_node, dst_node, par_it->second);
+            }
+            else if (res_it != map_source_to_result.end())
+            {
+                // Add a Parameter for the Result src_node already has
+                auto par_node = make_shared<op::Parameter>(src_node->get_output_element_type(0),
+                                                           src_node->get_output_shape(0));
+                par_node->set_placement(dst_node->get_placement());
+                replace_input_source(src_node, dst_node, par_node);
+                map_parameter_to_result[par_node] = res_it->second;
+                map_source_to_parameter[key] = par_node;
+                dst_cluster->insert(par_node);
+            }
+            else
             {
                 // Split src_node and dst_node
                 pair<shared_ptr<op::Result>, shared_ptr<op::Parameter>> res_par_pair =
@@ -191,6 +230,8 @@ pair<vector<shared_ptr<Function>>, unordered_map<shared_ptr<op::Parameter>, shar
                 shared_ptr<op::Result> res_node = res_par_pair.first;
                 shared_ptr<op::Parameter> par_node = res_par_pair.second;
                 map_parameter_to_result[par_node] = res_node;
+                map_source_to_result[src_node] = res_node;
+                map_source_to_parameter[key] = par_node;
 
                 // Insert newly created nodes into clusters
                 src_cluster->insert(res_node);
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "ngraph/runtime/async_executor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::AsyncExecutor::AsyncExecutor(size_t thread_count)
+    : m_thread_count(max<size_t>(thread_count, 1))
+    , m_stopping(false)
+{
+}
+
+runtime::AsyncExecutor::~AsyncExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for (thread& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+future<bool> runtime::AsyncExecutor::submit(const void* key, function<bool()> work)
+{
+    packaged_task<bool()> task(move(work));
+    future<bool> result = task.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_threads.empty())
+        {
+            for (size_t i = 0; i < m_thread_count; i++)
+            {
+                m_threads.emplace_back(&AsyncExecutor::run, this);
+            }
+        }
+
+        // A lane is in m_ready exactly when it has work and no worker is running it.
+        Lane& lane = m_lanes[key];
+        lane.tasks.push_back(move(task));
+        if (!lane.active && lane.tasks.size() == 1)
+        {
+            m_ready.push_back(key);
+        }
+    }
+    m_condition.notify_one();
+    return result;
+}
+
+void runtime::AsyncExecutor::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] { return m_stopping || !m_ready.empty(); });
+        if (m_ready.empty())
+        {
+            return;
+        }
+
+        const void* key = m_ready.front();
+        m_ready.pop_front();
+        Lane& lane = m_lanes[key];
+        packaged_task<bool()> task = move(lane.tasks.front());
+        lane.tasks.pop_front();
+        lane.active = true;
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        lane.active = false;
+        if (lane.tasks.empty())
+        {
+            m_lanes.erase(key);
+        }
+        else
+        {
+            m_ready.push_back(key);
+            m_condition.notify_one();
+        }
+    }
+}
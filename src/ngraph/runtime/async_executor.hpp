@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief A pool of worker threads that runs queued work, keeping the work submitted
+        ///   under one key in order and one item at a time.
+        ///
+        /// Backends key calls by Function, so calls of one function, which share a call
+        /// frame, never overlap, while calls of different functions run in parallel.
+        /// Workers start with the first submission and finish all queued work before the
+        /// executor is destroyed.
+        class AsyncExecutor
+        {
+        public:
+            explicit AsyncExecutor(size_t thread_count);
+            ~AsyncExecutor();
+
+            std::future<bool> submit(const void* key, std::function<bool()> work);
+
+        private:
+            struct Lane
+            {
+                std::deque<std::packaged_task<bool()>> tasks;
+                bool active = false;
+            };
+
+            void run();
+
+            size_t m_thread_count;
+            std::map<const void*, Lane> m_lanes;
+            std::deque<const void*> m_ready;
+            bool m_stopping;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::vector<std::thread> m_threads;
+        };
+    }
+}
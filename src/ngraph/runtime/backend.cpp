@@ -90,6 +90,22 @@ vector<string> runtime::Backend::get_registered_devices()
     return rc;
 }
 
+future<bool> runtime::Backend::async_call(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    promise<bool> result;
+    try
+    {
+        result.set_value(call(func, outputs, inputs));
+    }
+    catch (...)
+    {
+        result.set_exception(current_exception());
+    }
+    return result.get_future();
+}
+
 void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include "ngraph/function.hpp"
@@ -69,12 +70,35 @@ namespace ngraph
                               const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                               const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) = 0;
 
+            /// @brief Start a call and return without waiting for it to finish.
+            ///
+            /// Calls of one function run in the order they were made; calls of different
+            /// functions may run at the same time. The tensors passed belong to the call until
+            /// the future is ready, so stage the next call's inputs in other tensors to overlap
+            /// it with this one. The default runs the call before returning.
+            /// @returns A future holding the result of call, or the exception it threw.
+            virtual std::future<bool>
+                async_call(std::shared_ptr<Function> func,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
             virtual void remove_compiled_function(std::shared_ptr<Function> func);
 
             virtual void enable_performance_data(std::shared_ptr<Function> func, bool enable) {}
+            /// @brief Also count cycles, instructions and last-level cache misses around each op
+            ///   in the performance data. Enables performance data; like it, must be called
+            ///   before the function is compiled. Backends without support ignore this.
+            virtual void enable_hardware_counters(std::shared_ptr<Function> func, bool enable) {}
             virtual std::vector<PerformanceCounter>
                 get_performance_data(std::shared_ptr<Function> func) const;
 
+            /// @brief Start or stop recording a timeline of the ops executed by every function
+            ///   on this backend. Backends without tracing support ignore this.
+            virtual void enable_tracing(bool enable) {}
+            /// @brief Write the ops recorded since the last call to file_name in Chrome trace
+            ///   event format and discard them.
+            virtual void write_trace(const std::string& file_name) {}
+
             static bool register_backend(const std::string& name, std::shared_ptr<Backend>);
 
         protected:
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<size_t>
+    get_batched_parameters(const shared_ptr<Function>& function,
+                           const map<size_t, shared_ptr<runtime::TensorView>>& shared_inputs)
+{
+    vector<size_t> batched;
+    for (size_t i = 0; i < function->get_parameters().size(); i++)
+    {
+        if (shared_inputs.count(i) == 0)
+        {
+            batched.push_back(i);
+        }
+    }
+    return batched;
+}
+
+runtime::BatchingExecutor::BatchingExecutor(
+    const shared_ptr<Backend>& backend,
+    const shared_ptr<Function>& function,
+    const BatchingConfig& config,
+    const map<size_t, shared_ptr<TensorView>>& shared_inputs)
+    : m_backend(backend)
+    , m_config(config)
+    , m_function(backend,
+                 function,
+                 config.max_batch,
+                 get_batched_parameters(function, shared_inputs))
+    , m_batched_parameters(get_batched_parameters(function, shared_inputs))
+    , m_shared_inputs(function->get_parameters().size())
+    , m_stopping(false)
+    , m_start(clock::now())
+    , m_total_queue_ms(0)
+    , m_total_fill(0)
+{
+    for (auto& p : shared_inputs)
+    {
+        m_shared_inputs.at(p.first) = p.second;
+    }
+
+    auto make_slot = [this](const element::Type& element_type, const Shape& shape) {
+        unique_ptr<Slot> slot(new Slot);
+        slot->element_type = element_type;
+        slot->shape = shape;
+        slot->row_bytes = shape_size(shape) / shape[0] * element_type.size();
+        slot->buffer.initialize(slot->row_bytes * m_config.max_batch, 64);
+        return slot;
+    };
+    for (size_t i : m_batched_parameters)
+    {
+        const auto& param = function->get_parameters()[i];
+        m_input_slots.push_back(make_slot(param->get_element_type(), param->get_shape()));
+    }
+    for (size_t i = 0; i < function->get_output_size(); i++)
+    {
+        m_output_slots.push_back(
+            make_slot(function->get_output_element_type(i), function->get_output_shape(i)));
+    }
+
+    m_worker = thread(&BatchingExecutor::run, this);
+}
+
+runtime::BatchingExecutor::~BatchingExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    m_worker.join();
+}
+
+future<void> runtime::BatchingExecutor::submit(const vector<shared_ptr<TensorView>>& inputs,
+                                               const vector<shared_ptr<TensorView>>& outputs)
+{
+    auto check = [](const string& kind,
+                    const vector<shared_ptr<TensorView>>& tensors,
+                    const vector<unique_ptr<Slot>>& slots) {
+        if (tensors.size() != slots.size())
+        {
+            throw runtime_error("Request has " + to_string(tensors.size()) + " " + kind +
+                                "s, expected " + to_string(slots.size()));
+        }
+        for (size_t i = 0; i < tensors.size(); i++)
+        {
+            Shape expected = slots[i]->shape;
+            expected[0] = 1;
+            if (tensors[i]->get_shape() != expected ||
+                tensors[i]->get_tensor().get_element_type() != slots[i]->element_type)
+            {
+                throw runtime_error("Request " + kind + " " + to_string(i) + " shape {" +
+                                    join(tensors[i]->get_shape()) + "} does not match {" +
+                                    join(expected) + "}");
+            }
+        }
+    };
+    check("input", inputs, m_input_slots);
+    check("output", outputs, m_output_slots);
+
+    Request request;
+    request.inputs = inputs;
+    request.outputs = outputs;
+    request.submitted = clock::now();
+    future<void> result = request.promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stopping)
+        {
+            throw runtime_error("BatchingExecutor is shutting down");
+        }
+        m_queue.push_back(move(request));
+    }
+    m_condition.notify_all();
+    return result;
+}
+
+runtime::BatchingStatistics runtime::BatchingExecutor::get_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    BatchingStatistics statistics = m_statistics;
+    if (statistics.requests > 0)
+    {
+        statistics.mean_queue_ms = m_total_queue_ms / statistics.requests;
+    }
+    if (statistics.batches > 0)
+    {
+        statistics.mean_fill_ratio = m_total_fill / statistics.batches;
+    }
+    double seconds = chrono::duration<double>(clock::now() - m_start).count();
+    statistics.requests_per_second = seconds > 0 ? statistics.requests / seconds : 0;
+    return statistics;
+}
+
+void runtime::BatchingExecutor::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        // Give later requests until the oldest one's deadline to fill the batch.
+        clock::time_point deadline = m_queue.front().submitted + m_config.max_delay;
+        m_condition.wait_until(lock, deadline, [this] {
+            return m_stopping || m_queue.size() >= m_config.max_batch;
+        });
+
+        size_t rows = m_function.get_batch_size_for(min(m_queue.size(), m_config.max_batch));
+        vector<Request> batch;
+        for (size_t i = 0; i < rows; i++)
+        {
+            batch.push_back(move(m_queue.front()));
+            m_queue.pop_front();
+        }
+
+        clock::time_point started = clock::now();
+        for (const Request& request : batch)
+        {
+            double queue_ms =
+                chrono::duration<double, milli>(started - request.submitted).count();
+            m_total_queue_ms += queue_ms;
+            m_statistics.max_queue_ms = max(m_statistics.max_queue_ms, queue_ms);
+        }
+        m_statistics.requests += rows;
+        m_statistics.batches++;
+        m_total_fill += static_cast<double>(rows) / m_config.max_batch;
+
+        lock.unlock();
+        execute(batch);
+        lock.lock();
+    }
+}
+
+void runtime::BatchingExecutor::execute(vector<Request>& batch)
+{
+    size_t rows = batch.size();
+    try
+    {
+        // The batch tensors alias the front of the slot buffers, so gathering a request is
+        // a single read into its row and scattering a single write from it.
+        vector<shared_ptr<TensorView>> inputs = m_shared_inputs;
+        for (size_t i = 0; i < m_input_slots.size(); i++)
+        {
+            Slot& slot = *m_input_slots[i];
+            char* base = static_cast<char*>(slot.buffer.get_ptr());
+            for (size_t row = 0; row < rows; row++)
+            {
+                batch[row].inputs[i]->read(base + row * slot.row_bytes, 0, slot.row_bytes);
+            }
+            Shape shape = slot.shape;
+            shape[0] = rows;
+            inputs[m_batched_parameters[i]] =
+                m_backend->create_tensor(slot.element_type, shape, base);
+        }
+        vector<shared_ptr<TensorView>> outputs;
+        for (auto& slot : m_output_slots)
+        {
+            Shape shape = slot->shape;
+            shape[0] = rows;
+            outputs.push_back(
+                m_backend->create_tensor(slot->element_type, shape, slot->buffer.get_ptr()));
+        }
+
+        m_function.call(outputs, inputs);
+
+        for (size_t i = 0; i < m_output_slots.size(); i++)
+        {
+            Slot& slot = *m_output_slots[i];
+            const char* base = static_cast<const char*>(slot.buffer.get_ptr());
+            for (size_t row = 0; row < rows; row++)
+            {
+                batch[row].outputs[i]->write(base + row * slot.row_bytes, 0, slot.row_bytes);
+            }
+        }
+        for (Request& request : batch)
+        {
+            request.promise.set_value();
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : batch)
+        {
+            request.promise.set_exception(current_exception());
+        }
+    }
+}
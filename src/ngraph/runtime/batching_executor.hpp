@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/bucketed_batch_function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        struct BatchingConfig
+        {
+            /// Largest batch formed; the function is built with this leading dimension.
+            size_t max_batch = 32;
+            /// How long the oldest queued request may wait for others to join its batch.
+            std::chrono::microseconds max_delay{1000};
+        };
+
+        struct BatchingStatistics
+        {
+            size_t requests = 0;
+            size_t batches = 0;
+            /// Time from submit() until the request's batch starts executing.
+            double mean_queue_ms = 0;
+            double max_queue_ms = 0;
+            /// Mean of batch size / max_batch.
+            double mean_fill_ratio = 0;
+            /// Requests executed per second since the executor was created.
+            double requests_per_second = 0;
+        };
+
+        /// \brief Coalesces single-row inference requests into batched calls.
+        ///
+        /// Requests are queued by submit() and executed by a worker thread. A batch is
+        /// dispatched when max_batch requests are waiting or the oldest has waited max_delay,
+        /// and is sized to one of the batch sizes BucketedBatchFunction compiles, so it runs
+        /// without being split. Request rows are read straight into the batch's input buffers
+        /// and results written straight from its output buffers, one copy each way.
+        class BatchingExecutor
+        {
+        public:
+            /// \param function Built with config.max_batch as the leading dimension of every
+            ///   parameter that is not in shared_inputs.
+            /// \param shared_inputs Tensors for the parameters every request shares, such as
+            ///   weights, keyed by parameter index.
+            BatchingExecutor(const std::shared_ptr<Backend>& backend,
+                             const std::shared_ptr<Function>& function,
+                             const BatchingConfig& config,
+                             const std::map<size_t, std::shared_ptr<TensorView>>& shared_inputs =
+                                 std::map<size_t, std::shared_ptr<TensorView>>());
+            /// Executes the requests still queued, then stops the worker.
+            ~BatchingExecutor();
+
+            /// \brief Queue one request.
+            /// \param inputs One tensor per parameter not in shared_inputs, in parameter order,
+            ///   with a leading dimension of 1.
+            /// \param outputs One tensor per result, with a leading dimension of 1. Filled in
+            ///   when the returned future is ready.
+            std::future<void> submit(const std::vector<std::shared_ptr<TensorView>>& inputs,
+                                     const std::vector<std::shared_ptr<TensorView>>& outputs);
+
+            BatchingStatistics get_statistics() const;
+
+        private:
+            using clock = std::chrono::steady_clock;
+
+            struct Request
+            {
+                std::vector<std::shared_ptr<TensorView>> inputs;
+                std::vector<std::shared_ptr<TensorView>> outputs;
+                std::promise<void> promise;
+                clock::time_point submitted;
+            };
+
+            struct Slot
+            {
+                element::Type element_type;
+                Shape shape;
+                size_t row_bytes;
+                AlignedBuffer buffer;
+            };
+
+            void run();
+            void execute(std::vector<Request>& batch);
+
+            std::shared_ptr<Backend> m_backend;
+            BatchingConfig m_config;
+            BucketedBatchFunction m_function;
+            std::vector<size_t> m_batched_parameters;
+            std::vector<std::shared_ptr<TensorView>> m_shared_inputs;
+            std::vector<std::unique_ptr<Slot>> m_input_slots;
+            std::vector<std::unique_ptr<Slot>> m_output_slots;
+
+            std::deque<Request> m_queue;
+            bool m_stopping;
+            mutable std::mutex m_mutex;
+            std::condition_variable m_condition;
+
+            clock::time_point m_start;
+            BatchingStatistics m_statistics;
+            double m_total_queue_ms;
+            double m_total_fill;
+
+            std::thread m_worker;
+        };
+    }
+}
@@ -0,0 +1,435 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <sstream>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/op/util/unary_elementwise.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/bucketed_batch_function.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::BucketedBatchFunction::BucketedBatchFunction(const shared_ptr<Backend>& backend,
+                                                      const shared_ptr<Function>& function,
+                                                      size_t max_batch,
+                                                      const vector<size_t>& batched_parameters)
+    : m_backend(backend)
+    , m_function(clone_function(*function))
+    , m_max_batch(max_batch)
+{
+    if (max_batch == 0)
+    {
+        throw ngraph_error("The batch bound must be at least 1");
+    }
+
+    const op::ParameterVector& params = m_function->get_parameters();
+    m_batched_parameters.resize(params.size(), batched_parameters.empty());
+    for (size_t index : batched_parameters)
+    {
+        if (index >= params.size())
+        {
+            throw ngraph_error("Batched parameter index " + to_string(index) +
+                               " is out of range");
+        }
+        m_batched_parameters[index] = true;
+    }
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        const Shape& shape = params[i]->get_shape();
+        bool has_batch = !shape.empty() && shape[0] == max_batch;
+        if (m_batched_parameters[i] && !has_batch)
+        {
+            if (!batched_parameters.empty())
+            {
+                throw ngraph_error("Parameter " + to_string(i) + " shape {" + join(shape) +
+                                   "} does not lead with the batch bound " +
+                                   to_string(max_batch));
+            }
+            m_batched_parameters[i] = false;
+        }
+    }
+    if (find(m_batched_parameters.begin(), m_batched_parameters.end(), true) ==
+        m_batched_parameters.end())
+    {
+        throw ngraph_error("No parameter has the batch bound as its leading dimension");
+    }
+
+    analyze();
+}
+
+// Records which nodes carry the batch as the leading dimension of their output and checks
+// that each of them computes a row of its output from the same row of its batched arguments.
+void runtime::BucketedBatchFunction::analyze()
+{
+    const op::ParameterVector& params = m_function->get_parameters();
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        if (m_batched_parameters[i])
+        {
+            m_batched_nodes.insert(params[i].get());
+        }
+    }
+
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        if (node->is_parameter())
+        {
+            continue;
+        }
+
+        NodeVector args = node->get_arguments();
+        vector<bool> batched;
+        for (shared_ptr<Node> arg : args)
+        {
+            batched.push_back(m_batched_nodes.count(arg.get()) != 0);
+        }
+        bool any_batched = find(batched.begin(), batched.end(), true) != batched.end();
+        bool all_batched = find(batched.begin(), batched.end(), false) == batched.end();
+
+        bool separable = false;
+        if (!any_batched)
+        {
+            // A broadcast along the batch axis yields identical rows, so it is rebuilt at
+            // each batch size rather than shared.
+            auto broadcast = dynamic_pointer_cast<op::Broadcast>(node);
+            if (broadcast && broadcast->get_broadcast_axes().count(0) != 0 &&
+                broadcast->get_shape()[0] == m_max_batch)
+            {
+                m_batched_nodes.insert(node.get());
+            }
+            continue;
+        }
+        else if (auto softmax = dynamic_pointer_cast<op::Softmax>(node))
+        {
+            separable = softmax->get_axes().count(0) == 0;
+        }
+        else if (dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) ||
+                 dynamic_pointer_cast<op::util::UnaryElementwise>(node) ||
+                 dynamic_pointer_cast<op::util::BinaryElementwise>(node) ||
+                 dynamic_pointer_cast<op::Select>(node) ||
+                 dynamic_pointer_cast<op::Result>(node) ||
+                 dynamic_pointer_cast<op::GetOutputElement>(node))
+        {
+            separable = all_batched;
+        }
+        else if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(node))
+        {
+            separable = reduction->get_reduction_axes().count(0) == 0;
+        }
+        else if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+        {
+            separable = batched[0] && !batched[1] &&
+                        dot->get_reduction_axes_count() < args[0]->get_shape().size();
+        }
+        else if (dynamic_pointer_cast<op::Convolution>(node))
+        {
+            separable = batched[0] && !batched[1];
+        }
+        else if (dynamic_pointer_cast<op::AvgPool>(node) || dynamic_pointer_cast<op::MaxPool>(node))
+        {
+            separable = true;
+        }
+        else if (auto concat = dynamic_pointer_cast<op::Concat>(node))
+        {
+            separable = all_batched && concat->get_concatenation_axis() != 0;
+        }
+        else if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+        {
+            separable = broadcast->get_broadcast_axes().count(0) == 0;
+        }
+        else if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+        {
+            separable = reshape->get_input_order()[0] == 0 &&
+                        reshape->get_output_shape().size() > 0 &&
+                        reshape->get_output_shape()[0] == m_max_batch;
+        }
+        else if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+        {
+            separable = slice->get_lower_bounds()[0] == 0 &&
+                        slice->get_upper_bounds()[0] == m_max_batch &&
+                        slice->get_strides()[0] == 1;
+        }
+
+        if (!separable)
+        {
+            throw ngraph_error("Node " + node->get_name() + " (" + node->description() +
+                               ") does not keep the rows of the batch independent");
+        }
+        m_batched_nodes.insert(node.get());
+    }
+
+    for (shared_ptr<op::Result> result : m_function->get_results())
+    {
+        if (m_batched_nodes.count(result.get()) == 0)
+        {
+            throw ngraph_error("Result " + result->get_name() + " does not depend on the batch");
+        }
+    }
+}
+
+shared_ptr<Function> runtime::BucketedBatchFunction::specialize(size_t batch_size) const
+{
+    auto with_batch = [batch_size](Shape shape) {
+        shape[0] = batch_size;
+        return shape;
+    };
+
+    NodeMap node_map;
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        NodeVector args;
+        for (shared_ptr<Node> arg : node->get_arguments())
+        {
+            args.push_back(node_map.get(arg));
+        }
+
+        shared_ptr<Node> clone;
+        bool batched = m_batched_nodes.count(node.get()) != 0;
+        if (!batched)
+        {
+            clone = node->copy_with_new_args(args);
+        }
+        else if (auto param = dynamic_pointer_cast<op::Parameter>(node))
+        {
+            clone = make_shared<op::Parameter>(param->get_element_type(),
+                                               with_batch(param->get_shape()),
+                                               param->get_cacheable());
+        }
+        else if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+        {
+            clone = make_shared<op::Broadcast>(args[0],
+                                               with_batch(broadcast->get_broadcast_shape()),
+                                               broadcast->get_broadcast_axes());
+        }
+        else if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+        {
+            clone = make_shared<op::Reshape>(
+                args[0], reshape->get_input_order(), with_batch(reshape->get_output_shape()));
+        }
+        else if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+        {
+            Coordinate upper_bounds = slice->get_upper_bounds();
+            upper_bounds[0] = batch_size;
+            clone = make_shared<op::Slice>(
+                args[0], slice->get_lower_bounds(), upper_bounds, slice->get_strides());
+        }
+        else
+        {
+            clone = node->copy_with_new_args(args);
+        }
+        node_map.add(node, clone);
+    }
+
+    ResultVector results;
+    for (shared_ptr<op::Result> result : m_function->get_results())
+    {
+        results.push_back(static_pointer_cast<op::Result>(node_map.get(result)));
+    }
+    op::ParameterVector params;
+    for (shared_ptr<op::Parameter> param : m_function->get_parameters())
+    {
+        params.push_back(static_pointer_cast<op::Parameter>(node_map.get(param)));
+    }
+    return make_shared<Function>(results, params);
+}
+
+runtime::BucketedBatchFunction::Specialization&
+    runtime::BucketedBatchFunction::get_specialization(size_t batch_size)
+{
+    auto it = m_specializations.find(batch_size);
+    if (it != m_specializations.end())
+    {
+        return it->second;
+    }
+
+    bool power_of_two = (batch_size & (batch_size - 1)) == 0;
+    if (batch_size == 0 ||
+        (batch_size != m_max_batch && (batch_size > m_max_batch || !power_of_two)))
+    {
+        throw ngraph_error("No specialization for a batch of " + to_string(batch_size));
+    }
+
+    Specialization specialization;
+    specialization.function = specialize(batch_size);
+    m_backend->compile(specialization.function);
+
+    // Staging tensors are only used when a call is split, but allocating them here keeps
+    // them out of the call path.
+    const op::ParameterVector& params = specialization.function->get_parameters();
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        specialization.inputs.push_back(
+            m_batched_parameters[i]
+                ? m_backend->create_tensor(params[i]->get_element_type(), params[i]->get_shape())
+                : nullptr);
+    }
+    for (size_t i = 0; i < specialization.function->get_output_size(); i++)
+    {
+        specialization.outputs.push_back(
+            m_backend->create_tensor(specialization.function->get_output_element_type(i),
+                                     specialization.function->get_output_shape(i)));
+    }
+    return m_specializations.insert({batch_size, move(specialization)}).first->second;
+}
+
+shared_ptr<Function> runtime::BucketedBatchFunction::get_function(size_t batch_size)
+{
+    lock_guard<mutex> lock(m_mutex);
+    return get_specialization(batch_size).function;
+}
+
+vector<size_t> runtime::BucketedBatchFunction::get_compiled_batch_sizes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<size_t> sizes;
+    for (auto& p : m_specializations)
+    {
+        sizes.push_back(p.first);
+    }
+    return sizes;
+}
+
+size_t runtime::BucketedBatchFunction::get_batch_size_for(size_t rows) const
+{
+    if (rows >= m_max_batch)
+    {
+        return m_max_batch;
+    }
+    size_t step = 1;
+    while (step * 2 <= rows)
+    {
+        step *= 2;
+    }
+    return step;
+}
+
+void runtime::BucketedBatchFunction::call(const vector<shared_ptr<TensorView>>& outputs,
+                                          const vector<shared_ptr<TensorView>>& inputs)
+{
+    const op::ParameterVector& params = m_function->get_parameters();
+    if (inputs.size() != params.size() || outputs.size() != m_function->get_output_size())
+    {
+        stringstream ss;
+        ss << "Call with " << inputs.size() << " inputs and " << outputs.size()
+           << " outputs does not match Function with " << params.size() << " parameters and "
+           << m_function->get_output_size() << " results";
+        throw runtime_error(ss.str());
+    }
+
+    size_t batch_size = 0;
+    for (size_t i = 0; i < inputs.size() && batch_size == 0; i++)
+    {
+        if (m_batched_parameters[i] && !inputs[i]->get_shape().empty())
+        {
+            batch_size = inputs[i]->get_shape()[0];
+        }
+    }
+    if (batch_size == 0 || batch_size > m_max_batch)
+    {
+        throw runtime_error("Batch of " + to_string(batch_size) + " is outside 1.." +
+                            to_string(m_max_batch));
+    }
+
+    auto check = [&](const string& kind,
+                     size_t index,
+                     const shared_ptr<TensorView>& tensor,
+                     bool batched,
+                     Shape expected) {
+        if (batched)
+        {
+            expected[0] = batch_size;
+        }
+        if (tensor->get_shape() != expected)
+        {
+            stringstream ss;
+            ss << kind << " " << index << " shape {" << join(tensor->get_shape())
+               << "} does not match {" << join(expected) << "} for a batch of " << batch_size;
+            throw runtime_error(ss.str());
+        }
+    };
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        check("Input", i, inputs[i], m_batched_parameters[i], params[i]->get_shape());
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        check("Output", i, outputs[i], true, m_function->get_output_shape(i));
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    size_t step = get_batch_size_for(batch_size);
+    if (step == batch_size)
+    {
+        m_backend->call(get_specialization(step).function, outputs, inputs);
+        return;
+    }
+
+    auto row_bytes = [](const shared_ptr<TensorView>& tensor) {
+        const Shape& shape = tensor->get_shape();
+        return tensor->get_element_count() / shape[0] *
+               tensor->get_tensor().get_element_type().size();
+    };
+
+    for (size_t row = 0; row < batch_size; row += step)
+    {
+        step = get_batch_size_for(batch_size - row);
+        Specialization& part = get_specialization(step);
+
+        vector<shared_ptr<TensorView>> part_inputs;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            if (!m_batched_parameters[i])
+            {
+                part_inputs.push_back(inputs[i]);
+                continue;
+            }
+            size_t bytes = row_bytes(inputs[i]);
+            m_row_buffer.resize(max(m_row_buffer.size(), bytes * step));
+            inputs[i]->read(m_row_buffer.data(), bytes * row, bytes * step);
+            part.inputs[i]->write(m_row_buffer.data(), 0, bytes * step);
+            part_inputs.push_back(part.inputs[i]);
+        }
+
+        m_backend->call(part.function, part.outputs, part_inputs);
+
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            size_t bytes = row_bytes(outputs[i]);
+            m_row_buffer.resize(max(m_row_buffer.size(), bytes * step));
+            part.outputs[i]->read(m_row_buffer.data(), 0, bytes * step);
+            outputs[i]->write(m_row_buffer.data(), bytes * row, bytes * step);
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Runs a Function on any batch size up to max_batch by compiling one copy of it
+        /// per power-of-two bucket.
+        ///
+        /// The function is built with max_batch as the leading dimension of its batched
+        /// parameters. The buckets are max_batch and the powers of two below it, so there are
+        /// at most floor(log2(max_batch)) + 1. Each bucket is a separate compiled function with
+        /// its own memory plan, compiled the first time a batch needs it.
+        ///
+        /// call() accepts batches of 1 to max_batch rows. A batch that matches a bucket runs
+        /// on the caller's tensors. Any other batch is split into bucket-sized runs, largest
+        /// first, and the rows of each run are copied into and out of staging tensors owned by
+        /// its bucket. No padding rows are computed.
+        ///
+        /// Splitting is only valid if each row of the results depends on the same row of the
+        /// batched inputs alone. The constructor checks this and throws ngraph_error naming the
+        /// first op that mixes rows, such as a reduction or softmax over the batch axis.
+        class BucketedBatchFunction
+        {
+        public:
+            /// \param batched_parameters Indices of the parameters whose leading dimension is
+            ///   the batch. If empty, every parameter whose leading dimension is max_batch.
+            BucketedBatchFunction(const std::shared_ptr<Backend>& backend,
+                                  const std::shared_ptr<Function>& function,
+                                  size_t max_batch,
+                                  const std::vector<size_t>& batched_parameters = {});
+
+            size_t get_max_batch() const { return m_max_batch; }
+            /// \brief The function specialized to a batch of batch_size rows, which must be
+            ///   max_batch or a power of two below it.
+            std::shared_ptr<Function> get_function(size_t batch_size);
+            /// \brief The largest batch size with a specialization that fits in rows rows.
+            size_t get_batch_size_for(size_t rows) const;
+            /// \brief Batch sizes that have been compiled so far, in increasing order.
+            std::vector<size_t> get_compiled_batch_sizes() const;
+
+            /// \brief Execute the function on a batch of any size up to max_batch.
+            ///
+            /// Calls are serialized; the specializations share staging tensors.
+            void call(const std::vector<std::shared_ptr<TensorView>>& outputs,
+                      const std::vector<std::shared_ptr<TensorView>>& inputs);
+
+        private:
+            struct Specialization
+            {
+                std::shared_ptr<Function> function;
+                std::vector<std::shared_ptr<TensorView>> inputs;
+                std::vector<std::shared_ptr<TensorView>> outputs;
+            };
+
+            void analyze();
+            std::shared_ptr<Function> specialize(size_t batch_size) const;
+            Specialization& get_specialization(size_t batch_size);
+
+            std::shared_ptr<Backend> m_backend;
+            std::shared_ptr<Function> m_function;
+            size_t m_max_batch;
+            std::vector<bool> m_batched_parameters;
+            std::set<const Node*> m_batched_nodes;
+            std::map<size_t, Specialization> m_specializations;
+            std::vector<char> m_row_buffer;
+            mutable std::mutex m_mutex;
+        };
+    }
+}
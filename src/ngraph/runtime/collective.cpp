@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+
+#ifdef NGRAPH_DISTRIBUTED
+#include <mpi.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/collective.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef NGRAPH_DISTRIBUTED
+namespace
+{
+    class MPICollective : public runtime::Collective
+    {
+    public:
+        size_t get_rank() const override
+        {
+            int rank;
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            return rank;
+        }
+
+        size_t get_size() const override
+        {
+            int size;
+            MPI_Comm_size(MPI_COMM_WORLD, &size);
+            return size;
+        }
+
+    protected:
+        void do_allreduce(void* data, size_t count, const element::Type& element_type) override
+        {
+            MPI_Datatype data_type;
+            if (element_type == element::f32)
+            {
+                data_type = MPI_FLOAT;
+            }
+            else if (element_type == element::f64)
+            {
+                data_type = MPI_DOUBLE;
+            }
+            else
+            {
+                throw ngraph_error("Unsupported data type for MPI AllReduce");
+            }
+            MPI_Allreduce(
+                MPI_IN_PLACE, data, static_cast<int>(count), data_type, MPI_SUM, MPI_COMM_WORLD);
+        }
+    };
+}
+#endif
+
+void runtime::Collective::allreduce(void* data, size_t count, const element::Type& element_type)
+{
+    lock_guard<mutex> lock(m_mutex);
+    do_allreduce(data, count, element_type);
+}
+
+static mutex s_collective_mutex;
+static shared_ptr<runtime::Collective> s_collective;
+
+void runtime::set_collective(shared_ptr<Collective> collective)
+{
+    lock_guard<mutex> lock(s_collective_mutex);
+    s_collective = collective;
+}
+
+shared_ptr<runtime::Collective> runtime::get_collective()
+{
+    lock_guard<mutex> lock(s_collective_mutex);
+    if (!s_collective)
+    {
+#ifdef NGRAPH_DISTRIBUTED
+        s_collective = make_shared<MPICollective>();
+#else
+        throw ngraph_error("AllReduce needs a collective; see runtime::set_collective");
+#endif
+    }
+    return s_collective;
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Collective;
+
+        /// @brief Sets the collective that op::AllReduce runs on in the INTERPRETER backend.
+        void set_collective(std::shared_ptr<Collective> collective);
+
+        /// @brief The collective set by set_collective. Without one, MPI_COMM_WORLD when built
+        /// with NGRAPH_DISTRIBUTED, otherwise an error.
+        std::shared_ptr<Collective> get_collective();
+    }
+}
+
+/// @brief Sums buffers across the processes of a data-parallel job.
+///
+/// Every process must make the same calls in the same order. Calls from several threads of one
+/// process, such as concurrent Backend::call's, run one at a time.
+class ngraph::runtime::Collective
+{
+public:
+    virtual ~Collective() {}
+    virtual size_t get_rank() const = 0;
+    virtual size_t get_size() const = 0;
+
+    /// @brief Replaces the count elements at data with their sum over all processes.
+    void allreduce(void* data, size_t count, const element::Type& element_type);
+
+protected:
+    /// @brief Implements allreduce, which only calls it once any earlier call has finished.
+    virtual void do_allreduce(void* data, size_t count, const element::Type& element_type) = 0;
+
+private:
+    std::mutex m_mutex;
+};
@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/compiled_function_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::FunctionSignature runtime::get_function_signature(const shared_ptr<Function>& func)
+{
+    FunctionSignature signature;
+    signature.structure = get_structural_signature(func);
+    if (signature.structure.empty())
+    {
+        return signature;
+    }
+    traverse_functions(func, [&](shared_ptr<Function> f) {
+        for (shared_ptr<Node> node : topological_sort(f->get_ops()))
+        {
+            if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+            {
+                signature.constants.push_back(constant);
+            }
+        }
+    });
+    return signature;
+}
+
+bool runtime::constants_equal(const vector<shared_ptr<op::Constant>>& a,
+                              const vector<shared_ptr<op::Constant>>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        size_t size = shape_size(a[i]->get_shape()) * a[i]->get_element_type().size();
+        if (a[i]->get_shape() != b[i]->get_shape() ||
+            a[i]->get_element_type() != b[i]->get_element_type() ||
+            memcmp(a[i]->get_data_ptr(), b[i]->get_data_ptr(), size) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/serializer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief What makes two functions interchangeable once compiled.
+        struct FunctionSignature
+        {
+            /// get_structural_signature of the function; empty if it cannot be shared.
+            std::string structure;
+            /// The constants of the function and of those it calls, in the order the
+            /// structure describes them.
+            std::vector<std::shared_ptr<op::Constant>> constants;
+        };
+
+        /// \brief Take func's signature. Do this before compiling, since backends may rewrite
+        ///   the graph.
+        FunctionSignature get_function_signature(const std::shared_ptr<Function>& func);
+
+        /// \brief True if the constants hold the same bytes, pairwise.
+        bool constants_equal(const std::vector<std::shared_ptr<op::Constant>>& a,
+                             const std::vector<std::shared_ptr<op::Constant>>& b);
+
+        /// \brief Compiled artifacts keyed by the structure of the Function they came from,
+        ///   so a backend compiles structurally identical functions once.
+        ///
+        /// Artifacts are held weakly; an entry lives as long as some function still uses it.
+        /// A structure match is confirmed by comparing constant data byte for byte, so a
+        /// digest collision can never hand out the wrong artifact. Not thread safe.
+        template <typename Artifact>
+        class CompiledFunctionCache
+        {
+        public:
+            /// \brief The artifact of a function with this signature, or nullptr.
+            std::shared_ptr<Artifact> find(const FunctionSignature& signature)
+            {
+                if (signature.structure.empty())
+                {
+                    return nullptr;
+                }
+                auto range = m_entries.equal_range(signature.structure);
+                for (auto it = range.first; it != range.second;)
+                {
+                    std::shared_ptr<Artifact> artifact = it->second.artifact.lock();
+                    if (artifact == nullptr)
+                    {
+                        it = m_entries.erase(it);
+                    }
+                    else if (constants_equal(signature.constants, it->second.constants))
+                    {
+                        return artifact;
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                return nullptr;
+            }
+
+            /// \brief Record the artifact compiled from a function with this signature.
+            void insert(const FunctionSignature& signature,
+                        const std::shared_ptr<Artifact>& artifact)
+            {
+                if (!signature.structure.empty())
+                {
+                    m_entries.insert(
+                        {signature.structure, Entry{artifact, signature.constants}});
+                }
+            }
+
+            size_t size() const { return m_entries.size(); }
+        private:
+            struct Entry
+            {
+                std::weak_ptr<Artifact> artifact;
+                std::vector<std::shared_ptr<op::Constant>> constants;
+            };
+
+            std::multimap<std::string, Entry> m_entries;
+        };
+    }
+}
@@ -19,6 +19,7 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -52,13 +53,32 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
 
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function == nullptr)
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-        instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        // Timers are compiled into the function, so only functions without performance
+        // data are shared; otherwise their counts would mix.
+        FunctionSignature signature;
+        if (!instance.m_performance_counters_enabled)
+        {
+            signature = get_function_signature(func);
+            instance.m_external_function = m_compiled_function_cache.find(signature);
+        }
+        if (instance.m_external_function == nullptr)
+        {
+            instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
+            instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
+            instance.m_external_function->m_emit_hardware_counters =
+                instance.m_hardware_counters_enabled;
+            auto cf = instance.m_external_function->make_call_frame();
+            instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+            m_compiled_function_cache.insert(signature, instance.m_external_function);
+        }
+        else
+        {
+            instance.m_call_frame = instance.m_external_function->make_call_frame();
+        }
     }
     return true;
 }
@@ -67,28 +87,51 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
                                      const vector<shared_ptr<runtime::TensorView>>& outputs,
                                      const vector<shared_ptr<runtime::TensorView>>& inputs)
 {
-    bool rc = true;
-
     validate_call(func, outputs, inputs);
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    bool rc = compile(func);
+    shared_ptr<CPU_ExternalFunction> external_function;
+    shared_ptr<CPU_CallFrame> call_frame;
     {
-        rc = compile(func);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        external_function = instance.m_external_function;
+        call_frame = instance.m_call_frame;
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    if (external_function->get_mkldnn_emitter()->get_mkldnn_primitives().empty())
+    {
+        call_frame->call(outputs, inputs);
+    }
+    else
+    {
+        lock_guard<mutex> lock(external_function->get_primitive_mutex());
+        call_frame->call(outputs, inputs);
+    }
 
     return rc;
 }
 
+future<bool>
+    runtime::cpu::CPU_Backend::async_call(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    compile(func);
+    return m_executor.submit(func.get(), [this, func, outputs, inputs]() {
+        return call(func, outputs, inputs);
+    });
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function != nullptr)
     {
@@ -97,10 +140,26 @@ void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> fun
     instance.m_performance_counters_enabled = enable;
 }
 
+void runtime::cpu::CPU_Backend::enable_hardware_counters(shared_ptr<Function> func, bool enable)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Hardware counters must be enabled prior to compiling.");
+    }
+    instance.m_hardware_counters_enabled = enable;
+    if (enable)
+    {
+        instance.m_performance_counters_enabled = true;
+    }
+}
+
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<mutex> lock(m_function_map_mutex);
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
     {
@@ -116,6 +175,9 @@ vector<runtime::PerformanceCounter>
                     engine->find_function<size_t(size_t)>("get_debug_timer_microseconds");
                 auto get_call_count =
                     engine->find_function<size_t(size_t)>("get_debug_timer_call_count");
+                auto get_hardware_counters =
+                    engine->find_function<void(size_t, uint64_t*)>("get_debug_hardware_counters");
+                const auto& op_costs = instance.m_external_function->get_op_costs();
 
                 if (get_count && get_name && get_microseconds && get_call_count)
                 {
@@ -123,6 +185,21 @@ vector<runtime::PerformanceCounter>
                     for (size_t i = 0; i < count; i++)
                     {
                         rc.push_back({get_name(i), get_microseconds(i), get_call_count(i)});
+                        auto cost = op_costs.find(rc.back().name());
+                        if (cost != op_costs.end())
+                        {
+                            rc.back().set_op_cost(cost->second);
+                        }
+                        if (get_hardware_counters)
+                        {
+                            uint64_t values[3];
+                            get_hardware_counters(i, values);
+                            HardwareCounterValues counters;
+                            counters.cycles = values[0];
+                            counters.instructions = values[1];
+                            counters.llc_misses = values[2];
+                            rc.back().set_hardware_counters(counters);
+                        }
                     }
                 }
             }
@@ -130,3 +207,13 @@ vector<runtime::PerformanceCounter>
     }
     return rc;
 }
+
+void runtime::cpu::CPU_Backend::enable_tracing(bool enable)
+{
+    set_tracing_enabled(enable);
+}
+
+void runtime::cpu::CPU_Backend::write_trace(const string& file_name)
+{
+    runtime::cpu::write_trace(file_name);
+}
@@ -18,8 +18,11 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
+#include "ngraph/runtime/async_executor.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/compiled_function_cache.hpp"
 
 namespace ngraph
 {
@@ -51,10 +54,19 @@ namespace ngraph
                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) override;
 
+                std::future<bool> async_call(
+                    std::shared_ptr<Function> func,
+                    const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) override;
+
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
+                void enable_hardware_counters(std::shared_ptr<Function> func,
+                                              bool enable) override;
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
+                void enable_tracing(bool enable) override;
+                void write_trace(const std::string& file_name) override;
 
             private:
                 class FunctionInstance
@@ -63,10 +75,20 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    bool m_hardware_counters_enabled = false;
                 };
 
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                mutable std::mutex m_function_map_mutex;
+                // Functions with the same structure and constants share one compiled function
+                // and its constants; each keeps its own call frame and temporary memory.
+                CompiledFunctionCache<CPU_ExternalFunction> m_compiled_function_cache;
                 static bool init;
+
+                // Each call already spreads its ops over the Eigen pool, so two workers are
+                // enough to overlap one call with the next. Declared last so queued calls
+                // finish before the function map is destroyed.
+                AsyncExecutor m_executor{2};
             };
         }
     }
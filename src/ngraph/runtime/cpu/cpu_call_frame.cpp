@@ -35,6 +35,13 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
+    // NGRAPH_CPU_TRACING enables tracing from startup and keeps the old behaviour of leaving a
+    // timeline next to each function.
+    if (std::getenv("NGRAPH_CPU_TRACING") != nullptr)
+    {
+        write_trace(m_external_function->get_function_name() + ".timeline.json",
+                    m_external_function->get_trace_function());
+    }
     cleanup_runtime_context();
 }
 
@@ -63,14 +70,8 @@ void runtime::cpu::CPU_CallFrame::call(
     }
 
     // Invoke compiled computation
+    ctx->tracing = is_tracing_enabled();
     m_compiled_function(inputs.data(), outputs.data(), ctx);
-
-    if (runtime::cpu::IsTracingEnabled())
-    {
-        GenerateTimeline(m_external_function->get_op_attrs(),
-                         ctx->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
-    }
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -97,12 +98,12 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 {
     ctx = new CPURuntimeContext;
 
-    ctx->op_durations = nullptr;
-    if (runtime::cpu::IsTracingEnabled())
-    {
-        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
-    }
+    ctx->tracing = false;
+    ctx->trace_function = m_external_function->get_trace_function();
     ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    ctx->init = new bool[m_external_function->get_init_flag_count()];
+    std::fill(ctx->init, ctx->init + m_external_function->get_init_flag_count(), true);
+    ctx->t_en = new bool[m_external_function->get_tensor_enable_count()]();
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
@@ -117,8 +118,9 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
-    delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->init;
+    delete[] ctx->t_en;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
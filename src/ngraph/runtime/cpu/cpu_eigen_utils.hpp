@@ -20,6 +20,31 @@
 
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace Eigen
+{
+    // The 16 bit float types convert implicitly to float, so Eigen expressions over them
+    // load 16 bits, compute in float and round on store.
+    template <>
+    struct NumTraits<ngraph::bfloat16> : GenericNumTraits<ngraph::bfloat16>
+    {
+        enum
+        {
+            RequireInitialization = false
+        };
+    };
+
+    template <>
+    struct NumTraits<ngraph::float16> : GenericNumTraits<ngraph::float16>
+    {
+        enum
+        {
+            RequireInitialization = false
+        };
+    };
+}
 
 namespace ngraph
 {
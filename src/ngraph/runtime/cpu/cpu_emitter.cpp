@@ -26,6 +26,7 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/add_n.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/asin.hpp"
@@ -42,6 +43,7 @@
 #include "ngraph/op/cosh.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
@@ -84,6 +86,7 @@
 #include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -97,6 +100,7 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
@@ -128,6 +132,78 @@ static string eigen_matrix_format(const ngraph::Shape& shape, const ngraph::Stri
     return ss.str();
 }
 
+// bf16 and f16 are load/store types; kernels that accumulate must do so in float
+static bool is_16bit_real(const element::Type& type)
+{
+    return type == element::bf16 || type == element::f16;
+}
+
+// The element types kernel/reduce.cpp instantiates the parallel reductions for
+static bool is_parallel_reduction_type(const element::Type& type)
+{
+    return type != element::boolean && !is_16bit_real(type);
+}
+
+static void emit_parallel_reduction(codegen::CodeWriter& writer,
+                                    const std::string& kernel,
+                                    const runtime::cpu::TensorViewWrapper& arg,
+                                    const runtime::cpu::TensorViewWrapper& out,
+                                    const AxisSet& reduction_axes)
+{
+    writer << "cpu::kernel::" << kernel << "<" << out.get_type() << ">(" << arg.get_name() << ", "
+           << out.get_name() << ", {" << join(arg.get_shape()) << "}, {" << join(reduction_axes)
+           << "});\n";
+}
+
+// If an input of the binary elementwise op is a Broadcast folded by CPUBroadcastFolding, emit
+// the op reading that input at stride 0 and return true
+static bool emit_folded_broadcast_elementwise(
+    codegen::CodeWriter& writer,
+    const ngraph::Node* node,
+    const std::vector<runtime::cpu::TensorViewWrapper>& args,
+    const std::vector<runtime::cpu::TensorViewWrapper>& out,
+    const std::string& op)
+{
+    bool folded = false;
+    std::vector<Shape> arg_shapes;
+    std::vector<AxisSet> broadcast_axes;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto broadcast = std::dynamic_pointer_cast<ngraph::op::Broadcast>(
+            node->get_inputs().at(i).get_output().get_node());
+        if (broadcast && runtime::cpu::mkldnn_utils::is_in_place(broadcast.get()))
+        {
+            folded = true;
+            arg_shapes.push_back(broadcast->get_input_shape(0));
+            broadcast_axes.push_back(broadcast->get_broadcast_axes());
+        }
+        else
+        {
+            arg_shapes.push_back(args[i].get_shape());
+            broadcast_axes.push_back(AxisSet{});
+        }
+    }
+    if (!folded)
+    {
+        return false;
+    }
+
+    writer.block_begin();
+    runtime::cpu::kernel::emit_broadcast_elementwise(writer,
+                                                     out[0].get_type(),
+                                                     op,
+                                                     args[0].get_name(),
+                                                     args[1].get_name(),
+                                                     out[0].get_name(),
+                                                     arg_shapes[0],
+                                                     arg_shapes[1],
+                                                     out[0].get_shape(),
+                                                     broadcast_axes[0],
+                                                     broadcast_axes[1]);
+    writer.block_end();
+    return true;
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -137,6 +213,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Add)
             {
+                if (emit_folded_broadcast_elementwise(writer, node, args, out, "+"))
+                {
+                    return;
+                }
                 // TODO: Audit all uses of Add and fix this to use
                 // the right alignment instead of Eigen::Unaligned
                 writer.block_begin();
@@ -203,6 +283,23 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::AddN)
+            {
+                writer.block_begin();
+                writer << "#pragma omp parallel for\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << out[0].get_name() << "[i] = " << args[0].get_name() << "[i]";
+                for (size_t i = 1; i < args.size(); i++)
+                {
+                    writer << " + " << args[i].get_name() << "[i]";
+                }
+                writer << ";\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
 #ifdef NGRAPH_DISTRIBUTED
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::AllReduce)
@@ -629,7 +726,18 @@ namespace ngraph
 
                 const Shape& arg0_shape = args[0].get_shape();
                 const Shape& arg1_shape = args[1].get_shape();
-                if (arg0_shape.empty() || arg1_shape.empty())
+                if (is_16bit_real(args[0].get_element_type()))
+                {
+                    writer << "reference::dot<" << args[0].get_type() << ", float>("
+                           << args[0].get_name() << ",\n";
+                    writer << "            " << args[1].get_name() << ",\n";
+                    writer << "            " << out[0].get_name() << ",\n";
+                    writer << "            {" << join(args[0].get_shape()) << "},\n";
+                    writer << "            {" << join(args[1].get_shape()) << "},\n";
+                    writer << "            {" << join(out[0].get_shape()) << "},\n";
+                    writer << "            " << dot->get_reduction_axes_count() << ");\n";
+                }
+                else if (arg0_shape.empty() || arg1_shape.empty())
                 {
                     auto& first = (arg0_shape.empty() ? args[0] : args[1]);
                     auto& second = (arg0_shape.empty() ? args[1] : args[0]);
@@ -700,6 +808,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Multiply)
             {
+                if (emit_folded_broadcast_elementwise(writer, node, args, out, "*"))
+                {
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 writer << emit_array1d(out[0]) << " =\n"
@@ -754,6 +866,12 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Concat)
             {
+                if (runtime::cpu::mkldnn_utils::is_in_place(node))
+                {
+                    writer << "// Concat computed in place by its producers\n";
+                    return;
+                }
+
                 auto result_shape = out[0].get_shape();
 
 #if USE_EIGEN_CORE_INLINE == 1
@@ -911,6 +1029,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Divide)
             {
+                if (emit_folded_broadcast_elementwise(writer, node, args, out, "/"))
+                {
+                    return;
+                }
                 writer.block_begin();
                 if (node->get_element_type().is_real() == false)
                 {
@@ -1148,6 +1270,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Subtract)
             {
+                if (emit_folded_broadcast_elementwise(writer, node, args, out, "-"))
+                {
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 writer << emit_array1d(out[0]) << " =\n"
@@ -1167,6 +1293,12 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Broadcast)
             {
+                if (runtime::cpu::mkldnn_utils::is_in_place(node))
+                {
+                    writer << "// Broadcast folded into its consumers\n";
+                    return;
+                }
+
                 auto broadcast = static_cast<const ngraph::op::Broadcast*>(node);
 
                 writer.block_begin();
@@ -1289,6 +1421,12 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Reshape)
             {
+                if (runtime::cpu::mkldnn_utils::is_in_place(node))
+                {
+                    writer << "// Reshape output aliases its input\n";
+                    return;
+                }
+
                 auto reshape = static_cast<const ngraph::op::Reshape*>(node);
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
@@ -1353,25 +1491,13 @@ namespace ngraph
                     writer << "               );\n";
                 }
 #else
-                if (args[0].get_element_type() == element::f32 && args[0].get_shape().size() == 3 &&
-                    out[0].get_shape().size() == 3)
-                {
-                    writer << "cpu::kernel::reshape_3d_3d_float32(" << args[0].get_name() << ", "
-                           << out[0].get_name() << ", "
-                           << "{" << join(args[0].get_shape()) << "}, "
-                           << "{" << join(reshape->get_input_order()) << "}, "
-                           << "{" << join(out[0].get_shape()) << "}"
-                           << ");\n";
-                }
-                else if (args[0].get_element_type() == element::f32 &&
-                         args[0].get_shape().size() == 4 && out[0].get_shape().size() == 4)
+                auto input_order = reshape->get_input_order();
+                if (!is_sorted(input_order.begin(), input_order.end()))
                 {
-                    writer << "cpu::kernel::reshape_4d_4d_float32(" << args[0].get_name() << ", "
-                           << out[0].get_name() << ", "
-                           << "{" << join(args[0].get_shape()) << "}, "
-                           << "{" << join(reshape->get_input_order()) << "}, "
-                           << "{" << join(out[0].get_shape()) << "}"
-                           << ");\n";
+                    writer << "cpu::kernel::transpose(" << args[0].get_name() << ", "
+                           << out[0].get_name() << ", " << args[0].get_element_type().size()
+                           << ", {" << join(args[0].get_shape()) << "}, {" << join(input_order)
+                           << "});\n";
                 }
                 else
                 {
@@ -1381,7 +1507,7 @@ namespace ngraph
                                          out[0].get_name(),
                                          args[0].get_shape(),
                                          out[0].get_shape(),
-                                         reshape->get_input_order());
+                                         input_order);
                 }
 #endif
                 writer.block_end();
@@ -1641,6 +1767,12 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Slice)
             {
+                if (runtime::cpu::mkldnn_utils::is_in_place(node))
+                {
+                    writer << "// Slice output aliases its input\n";
+                    return;
+                }
+
                 const ngraph::op::Slice* slice = static_cast<const ngraph::op::Slice*>(node);
 
                 writer.block_begin();
@@ -1768,8 +1900,18 @@ namespace ngraph
                            << "});\n";
                 }
 #else
-                if (args[0].get_element_type() == element::f32 && args[0].get_shape().size() == 1 &&
-                    sum->get_reduction_axes().size() == 1)
+                if (is_16bit_real(args[0].get_element_type()))
+                {
+                    writer << "reference::sum<" << out[0].get_type() << ", float>("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(out[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(sum->get_reduction_axes())
+                           << "});\n";
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         args[0].get_shape().size() == 1 && sum->get_reduction_axes().size() == 1)
                 {
                     writer << "cpu::kernel::reduce_sum_all_1d_float32(" << args[0].get_name()
                            << ", " << out[0].get_name() << ", "
@@ -1805,6 +1947,11 @@ namespace ngraph
                            << "{" << join(out[0].get_shape()) << "}"
                            << ");\n";
                 }
+                else if (is_parallel_reduction_type(args[0].get_element_type()))
+                {
+                    emit_parallel_reduction(
+                        writer, "parallel_reduce_sum", args[0], out[0], sum->get_reduction_axes());
+                }
                 else
                 {
                     kernel::emit_sum(writer,
@@ -2179,6 +2326,81 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingLookup)
+            {
+                const Shape& table_shape = args[1].get_shape();
+                size_t indices_count = args[0].get_size();
+                size_t row_size = shape_size(Shape(table_shape.begin() + 1, table_shape.end()));
+
+                // Indices are checked serially since exceptions cannot leave the parallel loop
+                writer.block_begin();
+                writer << "std::vector<size_t> rows(" << indices_count << ");\n";
+                writer << "for (size_t i = 0; i < " << indices_count << "; i++)\n";
+                writer.block_begin();
+                writer << "rows[i] = reference::embedding_row(" << args[0].get_name() << "[i], "
+                       << table_shape.at(0) << ");\n";
+                writer.block_end();
+                writer << "#pragma omp parallel for\n";
+                writer << "for (size_t i = 0; i < " << indices_count << "; i++)\n";
+                writer.block_begin();
+                writer << "memcpy(" << out[0].get_name() << " + i * " << row_size << ", "
+                       << args[1].get_name() << " + rows[i] * " << row_size << ", "
+                       << row_size * out[0].get_element_type().size() << ");\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingLookupBackprop)
+            {
+                auto backprop = static_cast<const ngraph::op::EmbeddingLookupBackprop*>(node);
+                const Shape& table_shape = backprop->get_table_shape();
+                size_t indices_count = args[0].get_size();
+                size_t rows = table_shape.at(0);
+                size_t row_size = shape_size(Shape(table_shape.begin() + 1, table_shape.end()));
+
+                // The deltas are grouped by the row they update, keeping their order, so each
+                // thread owns whole rows of the output and sums them as the reference does.
+                writer.block_begin();
+                writer << "std::vector<size_t> starts(" << rows + 1 << ", 0);\n";
+                writer << "std::vector<size_t> rows(" << indices_count << ");\n";
+                writer << "for (size_t i = 0; i < " << indices_count << "; i++)\n";
+                writer.block_begin();
+                writer << "rows[i] = reference::embedding_row(" << args[0].get_name() << "[i], "
+                       << rows << ");\n";
+                writer << "starts[rows[i] + 1]++;\n";
+                writer.block_end();
+                writer << "for (size_t r = 0; r < " << rows << "; r++)\n";
+                writer.block_begin();
+                writer << "starts[r + 1] += starts[r];\n";
+                writer.block_end();
+                writer << "std::vector<size_t> next(starts.begin(), starts.end() - 1);\n";
+                writer << "std::vector<size_t> order(" << indices_count << ");\n";
+                writer << "for (size_t i = 0; i < " << indices_count << "; i++)\n";
+                writer.block_begin();
+                writer << "order[next[rows[i]]++] = i;\n";
+                writer.block_end();
+
+                writer << "#pragma omp parallel for\n";
+                writer << "for (size_t r = 0; r < " << rows << "; r++)\n";
+                writer.block_begin();
+                writer << out[0].get_type() << "* row_out = " << out[0].get_name() << " + r * "
+                       << row_size << ";\n";
+                writer << "std::fill(row_out, row_out + " << row_size << ", 0);\n";
+                writer << "for (size_t k = starts[r]; k < starts[r + 1]; k++)\n";
+                writer.block_begin();
+                writer << "const " << out[0].get_type() << "* delta = " << args[1].get_name()
+                       << " + order[k] * " << row_size << ";\n";
+                writer << "for (size_t j = 0; j < " << row_size << "; j++)\n";
+                writer.block_begin();
+                writer << "row_out[j] += delta[j];\n";
+                writer.block_end();
+                writer.block_end();
+                writer.block_end();
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Ceiling)
             {
@@ -3329,14 +3551,24 @@ namespace ngraph
                            << "});\n";
                 }
 #else
-                // TODO: add an emitter akin to the emit_sum
-                writer << "reference::product<" << out[0].get_type() << ">(" << args[0].get_name()
-                       << ",\n";
-                writer << "                         " << out[0].get_name() << ",\n";
-                writer << "                         {" << join(args[0].get_shape()) << "},\n";
-                writer << "                         {" << join(out[0].get_shape()) << "},\n";
-                writer << "                         {" << join(product->get_reduction_axes())
-                       << "});\n";
+                if (is_parallel_reduction_type(args[0].get_element_type()))
+                {
+                    emit_parallel_reduction(writer,
+                                            "parallel_reduce_product",
+                                            args[0],
+                                            out[0],
+                                            product->get_reduction_axes());
+                }
+                else
+                {
+                    writer << "reference::product<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(out[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(product->get_reduction_axes())
+                           << "});\n";
+                }
 #endif
                 writer.block_end();
             }
@@ -3409,6 +3641,11 @@ namespace ngraph
                            << "{" << join(max->get_reduction_axes()) << "}"
                            << ");\n";
                 }
+                else if (is_parallel_reduction_type(args[0].get_element_type()))
+                {
+                    emit_parallel_reduction(
+                        writer, "parallel_reduce_max", args[0], out[0], max->get_reduction_axes());
+                }
                 else
                 {
                     writer << "reference::max<" << out[0].get_type() << ">(" << args[0].get_name()
@@ -3481,14 +3718,21 @@ namespace ngraph
                            << "});\n";
                 }
 #else
-                // TODO: add an emitter akin to the emit_sum
-                writer << "reference::min<" << out[0].get_type() << ">(" << args[0].get_name()
-                       << ",\n";
-                writer << "                         " << out[0].get_name() << ",\n";
-                writer << "                         {" << join(args[0].get_shape()) << "},\n";
-                writer << "                         {" << join(out[0].get_shape()) << "},\n";
-                writer << "                         {" << join(min->get_reduction_axes())
-                       << "});\n";
+                if (is_parallel_reduction_type(args[0].get_element_type()))
+                {
+                    emit_parallel_reduction(
+                        writer, "parallel_reduce_min", args[0], out[0], min->get_reduction_axes());
+                }
+                else
+                {
+                    writer << "reference::min<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(out[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(min->get_reduction_axes())
+                           << "});\n";
+                }
 #endif
                 writer.block_end();
             }
@@ -3686,6 +3930,63 @@ namespace ngraph
                        << to_string(sigmoid_index) << ");\n";
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Lstm)
+            {
+                auto lstm = static_cast<const ngraph::op::Lstm*>(node);
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Lstm is only supported for float32");
+                }
+
+                size_t batch_size = lstm->get_batch_size();
+                size_t hidden_size = lstm->get_hidden_size();
+                string gates = args[0].get_name();
+                string cell_state = args[1].get_name();
+                if (lstm->has_recurrent_weights())
+                {
+                    // One GEMM adds h_{t-1} W^T to a copy of the given gates in output 2
+                    gates = out[2].get_name();
+                    cell_state = args[3].get_name();
+                    writer << "memcpy(" << gates << ", " << args[0].get_name() << ", "
+                           << out[2].get_size() * out[2].get_element_type().size() << ");\n";
+                    writer << "cblas::cblas_sgemm(cblas::Layout::RowMajor, "
+                           << "cblas::Transpose::None, cblas::Transpose::Transpose, "
+                           << batch_size << ", " << 4 * hidden_size << ", " << hidden_size
+                           << ",\n"
+                           << "        1.0f, " << args[1].get_name() << ", " << hidden_size
+                           << ", " << args[2].get_name() << ", " << hidden_size << ", 1.0f,\n"
+                           << "        " << gates << ", " << 4 * hidden_size << ");\n";
+                }
+
+                writer << "cpu::kernel::lstm_float32(" << gates << ",\n"
+                       << "                          " << cell_state << ",\n"
+                       << "                          " << out[0].get_name() << ",\n"
+                       << "                          " << out[1].get_name() << ",\n"
+                       << "                          " << batch_size << ",\n"
+                       << "                          " << hidden_size << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::LstmBackprop)
+            {
+                auto lstm = static_cast<const ngraph::op::LstmBackprop*>(node);
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("LstmBackprop is only supported for float32");
+                }
+
+                writer << "cpu::kernel::lstm_backprop_float32(" << args[0].get_name() << ",\n"
+                       << "                                   " << args[1].get_name() << ",\n"
+                       << "                                   " << args[2].get_name() << ",\n"
+                       << "                                   " << args[3].get_name() << ",\n"
+                       << "                                   " << out[0].get_name() << ",\n"
+                       << "                                   " << out[1].get_name() << ",\n"
+                       << "                                   " << lstm->get_batch_size() << ",\n"
+                       << "                                   " << lstm->get_hidden_size()
+                       << ");\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Softmax)
             {
@@ -3696,6 +3997,18 @@ namespace ngraph
                 auto dims = out[0].get_shape().size();
                 auto axes = softmax->get_axes();
 
+                // Adjacent axes: one parallel task per [axes, trailing axes] slab
+                auto& element_type = out[0].get_element_type();
+                if ((element_type == element::f32 || element_type == element::f64) &&
+                    !axes.empty() && *axes.rbegin() - *axes.begin() + 1 == axes.size())
+                {
+                    writer << "cpu::kernel::parallel_softmax<" << type << ">("
+                           << args[0].get_name() << ", " << out[0].get_name() << ", {"
+                           << join(shape) << "}, {" << join(axes) << "});\n";
+                    writer.block_end();
+                    return;
+                }
+
                 // create arg/out if 1d
                 if (dims < 1)
                 {
@@ -3871,6 +4184,60 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::SoftmaxCrossEntropy)
+            {
+                auto loss = static_cast<const ngraph::op::SoftmaxCrossEntropy*>(node);
+                if (args[0].get_element_type() == element::f32)
+                {
+                    size_t rows = out[0].get_size();
+                    size_t class_count = rows == 0 ? 0 : args[0].get_size() / rows;
+                    writer << "cpu::kernel::softmax_cross_entropy_float32("
+                           << args[0].get_name() << ",\n";
+                    writer << "                   " << args[1].get_name() << ",\n";
+                    writer << "                   " << out[0].get_name() << ",\n";
+                    writer << "                   " << rows << ",\n";
+                    writer << "                   " << class_count << ");\n";
+                }
+                else
+                {
+                    writer << "reference::softmax_cross_entropy<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                   " << args[1].get_name() << ",\n";
+                    writer << "                   " << out[0].get_name() << ",\n";
+                    writer << "                   {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                   {" << join(loss->get_axes()) << "});\n";
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::SoftmaxCrossEntropyBackprop)
+            {
+                auto backprop = static_cast<const ngraph::op::SoftmaxCrossEntropyBackprop*>(node);
+                if (args[0].get_element_type() == element::f32)
+                {
+                    size_t rows = args[2].get_size();
+                    size_t class_count = rows == 0 ? 0 : args[0].get_size() / rows;
+                    writer << "cpu::kernel::softmax_cross_entropy_backprop_float32("
+                           << args[0].get_name() << ",\n";
+                    writer << "                   " << args[1].get_name() << ",\n";
+                    writer << "                   " << args[2].get_name() << ",\n";
+                    writer << "                   " << out[0].get_name() << ",\n";
+                    writer << "                   " << rows << ",\n";
+                    writer << "                   " << class_count << ");\n";
+                }
+                else
+                {
+                    writer << "reference::softmax_cross_entropy_backprop<" << out[0].get_type()
+                           << ">(" << args[0].get_name() << ",\n";
+                    writer << "                   " << args[1].get_name() << ",\n";
+                    writer << "                   " << args[2].get_name() << ",\n";
+                    writer << "                   " << out[0].get_name() << ",\n";
+                    writer << "                   {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                   {" << join(backprop->get_axes()) << "});\n";
+                }
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Result)
             {
@@ -36,6 +36,7 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/add_n.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/asin.hpp"
@@ -52,6 +53,7 @@
 #include "ngraph/op/cosh.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
@@ -94,6 +96,7 @@
 #include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -108,6 +111,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/reduce_lowering.hpp"
 #include "ngraph/pass/result_copy_elimination.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
@@ -120,12 +124,15 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_broadcast_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_shuffle_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
@@ -198,6 +205,7 @@ static StaticInitializers s_static_initializers;
 
 static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Add), &runtime::cpu::CPU_Emitter::emit<op::Add>},
+    {TI(ngraph::op::AddN), &runtime::cpu::CPU_Emitter::emit<op::AddN>},
 #ifdef NGRAPH_DISTRIBUTED
     {TI(ngraph::op::AllReduce), &runtime::cpu::CPU_Emitter::emit<op::AllReduce>},
 #endif
@@ -243,6 +251,9 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Atan), &runtime::cpu::CPU_Emitter::emit<op::Atan>},
     {TI(ngraph::op::ReplaceSlice), &runtime::cpu::CPU_Emitter::emit<op::ReplaceSlice>},
     {TI(ngraph::op::OneHot), &runtime::cpu::CPU_Emitter::emit<op::OneHot>},
+    {TI(ngraph::op::EmbeddingLookup), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookup>},
+    {TI(ngraph::op::EmbeddingLookupBackprop),
+     &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookupBackprop>},
     {TI(ngraph::op::Floor), &runtime::cpu::CPU_Emitter::emit<op::Floor>},
     {TI(ngraph::op::Ceiling), &runtime::cpu::CPU_Emitter::emit<op::Ceiling>},
     {TI(ngraph::op::Sqrt), &runtime::cpu::CPU_Emitter::emit<op::Sqrt>},
@@ -284,7 +295,13 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::ReluBackprop), &runtime::cpu::CPU_Emitter::emit<op::ReluBackprop>},
     {TI(ngraph::op::Sigmoid), &runtime::cpu::CPU_Emitter::emit<op::Sigmoid>},
     {TI(ngraph::op::Softmax), &runtime::cpu::CPU_Emitter::emit<op::Softmax>},
+    {TI(ngraph::op::SoftmaxCrossEntropy),
+     &runtime::cpu::CPU_Emitter::emit<op::SoftmaxCrossEntropy>},
+    {TI(ngraph::op::SoftmaxCrossEntropyBackprop),
+     &runtime::cpu::CPU_Emitter::emit<op::SoftmaxCrossEntropyBackprop>},
     {TI(ngraph::op::SigmoidBackprop), &runtime::cpu::CPU_Emitter::emit<op::SigmoidBackprop>},
+    {TI(ngraph::op::Lstm), &runtime::cpu::CPU_Emitter::emit<op::Lstm>},
+    {TI(ngraph::op::LstmBackprop), &runtime::cpu::CPU_Emitter::emit<op::LstmBackprop>},
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
     {TI(ngraph::op::Or), &runtime::cpu::CPU_Emitter::emit<op::Or>},
 };
@@ -296,13 +313,23 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_is_compiled(false)
     , m_compiled_function(nullptr)
     , m_emit_timing(false)
+    , m_emit_hardware_counters(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_concat_bytes_eliminated(0)
+    , m_eliminated_copies(0)
+    , m_init_flag_count(0)
+    , m_tensor_enable_count(0)
     , m_function_name(function->get_name())
+    , m_trace_function(0)
 {
 }
 
 runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
 {
+    if (m_trace_function != 0)
+    {
+        unregister_traced_function(m_trace_function);
+    }
 }
 
 void runtime::cpu::CPU_ExternalFunction::compile()
@@ -316,6 +343,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 
     ngraph::pass::Manager pass_manager;
 
+    pass_manager.register_pass<ngraph::pass::ReduceLowering>();
     pass_manager.register_pass<ngraph::pass::NopElimination>();
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
@@ -328,8 +356,10 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUBroadcastFolding>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
+    pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
+        this, s_memory_pool_alignment, true);
     pass_manager.run_passes(m_function);
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
@@ -348,7 +378,9 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/cpu/cpu_eigen_utils.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/hardware_counters.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
 #include "ngraph/runtime/reference/batch_norm.hpp"
@@ -356,6 +388,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
 #include "ngraph/runtime/reference/min.hpp"
@@ -374,13 +407,18 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/softmax_cross_entropy.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph::runtime::cpu::eigen;
 using namespace ngraph::runtime;
+using ngraph::bfloat16;
+using ngraph::float16;
 
 )";
 
@@ -415,6 +453,7 @@ using namespace ngraph::runtime;
                 {
                     names.push_back(node->get_name());
                     m_name_index_map.insert({node->get_name(), index++});
+                    m_op_costs[node->get_name()] = estimate_op_cost(*node);
                 }
             }
         }
@@ -453,6 +492,21 @@ using namespace ngraph::runtime;
         writer << "return (index < " << names.size() << " ? timers[index].get_call_count() : 0);\n";
         writer.indent--;
         writer << "}\n";
+
+        if (m_emit_hardware_counters)
+        {
+            writer << "ngraph::runtime::HardwareCounterValues hardware_counters[" << names.size()
+                   << "];\n";
+            writer << "extern \"C\" void get_debug_hardware_counters(size_t index, "
+                      "uint64_t* values)\n";
+            writer << "{\n";
+            writer.indent++;
+            writer << "values[0] = hardware_counters[index].cycles;\n";
+            writer << "values[1] = hardware_counters[index].instructions;\n";
+            writer << "values[2] = hardware_counters[index].llc_misses;\n";
+            writer.indent--;
+            writer << "}\n";
+        }
         writer << "\n";
     }
 
@@ -599,8 +653,10 @@ using namespace ngraph::runtime;
             }
         }
 
-        writer << "bool " << current_function->get_name() << "_t_en[" << tensor_index << "];\n";
-        writer << "bool " << current_function->get_name() << "_init = true;\n";
+        // The control flags of this function within the call frame's ctx->init and ctx->t_en
+        size_t init_flag = m_init_flag_count++;
+        size_t tensor_enable_offset = m_tensor_enable_count;
+        m_tensor_enable_count += tensor_index;
 
         writer << "extern \"C\" void " << current_function->get_name();
         writer << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx)\n";
@@ -613,13 +669,6 @@ using namespace ngraph::runtime;
             writer << "tbb::flow::graph G;\n\n";
         }
 
-        // Execution tracing support
-        if (runtime::cpu::IsTracingEnabled() && current_function->get_name() == m_function_name)
-        {
-            writer << "cpu::Timestamp start_ts;\n"
-                   << "int profiler_count = 0;\n\n";
-        }
-
         if (temporaries_used)
         {
             writer << "size_t pool_base_ptr = (size_t) ctx->memory_buffers["
@@ -639,7 +688,7 @@ using namespace ngraph::runtime;
             }
         }
 
-        writer << "bool* t_en = (bool*)" << current_function->get_name() << "_t_en;\n";
+        writer << "bool* t_en = ctx->t_en + " << tensor_enable_offset << ";\n";
 
         // Add inputs to the variable name map
         size_t arg_index = 0;
@@ -707,6 +756,15 @@ using namespace ngraph::runtime;
             {
                 throw ngraph_error("Unhandled op during code generation : " + node->description());
             }
+            // Consumers of a folded Broadcast read its input directly
+            bool folded_broadcast = dynamic_cast<ngraph::op::Broadcast*>(node.get()) &&
+                                    runtime::cpu::mkldnn_utils::is_in_place(node.get());
+            if (folded_broadcast)
+            {
+                m_variable_name_map[node->get_output_tensor().get_name()] =
+                    m_variable_name_map[node->get_inputs().at(0).get_tensor().get_name()];
+            }
+
             vector<TensorViewWrapper> in;
             vector<string> node_input_names;
             vector<string> node_output_names;
@@ -743,10 +801,10 @@ using namespace ngraph::runtime;
                            << "(G, [&](const tbb::flow::continue_msg &msg)\n{\n";
                     writer.indent++;
                 }
-                if (runtime::cpu::IsTracingEnabled() &&
-                    current_function->get_name() == m_function_name)
+                if (current_function->get_name() == m_function_name)
                 {
-                    writer << "start_ts = cpu::Clock::now();\n";
+                    writer << "int64_t " << node->get_name()
+                           << "_trace_start = ctx->tracing ? cpu::trace_clock() : 0;\n";
                 }
             }
 
@@ -769,7 +827,7 @@ using namespace ngraph::runtime;
             // Op Control
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "if (" << current_function->get_name() << "_init ";
+                writer << "if (ctx->init[" << init_flag << "]";
                 for (const descriptor::Input& input : node->get_inputs())
                 {
                     const descriptor::Output& output = input.get_output();
@@ -811,7 +869,8 @@ using namespace ngraph::runtime;
             }
 
             //skip multi-output nodes since they would be covered by GetOutputElement
-            if (node->get_output_size() == 1 &&
+            //and folded Broadcasts since their output is never materialized
+            if (node->get_output_size() == 1 && !folded_broadcast &&
                 //skip non-FP nodes
                 (node->get_element_type() == element::f32 ||
                  node->get_element_type() == element::f64))
@@ -849,12 +908,13 @@ using namespace ngraph::runtime;
                 writer.indent--;
                 writer << "}\n";
                 emit_debug_function_exit(writer, node.get(), in, out);
-                if (runtime::cpu::IsTracingEnabled() &&
-                    current_function->get_name() == m_function_name)
+                if (current_function->get_name() == m_function_name)
                 {
-                    writer << "ctx->op_durations[profiler_count++] = "
-                           << "(std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() - "
-                              "start_ts)).count();\n";
+                    writer << "if (ctx->tracing)\n";
+                    writer << "{\n";
+                    writer << "    cpu::trace_op(ctx->trace_function, " << m_op_attrs.size() - 1
+                           << ", " << node->get_name() << "_trace_start, cpu::trace_clock());\n";
+                    writer << "}\n";
                 }
                 if (m_use_tbb)
                 {
@@ -904,7 +964,7 @@ using namespace ngraph::runtime;
                 writer << "try { G.wait_for_all(); } catch(...) { throw; }\n";
             }
         }
-        writer << current_function->get_name() << "_init = false;\n";
+        writer << "ctx->init[" << init_flag << "] = false;\n";
 
         writer.indent--;
         // End generated function
@@ -973,6 +1033,7 @@ using namespace ngraph::runtime;
     {
         throw runtime_error("could not find compiled function");
     }
+    m_trace_function = register_traced_function(m_function_name, m_op_attrs);
 
     m_is_compiled = true;
     if (m_release_function)
@@ -1013,6 +1074,11 @@ void runtime::cpu::CPU_ExternalFunction::emit_debug_function_entry(
 {
     if (m_emit_timing)
     {
+        if (m_emit_hardware_counters)
+        {
+            writer << "ngraph::runtime::HardwareCounterValues " << node->get_name()
+                   << "_counters = ngraph::runtime::HardwareCounters::read();\n";
+        }
         writer << "timers[" << m_name_index_map[node->get_name()] << "].start();\n";
     }
 }
@@ -1026,6 +1092,12 @@ void runtime::cpu::CPU_ExternalFunction::emit_debug_function_exit(
     if (m_emit_timing)
     {
         writer << "timers[" << m_name_index_map[node->get_name()] << "].stop();\n";
+        if (m_emit_hardware_counters)
+        {
+            writer << "hardware_counters[" << m_name_index_map[node->get_name()]
+                   << "] += ngraph::runtime::HardwareCounters::read() - " << node->get_name()
+                   << "_counters;\n";
+        }
     }
 }
 
@@ -19,6 +19,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -33,6 +34,7 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/op_cost.hpp"
 
 namespace ngraph
 {
@@ -83,6 +85,10 @@ namespace ngraph
                 {
                     return m_memory_buffer_sizes;
                 }
+                // Each call frame keeps its own copies of these flags, so frames made from one
+                // compiled function do not see each other's state
+                size_t get_init_flag_count() const { return m_init_flag_count; }
+                size_t get_tensor_enable_count() const { return m_tensor_enable_count; }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
@@ -90,7 +96,27 @@ namespace ngraph
                 }
 
                 const std::string& get_function_name() const { return m_function_name; }
+                /// Analytical cost of each op, by name, when timing is emitted
+                const std::unordered_map<std::string, OpCost>& get_op_costs() const
+                {
+                    return m_op_costs;
+                }
+                /// Id under which the ops of this function are recorded in the timeline
+                size_t get_trace_function() const { return m_trace_function; }
+                /// Bytes of Concat output written in place by the Concat's producers, summed
+                /// over all functions compiled for this graph
+                size_t get_concat_bytes_eliminated() const { return m_concat_bytes_eliminated; }
+                void add_concat_bytes_eliminated(size_t bytes)
+                {
+                    m_concat_bytes_eliminated += bytes;
+                }
+                /// Number of Concat, Slice and Reshape ops computed in place, without a copy
+                size_t get_eliminated_copies() const { return m_eliminated_copies; }
+                void add_eliminated_copies(size_t count) { m_eliminated_copies += count; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
+                /// Held around calls when several call frames share this function's MKL-DNN
+                /// primitives, whose memory handles are rebound on every call
+                std::mutex& get_primitive_mutex() { return m_primitive_mutex; }
                 // Temporary Memory Pool alignment
                 static const size_t s_memory_pool_alignment = 4096;
 
@@ -125,6 +151,8 @@ namespace ngraph
                 std::unique_ptr<codegen::Compiler> m_compiler;
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
                 bool m_emit_timing;
+                bool m_emit_hardware_counters;
+                std::unordered_map<std::string, OpCost> m_op_costs;
                 bool m_use_tbb;
                 std::unordered_map<std::string, std::string> m_variable_name_map;
                 std::map<std::string, size_t> m_name_index_map;
@@ -140,8 +168,14 @@ namespace ngraph
                 std::vector<OpAttributes> m_op_attrs;
 
                 std::unique_ptr<MKLDNNEmitter> m_mkldnn_emitter;
+                size_t m_concat_bytes_eliminated;
+                size_t m_eliminated_copies;
+                size_t m_init_flag_count;
+                size_t m_tensor_enable_count;
 
                 std::string m_function_name;
+                size_t m_trace_function;
+                std::mutex m_primitive_mutex;
             };
         }
     }
@@ -123,6 +123,100 @@ void ngraph::runtime::cpu::kernel::emit_broadcast(codegen::CodeWriter& writer,
     close_for_loops(writer, index_vars);
 }
 
+// Strides of an input along each output axis, 0 along its broadcast axes
+static vector<size_t> broadcast_strides(const Shape& arg_shape,
+                                        const Shape& out_shape,
+                                        const AxisSet& broadcast_axes)
+{
+    vector<size_t> strides(out_shape.size(), 0);
+    size_t stride = 1;
+    size_t arg_axis = arg_shape.size();
+    for (size_t i = out_shape.size(); i-- > 0;)
+    {
+        if (broadcast_axes.count(i) == 0)
+        {
+            strides[i] = stride;
+            stride *= arg_shape.at(--arg_axis);
+        }
+    }
+    return strides;
+}
+
+// Offset of an input at the start of output row row_var, for rows over all but the last axis
+static string
+    row_offset(const string& row_var, const Shape& out_shape, const vector<size_t>& strides)
+{
+    stringstream ss;
+    size_t rows_below = 1;
+    for (size_t i = out_shape.size() - 1; i-- > 0;)
+    {
+        if (strides[i] != 0 && out_shape[i] != 1)
+        {
+            if (ss.tellp() > 0)
+            {
+                ss << " + ";
+            }
+            ss << "(" << row_var << " / " << rows_below << " % " << out_shape[i] << ") * "
+               << strides[i];
+        }
+        rows_below *= out_shape[i];
+    }
+    return ss.tellp() > 0 ? ss.str() : "0";
+}
+
+void ngraph::runtime::cpu::kernel::emit_broadcast_elementwise(
+    codegen::CodeWriter& writer,
+    const string& element_type,
+    const string& op,
+    const string& arg0,
+    const string& arg1,
+    const string& out,
+    const Shape& arg0_shape,
+    const Shape& arg1_shape,
+    const Shape& out_shape,
+    const AxisSet& arg0_broadcast_axes,
+    const AxisSet& arg1_broadcast_axes)
+{
+    if (shape_size(out_shape) == 0)
+    {
+        return;
+    }
+    if (out_shape.size() == 0)
+    {
+        writer << out << "[0] = " << arg0 << "[0] " << op << " " << arg1 << "[0];\n";
+        return;
+    }
+
+    auto arg0_strides = broadcast_strides(arg0_shape, out_shape, arg0_broadcast_axes);
+    auto arg1_strides = broadcast_strides(arg1_shape, out_shape, arg1_broadcast_axes);
+    size_t row_size = out_shape.back();
+    size_t rows = shape_size(out_shape) / row_size;
+
+    // Rows are spread over the threads, and within a row each input is either contiguous or a
+    // single value, which keeps the inner loop vectorizable. A single row is split instead.
+    if (rows > 1)
+    {
+        writer << "#pragma omp parallel for\n";
+    }
+    writer << "for (size_t row = 0; row < " << rows << "; row++)\n";
+    writer.block_begin();
+    writer << element_type << "* out_row = " << out << " + row * " << row_size << ";\n";
+    writer << "const " << element_type << "* arg0_row = " << arg0 << " + "
+           << row_offset("row", out_shape, arg0_strides) << ";\n";
+    writer << "const " << element_type << "* arg1_row = " << arg1 << " + "
+           << row_offset("row", out_shape, arg1_strides) << ";\n";
+    if (rows == 1)
+    {
+        writer << "#pragma omp parallel for\n";
+    }
+    writer << "for (size_t i = 0; i < " << row_size << "; i++)\n";
+    writer.block_begin();
+    writer << "out_row[i] = arg0_row[" << (arg0_strides.back() == 0 ? "0" : "i") << "] " << op
+           << " arg1_row[" << (arg1_strides.back() == 0 ? "0" : "i") << "];\n";
+    writer.block_end();
+    writer.block_end();
+}
+
 //
 // For the reference kernel this is based on, see ngraph/runtime/reference/concat.hpp.
 //
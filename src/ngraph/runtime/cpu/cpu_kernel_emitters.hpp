@@ -36,6 +36,18 @@ namespace ngraph
                                     const Shape& arg0_shape,
                                     const Shape& out_shape,
                                     const AxisSet& broadcast_axes);
+                // Inputs with broadcast axes are read at stride 0 along those axes
+                void emit_broadcast_elementwise(codegen::CodeWriter& writer,
+                                                const std::string& element_type,
+                                                const std::string& op,
+                                                const std::string& arg0,
+                                                const std::string& arg1,
+                                                const std::string& out,
+                                                const Shape& arg0_shape,
+                                                const Shape& arg1_shape,
+                                                const Shape& out_shape,
+                                                const AxisSet& arg0_broadcast_axes,
+                                                const AxisSet& arg1_broadcast_axes);
                 void emit_concat(codegen::CodeWriter& writer,
                                  const std::string& element_type,
                                  const std::vector<std::string>& args,
@@ -125,6 +125,35 @@ namespace ngraph
                                     const Shape& padding_below,
                                     const Shape& padding_above);
 
+                void lstm_float32(const float* gates,
+                                  const float* cell_state,
+                                  float* hidden_out,
+                                  float* cell_out,
+                                  size_t batch_size,
+                                  size_t hidden_size);
+
+                void lstm_backprop_float32(const float* gates,
+                                           const float* cell_state,
+                                           const float* delta_hidden,
+                                           const float* delta_cell,
+                                           float* delta_gates,
+                                           float* delta_cell_state,
+                                           size_t batch_size,
+                                           size_t hidden_size);
+
+                void softmax_cross_entropy_float32(const float* logits,
+                                                   const float* labels,
+                                                   float* out,
+                                                   size_t rows,
+                                                   size_t class_count);
+
+                void softmax_cross_entropy_backprop_float32(const float* logits,
+                                                            const float* labels,
+                                                            const float* delta,
+                                                            float* out,
+                                                            size_t rows,
+                                                            size_t class_count);
+
                 void reduce_sum_all_1d_float32(float* input,
                                                float* output,
                                                const Shape& input_shape,
@@ -152,6 +181,46 @@ namespace ngraph
                                                const Shape& output_shape,
                                                const AxisSet& reduction_axes);
 
+                // General parallel reductions over any rank and set of axes; see
+                // kernel/reduce.hpp. Instantiated for the arithmetic types except f16 and bf16.
+                template <typename ElementType>
+                void parallel_reduce_sum(const ElementType* input,
+                                         ElementType* output,
+                                         const Shape& input_shape,
+                                         const AxisSet& reduction_axes);
+
+                template <typename ElementType>
+                void parallel_reduce_product(const ElementType* input,
+                                             ElementType* output,
+                                             const Shape& input_shape,
+                                             const AxisSet& reduction_axes);
+
+                template <typename ElementType>
+                void parallel_reduce_max(const ElementType* input,
+                                         ElementType* output,
+                                         const Shape& input_shape,
+                                         const AxisSet& reduction_axes);
+
+                template <typename ElementType>
+                void parallel_reduce_min(const ElementType* input,
+                                         ElementType* output,
+                                         const Shape& input_shape,
+                                         const AxisSet& reduction_axes);
+
+                // Softmax over one run of adjacent axes; instantiated for float and double.
+                template <typename ElementType>
+                void parallel_softmax(const ElementType* input,
+                                      ElementType* output,
+                                      const Shape& shape,
+                                      const AxisSet& axes);
+
+                // Permutes any rank and element type; see kernel/transpose.hpp.
+                void transpose(const void* input,
+                               void* output,
+                               size_t element_size,
+                               const Shape& input_shape,
+                               const AxisVector& input_axis_order);
+
                 void reshape_3d_3d_float32(float* input,
                                            float* output,
                                            const Shape& input_shape,
@@ -28,11 +28,19 @@ namespace ngraph
             class CPUOpAnnotations : public ngraph::op::util::OpAnnotations
             {
             public:
-                CPUOpAnnotations() { m_mkldnn_op = false; }
+                CPUOpAnnotations()
+                {
+                    m_mkldnn_op = false;
+                    m_in_place = false;
+                }
                 bool is_mkldnn_op() { return m_mkldnn_op; }
                 void set_mkldnn_op(bool val) { m_mkldnn_op = val; }
+                /// The op's output shares memory with its inputs, so no kernel is emitted
+                bool is_in_place() { return m_in_place; }
+                void set_in_place(bool val) { m_in_place = val; }
             private:
                 bool m_mkldnn_op;
+                bool m_in_place;
             };
         }
     }
@@ -45,8 +45,11 @@ namespace ngraph
             extern "C" {
             struct CPURuntimeContext
             {
-                int64_t* op_durations;
                 bool* p_en;
+                bool* init; // per generated function, true until its first call
+                bool* t_en; // per tensor read by an op, true when it was written this call
+                bool tracing;          // record the ops of this call in the timeline
+                size_t trace_function; // id from register_traced_function
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
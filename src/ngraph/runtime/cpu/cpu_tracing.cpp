@@ -16,62 +16,263 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 
-#include "cpu_tracing.hpp"
+#include <unistd.h>
 
-void ngraph::runtime::cpu::to_json(nlohmann::json& json, const TraceEvent& event)
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+std::atomic<bool> runtime::cpu::s_tracing_enabled(std::getenv("NGRAPH_CPU_TRACING") != nullptr);
+
+namespace
 {
-    std::map<std::string, std::string> args;
-    for (size_t i = 0; i < event.Inputs.size(); i++)
+    struct TraceRecord
+    {
+        size_t function;
+        size_t op;
+        int64_t start;
+        int64_t end;
+    };
+
+    // Written only by its owning thread and read by write_trace while the thread may still be
+    // writing. Each slot carries a sequence number, one more than the index of the record it
+    // holds, which is 0 while the slot is being written. A reader that sees the same expected
+    // number before and after copying a slot has a complete record; otherwise the writer
+    // overwrote it, and it is skipped, which only loses the oldest events.
+    class TraceRing
+    {
+    public:
+        TraceRing(size_t tid)
+            : m_tid(tid)
+            , m_slots(new Slot[s_capacity])
+            , m_head(0)
+            , m_tail(0)
+        {
+        }
+
+        void push(const TraceRecord& record)
+        {
+            uint64_t head = m_head.load(memory_order_relaxed);
+            Slot& slot = m_slots[head & (s_capacity - 1)];
+            slot.sequence.store(0, memory_order_relaxed);
+            atomic_thread_fence(memory_order_release);
+            slot.id.store(uint64_t(record.function) << 32 | record.op, memory_order_relaxed);
+            slot.start.store(record.start, memory_order_relaxed);
+            slot.end.store(record.end, memory_order_relaxed);
+            slot.sequence.store(head + 1, memory_order_release);
+            m_head.store(head + 1, memory_order_release);
+        }
+
+        // Called with the registry lock held
+        vector<TraceRecord> drain()
+        {
+            uint64_t head = m_head.load(memory_order_acquire);
+            uint64_t tail = max(m_tail, head > s_capacity ? head - s_capacity : 0);
+            vector<TraceRecord> records;
+            for (uint64_t i = tail; i < head; i++)
+            {
+                Slot& slot = m_slots[i & (s_capacity - 1)];
+                uint64_t sequence = slot.sequence.load(memory_order_acquire);
+                uint64_t id = slot.id.load(memory_order_relaxed);
+                TraceRecord record{id >> 32,
+                                   id & 0xffffffff,
+                                   slot.start.load(memory_order_relaxed),
+                                   slot.end.load(memory_order_relaxed)};
+                atomic_thread_fence(memory_order_acquire);
+                if (sequence == i + 1 && slot.sequence.load(memory_order_relaxed) == i + 1)
+                {
+                    records.push_back(record);
+                }
+            }
+            m_tail = head;
+            return records;
+        }
+
+        size_t get_tid() const { return m_tid; }
+    private:
+        struct Slot
+        {
+            atomic<uint64_t> sequence{0};
+            atomic<uint64_t> id{0};
+            atomic<int64_t> start{0};
+            atomic<int64_t> end{0};
+        };
+
+        static const size_t s_capacity = 1 << 16;
+
+        size_t m_tid;
+        unique_ptr<Slot[]> m_slots;
+        atomic<uint64_t> m_head;
+        uint64_t m_tail;
+    };
+
+    struct TracedEvent
+    {
+        size_t tid;
+        TraceRecord record;
+    };
+
+    struct TracedFunction
+    {
+        string name;
+        vector<runtime::cpu::OpAttributes> ops;
+        // Drained from the rings but not yet written
+        vector<TracedEvent> events;
+    };
+
+    struct TraceRegistry
+    {
+        mutex lock;
+        vector<shared_ptr<TraceRing>> rings;
+        map<size_t, TracedFunction> functions;
+        size_t next_function = 1;
+
+        // Moves the events in the rings to their functions, dropping those of functions that
+        // are gone. Called with the lock held.
+        void drain()
+        {
+            for (auto& ring : rings)
+            {
+                for (const TraceRecord& record : ring->drain())
+                {
+                    auto function = functions.find(record.function);
+                    if (function != functions.end())
+                    {
+                        function->second.events.push_back(TracedEvent{ring->get_tid(), record});
+                    }
+                }
+            }
+        }
+    };
+
+    TraceRegistry& get_registry()
     {
-        args["Input" + std::to_string(i + 1)] = event.Inputs[i];
+        static TraceRegistry registry;
+        return registry;
     }
-    for (size_t i = 0; i < event.Outputs.size(); i++)
+
+    TraceRing& get_thread_ring()
     {
-        args["Output" + std::to_string(i + 1)] = event.Outputs[i];
+        // The registry keeps the ring alive after its thread exits so its events can still be
+        // written.
+        thread_local shared_ptr<TraceRing> ring;
+        if (!ring)
+        {
+            TraceRegistry& registry = get_registry();
+            lock_guard<mutex> guard(registry.lock);
+            ring = make_shared<TraceRing>(registry.rings.size());
+            registry.rings.push_back(ring);
+        }
+        return *ring;
     }
 
-    json = nlohmann::json{{"ph", event.Phase},
-                          {"cat", event.Category},
-                          {"name", event.Name},
-                          {"pid", event.PID},
-                          {"tid", event.TID},
-                          {"ts", event.Timestamp},
-                          {"dur", event.Duration},
-                          {"args", args}};
+    // Writes and discards the events of the functions, one thread track per ring
+    void write_events(const string& file_name, const vector<TracedFunction*>& functions)
+    {
+        auto pid = getpid();
+        nlohmann::json events = nlohmann::json::array();
+        set<size_t> tids;
+        for (TracedFunction* function : functions)
+        {
+            for (const TracedEvent& event : function->events)
+            {
+                if (tids.insert(event.tid).second)
+                {
+                    events.push_back(
+                        {{"ph", "M"},
+                         {"name", "thread_name"},
+                         {"pid", pid},
+                         {"tid", event.tid},
+                         {"args", {{"name", "nGraph CPU " + to_string(event.tid)}}}});
+                }
+                const runtime::cpu::OpAttributes& op = function->ops.at(event.record.op);
+                map<string, string> args;
+                args["Function"] = function->name;
+                for (size_t i = 0; i < op.Inputs.size(); i++)
+                {
+                    args["Input" + to_string(i + 1)] = op.Inputs[i];
+                }
+                for (size_t i = 0; i < op.Outputs.size(); i++)
+                {
+                    args["Output" + to_string(i + 1)] = op.Outputs[i];
+                }
+                // Chrome trace timestamps are in microseconds
+                events.push_back({{"ph", "X"},
+                                  {"cat", "Op"},
+                                  {"name", op.Description},
+                                  {"pid", pid},
+                                  {"tid", event.tid},
+                                  {"ts", event.record.start / 1000.0},
+                                  {"dur", (event.record.end - event.record.start) / 1000.0},
+                                  {"args", args}});
+            }
+            function->events.clear();
+        }
+
+        nlohmann::json timeline;
+        timeline["traceEvents"] = events;
+        timeline["displayTimeUnit"] = "ns";
+        ofstream out(file_name);
+        out << timeline;
+    }
 }
 
-void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
-                                            int64_t* op_durations,
-                                            const std::string& file_name)
+void runtime::cpu::set_tracing_enabled(bool enable)
 {
-    nlohmann::json timeline;
-    std::list<TraceEvent> trace;
-    std::ofstream out(file_name);
+    s_tracing_enabled.store(enable, memory_order_relaxed);
+}
 
-    int64_t ts = 0;
-    for (size_t i = 0; i < op_attrs.size(); i++)
-    {
-        trace.emplace_back("X",
-                           "Op",
-                           op_attrs[i].Description,
-                           0,
-                           0,
-                           ts,
-                           op_durations[i],
-                           op_attrs[i].Outputs,
-                           op_attrs[i].Inputs);
-        ts += op_durations[i];
-    }
+size_t runtime::cpu::register_traced_function(const string& name, const vector<OpAttributes>& ops)
+{
+    TraceRegistry& registry = get_registry();
+    lock_guard<mutex> guard(registry.lock);
+    size_t id = registry.next_function++;
+    registry.functions[id] = TracedFunction{name, ops, {}};
+    return id;
+}
 
-    timeline["traceEvents"] = trace;
-    out << timeline;
-    out.close();
+void runtime::cpu::unregister_traced_function(size_t function)
+{
+    TraceRegistry& registry = get_registry();
+    lock_guard<mutex> guard(registry.lock);
+    registry.functions.erase(function);
+}
 
-    return;
+void runtime::cpu::trace_op(size_t function, size_t op, int64_t start, int64_t end)
+{
+    get_thread_ring().push(TraceRecord{function, op, start, end});
 }
 
-bool ngraph::runtime::cpu::IsTracingEnabled()
+void runtime::cpu::write_trace(const string& file_name)
 {
-    return (std::getenv("NGRAPH_CPU_TRACING") != nullptr);
+    TraceRegistry& registry = get_registry();
+    lock_guard<mutex> guard(registry.lock);
+    registry.drain();
+    vector<TracedFunction*> functions;
+    for (auto& function : registry.functions)
+    {
+        functions.push_back(&function.second);
+    }
+    write_events(file_name, functions);
+}
+
+void runtime::cpu::write_trace(const string& file_name, size_t function)
+{
+    TraceRegistry& registry = get_registry();
+    lock_guard<mutex> guard(registry.lock);
+    registry.drain();
+    auto it = registry.functions.find(function);
+    vector<TracedFunction*> functions;
+    if (it != registry.functions.end())
+    {
+        functions.push_back(&it->second);
+    }
+    write_events(file_name, functions);
 }
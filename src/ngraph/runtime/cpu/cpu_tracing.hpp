@@ -16,62 +16,63 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
 
-#include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "nlohmann/json.hpp"
-
 namespace ngraph
 {
     namespace runtime
     {
         namespace cpu
         {
-            struct TraceEvent
+            struct OpAttributes;
+
+            // Op timeline recording. Compiled functions always contain the tracing hooks; they
+            // only record while tracing is enabled, which costs one load and branch per op
+            // otherwise. Each thread appends to its own fixed-size ring buffer without locking,
+            // keeping the most recent events. write_trace drains the rings into per-function
+            // lists of events and writes the requested ones.
+
+            extern std::atomic<bool> s_tracing_enabled;
+
+            inline bool is_tracing_enabled()
             {
-                // This should be a single character
-                // but the JSON encoder nlohmann::json
-                // is broken and doesn't handle character fields
-                std::string Phase;
-                std::string Category;
-                const std::string& Name;
-                unsigned int PID;
-                unsigned int TID;
-                int64_t Timestamp;
-                int64_t Duration;
-                const std::vector<std::string>& Outputs;
-                const std::vector<std::string>& Inputs;
+                return s_tracing_enabled.load(std::memory_order_relaxed);
+            }
+
+            void set_tracing_enabled(bool enable);
+
+            /// \brief Nanoseconds on the clock used for trace timestamps.
+            inline int64_t trace_clock()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+            }
+
+            /// \brief Registers the ops of a compiled function, in the order of their indices
+            ///        in trace_op, and returns the id to pass to trace_op. Ids are never 0 and
+            ///        never reused.
+            size_t register_traced_function(const std::string& name,
+                                            const std::vector<OpAttributes>& ops);
+
+            /// \brief Forgets a function and the events recorded for it that were not written.
+            void unregister_traced_function(size_t function);
 
-                TraceEvent(const std::string& ph,
-                           const std::string& cat,
-                           const std::string& name,
-                           unsigned int pid,
-                           unsigned int tid,
-                           int64_t ts,
-                           int64_t dur,
-                           const std::vector<std::string>& outputs,
-                           const std::vector<std::string>& inputs)
-                    : Phase(ph)
-                    , Category(cat)
-                    , Name(name)
-                    , PID(pid)
-                    , TID(tid)
-                    , Timestamp(ts)
-                    , Duration(dur)
-                    , Outputs(outputs)
-                    , Inputs(inputs)
-                {
-                }
-            };
+            /// \brief Records an execution of op `op` of function `function` on the calling
+            ///        thread.
+            void trace_op(size_t function, size_t op, int64_t start, int64_t end);
 
-            void to_json(nlohmann::json& json, const TraceEvent& event);
+            /// \brief Writes every event not yet written in Chrome trace event format, which
+            ///        Perfetto and chrome://tracing load, and discards them.
+            void write_trace(const std::string& file_name);
 
-            void GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
-                                  int64_t* op_durations,
-                                  const std::string& file_name);
-            bool IsTracingEnabled();
+            /// \brief Like write_trace, but only writes and discards the events of one function.
+            void write_trace(const std::string& file_name, size_t function);
         }
     }
 }
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "lstm.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void lstm_float32(const float* gates,
+                                  const float* cell_state,
+                                  float* hidden_out,
+                                  float* cell_out,
+                                  size_t batch_size,
+                                  size_t hidden_size)
+                {
+                    lstm<float>(gates, cell_state, hidden_out, cell_out, batch_size, hidden_size);
+                }
+
+                void lstm_backprop_float32(const float* gates,
+                                           const float* cell_state,
+                                           const float* delta_hidden,
+                                           const float* delta_cell,
+                                           float* delta_gates,
+                                           float* delta_cell_state,
+                                           size_t batch_size,
+                                           size_t hidden_size)
+                {
+                    lstm_backprop<float>(gates,
+                                         cell_state,
+                                         delta_hidden,
+                                         delta_cell,
+                                         delta_gates,
+                                         delta_cell_state,
+                                         batch_size,
+                                         hidden_size);
+                }
+            }
+        }
+    }
+}
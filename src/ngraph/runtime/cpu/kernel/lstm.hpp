@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType>
+                ElementType lstm_sigmoid(ElementType x)
+                {
+                    return ElementType(1) / (ElementType(1) + std::exp(-x));
+                }
+
+                // Evaluates all four gates and the state update of one LSTM cell in a single
+                // pass over the gates, one batch row per task. The gates are laid out as
+                // [input, forget, candidate, output] blocks of hidden_size columns.
+                template <typename ElementType>
+                void lstm(const ElementType* gates,
+                          const ElementType* cell_state,
+                          ElementType* hidden_out,
+                          ElementType* cell_out,
+                          size_t batch_size,
+                          size_t hidden_size)
+                {
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index n = first; n < last; n++)
+                        {
+                            const ElementType* g = gates + n * 4 * hidden_size;
+                            const ElementType* c_prev = cell_state + n * hidden_size;
+                            ElementType* h = hidden_out + n * hidden_size;
+                            ElementType* c = cell_out + n * hidden_size;
+                            for (size_t j = 0; j < hidden_size; j++)
+                            {
+                                ElementType i_gate = lstm_sigmoid(g[j]);
+                                ElementType f_gate = lstm_sigmoid(g[hidden_size + j]);
+                                ElementType candidate = std::tanh(g[2 * hidden_size + j]);
+                                ElementType o_gate = lstm_sigmoid(g[3 * hidden_size + j]);
+                                ElementType cell = f_gate * c_prev[j] + i_gate * candidate;
+                                c[j] = cell;
+                                h[j] = o_gate * std::tanh(cell);
+                            }
+                        }
+                    };
+
+                    // Per row: read 5H values, write 2H, and five transcendental functions per
+                    // column
+                    Eigen::TensorOpCost cost(5 * hidden_size * sizeof(ElementType),
+                                             2 * hidden_size * sizeof(ElementType),
+                                             100 * hidden_size);
+                    eigen::global_thread_pool_device.parallelFor(batch_size, cost, rows);
+                }
+
+                // Gradient of lstm with respect to the gates and the previous cell state, given
+                // the deltas of both outputs. The activations are recomputed from the gates.
+                template <typename ElementType>
+                void lstm_backprop(const ElementType* gates,
+                                   const ElementType* cell_state,
+                                   const ElementType* delta_hidden,
+                                   const ElementType* delta_cell,
+                                   ElementType* delta_gates,
+                                   ElementType* delta_cell_state,
+                                   size_t batch_size,
+                                   size_t hidden_size)
+                {
+                    auto rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index n = first; n < last; n++)
+                        {
+                            const ElementType* g = gates + n * 4 * hidden_size;
+                            const ElementType* c_prev = cell_state + n * hidden_size;
+                            const ElementType* dh = delta_hidden + n * hidden_size;
+                            const ElementType* dc = delta_cell + n * hidden_size;
+                            ElementType* dg = delta_gates + n * 4 * hidden_size;
+                            ElementType* dc_prev = delta_cell_state + n * hidden_size;
+                            for (size_t j = 0; j < hidden_size; j++)
+                            {
+                                ElementType i_gate = lstm_sigmoid(g[j]);
+                                ElementType f_gate = lstm_sigmoid(g[hidden_size + j]);
+                                ElementType candidate = std::tanh(g[2 * hidden_size + j]);
+                                ElementType o_gate = lstm_sigmoid(g[3 * hidden_size + j]);
+                                ElementType tanh_cell =
+                                    std::tanh(f_gate * c_prev[j] + i_gate * candidate);
+
+                                ElementType d_cell =
+                                    dc[j] +
+                                    dh[j] * o_gate * (ElementType(1) - tanh_cell * tanh_cell);
+                                dg[j] = d_cell * candidate * i_gate * (ElementType(1) - i_gate);
+                                dg[hidden_size + j] =
+                                    d_cell * c_prev[j] * f_gate * (ElementType(1) - f_gate);
+                                dg[2 * hidden_size + j] =
+                                    d_cell * i_gate * (ElementType(1) - candidate * candidate);
+                                dg[3 * hidden_size + j] =
+                                    dh[j] * tanh_cell * o_gate * (ElementType(1) - o_gate);
+                                dc_prev[j] = d_cell * f_gate;
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(7 * hidden_size * sizeof(ElementType),
+                                             5 * hidden_size * sizeof(ElementType),
+                                             120 * hidden_size);
+                    eigen::global_thread_pool_device.parallelFor(batch_size, cost, rows);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,178 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "reduce.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                std::vector<ReductionPass> canonicalize_reduction(const Shape& input_shape,
+                                                                  const AxisSet& reduction_axes)
+                {
+                    struct Run
+                    {
+                        size_t size;
+                        bool reduced;
+                    };
+
+                    // Unit axes do not change the layout, so they are dropped; everything else
+                    // is merged into alternating runs of kept and reduced axes.
+                    std::vector<Run> runs;
+                    for (size_t axis = 0; axis < input_shape.size(); axis++)
+                    {
+                        if (input_shape[axis] == 1)
+                        {
+                            continue;
+                        }
+                        bool reduced = reduction_axes.count(axis) != 0;
+                        if (!runs.empty() && runs.back().reduced == reduced)
+                        {
+                            runs.back().size *= input_shape[axis];
+                        }
+                        else
+                        {
+                            runs.push_back(Run{input_shape[axis], reduced});
+                        }
+                    }
+
+                    std::vector<ReductionPass> passes;
+                    while (true)
+                    {
+                        size_t last_reduced = runs.size();
+                        for (size_t i = 0; i < runs.size(); i++)
+                        {
+                            if (runs[i].reduced)
+                            {
+                                last_reduced = i;
+                            }
+                        }
+                        if (last_reduced == runs.size())
+                        {
+                            break;
+                        }
+
+                        ReductionPass pass{1, runs[last_reduced].size, 1};
+                        for (size_t i = 0; i < last_reduced; i++)
+                        {
+                            pass.outer *= runs[i].size;
+                        }
+                        for (size_t i = last_reduced + 1; i < runs.size(); i++)
+                        {
+                            pass.inner *= runs[i].size;
+                        }
+                        passes.push_back(pass);
+
+                        // The reduced run disappears and its kept neighbours become adjacent.
+                        runs.erase(runs.begin() + last_reduced);
+                        if (last_reduced > 0 && last_reduced < runs.size() &&
+                            !runs[last_reduced - 1].reduced)
+                        {
+                            runs[last_reduced - 1].size *= runs[last_reduced].size;
+                            runs.erase(runs.begin() + last_reduced);
+                        }
+                    }
+
+                    if (passes.empty())
+                    {
+                        passes.push_back(ReductionPass{shape_size(input_shape), 1, 1});
+                    }
+                    return passes;
+                }
+
+                template <typename ElementType>
+                void parallel_reduce_sum(const ElementType* input,
+                                         ElementType* output,
+                                         const Shape& input_shape,
+                                         const AxisSet& reduction_axes)
+                {
+                    reduce<ElementType, SumReduction<ElementType>>(
+                        input, output, input_shape, reduction_axes);
+                }
+
+                template <typename ElementType>
+                void parallel_reduce_product(const ElementType* input,
+                                             ElementType* output,
+                                             const Shape& input_shape,
+                                             const AxisSet& reduction_axes)
+                {
+                    reduce<ElementType, ProductReduction<ElementType>>(
+                        input, output, input_shape, reduction_axes);
+                }
+
+                template <typename ElementType>
+                void parallel_reduce_max(const ElementType* input,
+                                         ElementType* output,
+                                         const Shape& input_shape,
+                                         const AxisSet& reduction_axes)
+                {
+                    reduce<ElementType, MaxReduction<ElementType>>(
+                        input, output, input_shape, reduction_axes);
+                }
+
+                template <typename ElementType>
+                void parallel_reduce_min(const ElementType* input,
+                                         ElementType* output,
+                                         const Shape& input_shape,
+                                         const AxisSet& reduction_axes)
+                {
+                    reduce<ElementType, MinReduction<ElementType>>(
+                        input, output, input_shape, reduction_axes);
+                }
+
+                template <typename ElementType>
+                void parallel_softmax(const ElementType* input,
+                                      ElementType* output,
+                                      const Shape& shape,
+                                      const AxisSet& axes)
+                {
+                    softmax<ElementType>(input, output, shape, axes);
+                }
+
+// The engine covers every arithmetic element type except the 16-bit floating point types,
+// which the emitter keeps accumulating in float through the reference kernels.
+#define INSTANTIATE_REDUCTIONS(T)                                                                  \
+    template void parallel_reduce_sum<T>(const T*, T*, const Shape&, const AxisSet&);              \
+    template void parallel_reduce_product<T>(const T*, T*, const Shape&, const AxisSet&);          \
+    template void parallel_reduce_max<T>(const T*, T*, const Shape&, const AxisSet&);              \
+    template void parallel_reduce_min<T>(const T*, T*, const Shape&, const AxisSet&);
+
+                INSTANTIATE_REDUCTIONS(float)
+                INSTANTIATE_REDUCTIONS(double)
+                INSTANTIATE_REDUCTIONS(int8_t)
+                INSTANTIATE_REDUCTIONS(int16_t)
+                INSTANTIATE_REDUCTIONS(int32_t)
+                INSTANTIATE_REDUCTIONS(int64_t)
+                INSTANTIATE_REDUCTIONS(uint8_t)
+                INSTANTIATE_REDUCTIONS(uint16_t)
+                INSTANTIATE_REDUCTIONS(uint32_t)
+                INSTANTIATE_REDUCTIONS(uint64_t)
+
+                template void
+                    parallel_softmax<float>(const float*, float*, const Shape&, const AxisSet&);
+                template void
+                    parallel_softmax<double>(const double*, double*, const Shape&, const AxisSet&);
+            }
+        }
+    }
+}
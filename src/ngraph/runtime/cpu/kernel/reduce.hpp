@@ -0,0 +1,343 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// One step of a reduction over a row-major tensor viewed as
+                /// [outer, reduced, inner], producing [outer, inner].
+                struct ReductionPass
+                {
+                    size_t outer;
+                    size_t reduced;
+                    size_t inner;
+                };
+
+                /// Canonicalizes a reduction of any rank and any set of axes. Unit axes are
+                /// dropped and adjacent axes that are both reduced or both kept are merged, then
+                /// each remaining run of reduced axes becomes one pass, innermost run first.
+                /// Most reductions need a single pass; a reduction with no reduced elements
+                /// becomes a single copy pass with reduced == 1.
+                std::vector<ReductionPass> canonicalize_reduction(const Shape& input_shape,
+                                                                  const AxisSet& reduction_axes);
+
+                template <typename T>
+                struct SumReduction
+                {
+                    static T identity() { return T(0); }
+                    static T combine(T a, T b) { return a + b; }
+                };
+
+                template <typename T>
+                struct ProductReduction
+                {
+                    static T identity() { return T(1); }
+                    static T combine(T a, T b) { return a * b; }
+                };
+
+                template <typename T>
+                struct MaxReduction
+                {
+                    static T identity()
+                    {
+                        return std::numeric_limits<T>::has_infinity
+                                   ? -std::numeric_limits<T>::infinity()
+                                   : std::numeric_limits<T>::lowest();
+                    }
+                    static T combine(T a, T b) { return b > a ? b : a; }
+                };
+
+                template <typename T>
+                struct MinReduction
+                {
+                    static T identity()
+                    {
+                        return std::numeric_limits<T>::has_infinity
+                                   ? std::numeric_limits<T>::infinity()
+                                   : std::numeric_limits<T>::max();
+                    }
+                    static T combine(T a, T b) { return b < a ? b : a; }
+                };
+
+                // Reduces `count` contiguous elements. Independent accumulators let the compiler
+                // keep several vector lanes busy without reassociating a single dependency chain.
+                template <typename T, typename R>
+                T reduce_contiguous(const T* in, size_t count)
+                {
+                    const size_t lanes = 8;
+                    T acc[lanes];
+                    std::fill(acc, acc + lanes, R::identity());
+
+                    size_t i = 0;
+                    for (; i + lanes <= count; i += lanes)
+                    {
+                        for (size_t l = 0; l < lanes; l++)
+                        {
+                            acc[l] = R::combine(acc[l], in[i + l]);
+                        }
+                    }
+                    for (; i < count; i++)
+                    {
+                        acc[0] = R::combine(acc[0], in[i]);
+                    }
+
+                    T result = acc[0];
+                    for (size_t l = 1; l < lanes; l++)
+                    {
+                        result = R::combine(result, acc[l]);
+                    }
+                    return result;
+                }
+
+                // Reduces rows [r_begin, r_end) of one [reduced, inner] slab into `out`, which
+                // holds `inner` accumulators. The innermost loop runs over contiguous elements.
+                template <typename T, typename R>
+                void reduce_strided(const T* in,
+                                    T* out,
+                                    size_t r_begin,
+                                    size_t r_end,
+                                    size_t i_begin,
+                                    size_t i_end,
+                                    size_t inner)
+                {
+                    std::fill(out + i_begin, out + i_end, R::identity());
+                    for (size_t r = r_begin; r < r_end; r++)
+                    {
+                        const T* row = in + r * inner;
+                        for (size_t i = i_begin; i < i_end; i++)
+                        {
+                            out[i] = R::combine(out[i], row[i]);
+                        }
+                    }
+                }
+
+                template <typename T, typename R>
+                void reduction_pass(const T* in, T* out, const ReductionPass& pass)
+                {
+                    const size_t outer = pass.outer;
+                    const size_t reduced = pass.reduced;
+                    const size_t inner = pass.inner;
+                    const size_t threads =
+                        static_cast<size_t>(eigen::global_thread_pool_device.numThreads());
+
+                    // Independent units of work if we only split the outputs: one per row when
+                    // inner == 1, otherwise one per (outer, block of inner) pair.
+                    const size_t inner_block = 1024;
+                    const size_t inner_blocks = (inner + inner_block - 1) / inner_block;
+                    const size_t output_tasks = inner == 1 ? outer : outer * inner_blocks;
+
+                    // When the outputs alone cannot keep every thread busy, also split the
+                    // reduced dimension into chunks and combine the partial results afterwards.
+                    const size_t min_chunk = 4096 / std::max<size_t>(inner, 1) + 1;
+                    size_t chunks = 1;
+                    if (output_tasks < threads && reduced >= 2 * min_chunk)
+                    {
+                        chunks = std::min(threads, reduced / min_chunk);
+                    }
+                    const size_t chunk_size = (reduced + chunks - 1) / std::max<size_t>(chunks, 1);
+
+                    std::vector<T> partials;
+                    T* dest = out;
+                    if (chunks > 1)
+                    {
+                        partials.resize(chunks * outer * inner);
+                        dest = partials.data();
+                    }
+
+                    auto work = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index task = first; task < last; task++)
+                        {
+                            size_t chunk = static_cast<size_t>(task) / output_tasks;
+                            size_t unit = static_cast<size_t>(task) % output_tasks;
+                            size_t r_begin = std::min(reduced, chunk * chunk_size);
+                            size_t r_end = std::min(reduced, r_begin + chunk_size);
+                            T* chunk_out = dest + chunk * outer * inner;
+
+                            if (inner == 1)
+                            {
+                                chunk_out[unit] = reduce_contiguous<T, R>(
+                                    in + unit * reduced + r_begin, r_end - r_begin);
+                            }
+                            else
+                            {
+                                size_t o = unit / inner_blocks;
+                                size_t i_begin = (unit % inner_blocks) * inner_block;
+                                size_t i_end = std::min(inner, i_begin + inner_block);
+                                reduce_strided<T, R>(in + o * reduced * inner,
+                                                     chunk_out + o * inner,
+                                                     r_begin,
+                                                     r_end,
+                                                     i_begin,
+                                                     i_end,
+                                                     inner);
+                            }
+                        }
+                    };
+
+                    // Per task: read one chunk of the reduced run for each output it covers.
+                    size_t outputs_per_task = inner == 1 ? 1 : std::min(inner, inner_block);
+                    double elements_per_task = static_cast<double>(outputs_per_task) *
+                                               static_cast<double>(chunk_size);
+                    Eigen::TensorOpCost cost(elements_per_task * sizeof(T),
+                                             outputs_per_task * sizeof(T),
+                                             elements_per_task);
+                    eigen::global_thread_pool_device.parallelFor(
+                        static_cast<Eigen::Index>(chunks * output_tasks), cost, work);
+
+                    if (chunks > 1)
+                    {
+                        const size_t outputs = outer * inner;
+                        auto combine = [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index k = first; k < last; k++)
+                            {
+                                T result = partials[k];
+                                for (size_t c = 1; c < chunks; c++)
+                                {
+                                    result = R::combine(result, partials[c * outputs + k]);
+                                }
+                                out[k] = result;
+                            }
+                        };
+                        Eigen::TensorOpCost combine_cost(
+                            chunks * sizeof(T), sizeof(T), static_cast<double>(chunks));
+                        eigen::global_thread_pool_device.parallelFor(
+                            static_cast<Eigen::Index>(outputs), combine_cost, combine);
+                    }
+                }
+
+                /// Reduces `input` over `reduction_axes` with the reduction R, using as many
+                /// passes as canonicalize_reduction returns and a scratch buffer between them.
+                template <typename T, typename R>
+                void reduce(const T* input,
+                            T* output,
+                            const Shape& input_shape,
+                            const AxisSet& reduction_axes)
+                {
+                    std::vector<ReductionPass> passes =
+                        canonicalize_reduction(input_shape, reduction_axes);
+
+                    std::vector<T> scratch[2];
+                    const T* in = input;
+                    for (size_t p = 0; p < passes.size(); p++)
+                    {
+                        T* out = output;
+                        size_t out_size = passes[p].outer * passes[p].inner;
+                        if (p + 1 < passes.size())
+                        {
+                            scratch[p % 2].resize(out_size);
+                            out = scratch[p % 2].data();
+                        }
+                        if (passes[p].reduced == 1)
+                        {
+                            std::copy(in, in + out_size, out);
+                        }
+                        else
+                        {
+                            reduction_pass<T, R>(in, out, passes[p]);
+                        }
+                        in = out;
+                    }
+                }
+
+                /// Softmax over `axes`, which must form one run of adjacent axes. Each
+                /// [reduced, inner] slab is handled by one task: max, then exponentials and
+                /// their sum, then normalization, with contiguous innermost loops.
+                template <typename T>
+                void softmax(const T* input, T* output, const Shape& shape, const AxisSet& axes)
+                {
+                    size_t outer = 1;
+                    size_t reduced = 1;
+                    size_t inner = 1;
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (i < *axes.begin())
+                        {
+                            outer *= shape[i];
+                        }
+                        else if (i <= *axes.rbegin())
+                        {
+                            reduced *= shape[i];
+                        }
+                        else
+                        {
+                            inner *= shape[i];
+                        }
+                    }
+
+                    auto work = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<T> maxes(inner);
+                        std::vector<T> sums(inner);
+                        for (Eigen::Index o = first; o < last; o++)
+                        {
+                            const T* in = input + o * reduced * inner;
+                            T* out = output + o * reduced * inner;
+                            reduce_strided<T, MaxReduction<T>>(
+                                in, maxes.data(), 0, reduced, 0, inner, inner);
+
+                            std::fill(sums.begin(), sums.end(), T(0));
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                for (size_t i = 0; i < inner; i++)
+                                {
+                                    T e = std::exp(in[r * inner + i] - maxes[i]);
+                                    out[r * inner + i] = e;
+                                    sums[i] += e;
+                                }
+                            }
+
+                            for (size_t i = 0; i < inner; i++)
+                            {
+                                sums[i] = T(1) / sums[i];
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                for (size_t i = 0; i < inner; i++)
+                                {
+                                    out[r * inner + i] *= sums[i];
+                                }
+                            }
+                        }
+                    };
+
+                    // Per slab: read it twice, write it twice, one exp per element
+                    double slab = static_cast<double>(reduced * inner);
+                    Eigen::TensorOpCost cost(2 * slab * sizeof(T), 2 * slab * sizeof(T), 20 * slab);
+                    eigen::global_thread_pool_device.parallelFor(
+                        static_cast<Eigen::Index>(outer), cost, work);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "softmax_cross_entropy.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void softmax_cross_entropy_float32(const float* logits,
+                                                   const float* labels,
+                                                   float* out,
+                                                   size_t rows,
+                                                   size_t class_count)
+                {
+                    softmax_cross_entropy<float>(logits, labels, out, rows, class_count);
+                }
+
+                void softmax_cross_entropy_backprop_float32(const float* logits,
+                                                            const float* labels,
+                                                            const float* delta,
+                                                            float* out,
+                                                            size_t rows,
+                                                            size_t class_count)
+                {
+                    softmax_cross_entropy_backprop<float>(
+                        logits, labels, delta, out, rows, class_count);
+                }
+            }
+        }
+    }
+}
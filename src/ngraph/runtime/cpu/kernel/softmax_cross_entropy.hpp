@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/softmax_cross_entropy.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Each of the rows of class_count logits is reduced in one pass by one task
+                template <typename ElementType>
+                void softmax_cross_entropy(const ElementType* logits,
+                                           const ElementType* labels,
+                                           ElementType* out,
+                                           size_t rows,
+                                           size_t class_count)
+                {
+                    auto loss = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            out[row] =
+                                reference::softmax_cross_entropy_loss(logits + row * class_count,
+                                                                      labels + row * class_count,
+                                                                      class_count);
+                        }
+                    };
+
+                    // Per row: read both inputs once, one exp per class
+                    Eigen::TensorOpCost cost(2 * class_count * sizeof(ElementType),
+                                             sizeof(ElementType),
+                                             20 * class_count);
+                    eigen::global_thread_pool_device.parallelFor(rows, cost, loss);
+                }
+
+                template <typename ElementType>
+                void softmax_cross_entropy_backprop(const ElementType* logits,
+                                                    const ElementType* labels,
+                                                    const ElementType* delta,
+                                                    ElementType* out,
+                                                    size_t rows,
+                                                    size_t class_count)
+                {
+                    auto gradient = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            reference::softmax_cross_entropy_gradient(logits + row * class_count,
+                                                                      labels + row * class_count,
+                                                                      delta[row],
+                                                                      out + row * class_count,
+                                                                      class_count);
+                        }
+                    };
+
+                    // Per row: read both inputs twice, write the gradient, two exps per class
+                    Eigen::TensorOpCost cost(4 * class_count * sizeof(ElementType),
+                                             class_count * sizeof(ElementType),
+                                             40 * class_count);
+                    eigen::global_thread_pool_device.parallelFor(rows, cost, gradient);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "transpose.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                CanonicalTranspose canonicalize_transpose(const Shape& input_shape,
+                                                          const AxisVector& input_axis_order)
+                {
+                    // Unit axes do not affect the layout on either side.
+                    std::vector<size_t> renumbered(input_shape.size());
+                    Shape shape;
+                    for (size_t axis = 0; axis < input_shape.size(); axis++)
+                    {
+                        renumbered[axis] = shape.size();
+                        if (input_shape[axis] != 1)
+                        {
+                            shape.push_back(input_shape[axis]);
+                        }
+                    }
+                    AxisVector order;
+                    for (auto axis : input_axis_order)
+                    {
+                        if (input_shape[axis] != 1)
+                        {
+                            order.push_back(renumbered[axis]);
+                        }
+                    }
+
+                    // Group output positions whose input axes are consecutive; each group is
+                    // one merged axis.
+                    std::vector<std::vector<size_t>> groups;
+                    for (size_t i = 0; i < order.size(); i++)
+                    {
+                        if (i > 0 && order[i] == order[i - 1] + 1)
+                        {
+                            groups.back().push_back(order[i]);
+                        }
+                        else
+                        {
+                            groups.push_back({order[i]});
+                        }
+                    }
+
+                    // Number the merged axes by their position in the input.
+                    std::vector<size_t> by_input(groups.size());
+                    std::iota(by_input.begin(), by_input.end(), 0);
+                    std::sort(by_input.begin(), by_input.end(), [&](size_t a, size_t b) {
+                        return groups[a].front() < groups[b].front();
+                    });
+
+                    CanonicalTranspose canonical;
+                    canonical.axis_order.resize(groups.size());
+                    for (size_t i = 0; i < by_input.size(); i++)
+                    {
+                        size_t size = 1;
+                        for (auto axis : groups[by_input[i]])
+                        {
+                            size *= shape[axis];
+                        }
+                        canonical.input_shape.push_back(size);
+                        canonical.axis_order[by_input[i]] = i;
+                    }
+                    return canonical;
+                }
+
+                void transpose(const void* input,
+                               void* output,
+                               size_t element_size,
+                               const Shape& input_shape,
+                               const AxisVector& input_axis_order)
+                {
+                    // Only the width of an element matters for moving it.
+                    switch (element_size)
+                    {
+                    case 1:
+                        transpose(static_cast<const uint8_t*>(input),
+                                  static_cast<uint8_t*>(output),
+                                  input_shape,
+                                  input_axis_order);
+                        break;
+                    case 2:
+                        transpose(static_cast<const uint16_t*>(input),
+                                  static_cast<uint16_t*>(output),
+                                  input_shape,
+                                  input_axis_order);
+                        break;
+                    case 4:
+                        transpose(static_cast<const uint32_t*>(input),
+                                  static_cast<uint32_t*>(output),
+                                  input_shape,
+                                  input_axis_order);
+                        break;
+                    case 8:
+                        transpose(static_cast<const uint64_t*>(input),
+                                  static_cast<uint64_t*>(output),
+                                  input_shape,
+                                  input_axis_order);
+                        break;
+                    default: throw ngraph_error("Unsupported element size for transpose");
+                    }
+                }
+            }
+        }
+    }
+}
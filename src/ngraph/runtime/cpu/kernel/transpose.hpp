@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_vector.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief A permutation with unit axes dropped and runs of input axes that stay
+                ///        adjacent in the output merged, so that no two consecutive output axes
+                ///        are consecutive in the input.
+                struct CanonicalTranspose
+                {
+                    Shape input_shape;
+                    AxisVector axis_order;
+                };
+
+                CanonicalTranspose canonicalize_transpose(const Shape& input_shape,
+                                                          const AxisVector& input_axis_order);
+
+                /// \brief Writes the permutation of `input` given by `input_axis_order` to
+                ///        `output` in row-major order.
+                ///
+                /// The two innermost dimensions that matter (the innermost input axis and the
+                /// innermost output axis) are walked in square tiles so that both the reads and
+                /// the writes of a tile stay in cache; the tiles, together with all remaining
+                /// axes, are distributed over the global thread pool. If the innermost axis is
+                /// the same on both sides, rows are moved with memcpy instead.
+                template <typename ElementType>
+                void transpose(const ElementType* input,
+                               ElementType* output,
+                               const Shape& input_shape,
+                               const AxisVector& input_axis_order)
+                {
+                    const size_t tile = 32;
+
+                    size_t count = shape_size(input_shape);
+                    if (count == 0)
+                    {
+                        return;
+                    }
+
+                    auto canonical = canonicalize_transpose(input_shape, input_axis_order);
+                    const Shape& shape = canonical.input_shape;
+                    const AxisVector& order = canonical.axis_order;
+                    size_t rank = shape.size();
+
+                    if (rank <= 1)
+                    {
+                        memcpy(output, input, count * sizeof(ElementType));
+                        return;
+                    }
+
+                    std::vector<size_t> in_strides(rank);
+                    std::vector<size_t> out_shape(rank);
+                    std::vector<size_t> out_strides(rank);
+                    size_t stride = 1;
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        in_strides[i] = stride;
+                        stride *= shape[i];
+                    }
+                    stride = 1;
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        out_shape[i] = shape[order[i]];
+                        out_strides[i] = stride;
+                        stride *= out_shape[i];
+                    }
+
+                    // When the innermost axis is the same on both sides every output row is a
+                    // contiguous input row, so whole rows are moved.
+                    if (order[rank - 1] == rank - 1)
+                    {
+                        size_t row_length = shape[rank - 1];
+                        size_t row_bytes = row_length * sizeof(ElementType);
+                        auto move_rows = [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index row = first; row < last; row++)
+                            {
+                                size_t index = row;
+                                size_t in_offset = 0;
+                                for (size_t i = rank - 1; i-- > 0;)
+                                {
+                                    in_offset += (index % out_shape[i]) * in_strides[order[i]];
+                                    index /= out_shape[i];
+                                }
+                                memcpy(output + row * row_length, input + in_offset, row_bytes);
+                            }
+                        };
+                        eigen::global_thread_pool_device.parallelFor(
+                            count / row_length,
+                            Eigen::TensorOpCost(row_bytes, row_bytes, 0),
+                            move_rows);
+                        return;
+                    }
+
+                    // Otherwise the output axis that walks the input contiguously (row_axis) and
+                    // the innermost output axis (col_axis) are distinct and form the tiles.
+                    size_t row_axis =
+                        std::find(order.begin(), order.end(), rank - 1) - order.begin();
+                    size_t col_axis = rank - 1;
+
+                    size_t rows = out_shape[row_axis];
+                    size_t cols = out_shape[col_axis];
+                    size_t col_in_stride = in_strides[order[col_axis]];
+                    size_t row_out_stride = out_strides[row_axis];
+                    size_t row_tiles = (rows + tile - 1) / tile;
+                    size_t col_tiles = (cols + tile - 1) / tile;
+
+                    // The remaining output axes, outermost first, with their strides on both
+                    // sides.
+                    std::vector<size_t> outer_sizes;
+                    std::vector<size_t> outer_in_strides;
+                    std::vector<size_t> outer_out_strides;
+                    for (size_t i = 0; i < rank; i++)
+                    {
+                        if (i != row_axis && i != col_axis)
+                        {
+                            outer_sizes.push_back(out_shape[i]);
+                            outer_in_strides.push_back(in_strides[order[i]]);
+                            outer_out_strides.push_back(out_strides[i]);
+                        }
+                    }
+
+                    size_t tiles_per_slice = row_tiles * col_tiles;
+                    size_t tasks = tiles_per_slice * (count / (rows * cols));
+                    size_t bytes_per_task = tile * tile * sizeof(ElementType);
+
+                    auto move_tiles = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index task = first; task < last; task++)
+                        {
+                            size_t slice = task / tiles_per_slice;
+                            size_t tile_index = task % tiles_per_slice;
+
+                            size_t in_base = 0;
+                            size_t out_base = 0;
+                            for (size_t i = outer_sizes.size(); i-- > 0;)
+                            {
+                                size_t coordinate = slice % outer_sizes[i];
+                                slice /= outer_sizes[i];
+                                in_base += coordinate * outer_in_strides[i];
+                                out_base += coordinate * outer_out_strides[i];
+                            }
+
+                            size_t row_begin = (tile_index / col_tiles) * tile;
+                            size_t col_begin = (tile_index % col_tiles) * tile;
+                            size_t row_end = std::min(row_begin + tile, rows);
+                            size_t col_end = std::min(col_begin + tile, cols);
+
+                            for (size_t row = row_begin; row < row_end; row++)
+                            {
+                                const ElementType* src = input + in_base + row;
+                                ElementType* dst = output + out_base + row * row_out_stride;
+                                for (size_t col = col_begin; col < col_end; col++)
+                                {
+                                    dst[col] = src[col * col_in_stride];
+                                }
+                            }
+                        }
+                    };
+
+                    eigen::global_thread_pool_device.parallelFor(
+                        tasks,
+                        Eigen::TensorOpCost(bytes_per_task, bytes_per_task, tile * tile),
+                        move_tiles);
+                }
+            }
+        }
+    }
+}
@@ -22,6 +22,7 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_tuning.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -118,16 +119,30 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     mkldnn::primitive_attr conv_attr;
     conv_attr.set_post_ops(pops);
 
+    mkldnn::memory::dims mkldnn_strides(strides.begin(), strides.end());
+    mkldnn::memory::dims mkldnn_dilation_strides(dilation_strides.begin(), dilation_strides.end());
+    mkldnn::memory::dims mkldnn_padding_below(padding_below.begin(), padding_below.end());
+    mkldnn::memory::dims mkldnn_padding_above(padding_above.begin(), padding_above.end());
+    mkldnn::algorithm conv_algorithm =
+        mkldnn_tuning::get_convolution_algorithm(input_data_desc,
+                                                 weights_desc,
+                                                 nullptr,
+                                                 result_desc,
+                                                 mkldnn_strides,
+                                                 mkldnn_dilation_strides,
+                                                 mkldnn_padding_below,
+                                                 mkldnn_padding_above);
+
     size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
         {{mkldnn::prop_kind::forward,
-          mkldnn::algorithm::convolution_direct,
+          conv_algorithm,
           input_data_desc,
           weights_desc,
           result_desc,
-          mkldnn::memory::dims(strides.begin(), strides.end()),
-          mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+          mkldnn_strides,
+          mkldnn_dilation_strides,
+          mkldnn_padding_below,
+          mkldnn_padding_above,
           mkldnn::padding_kind::zero},
          conv_attr,
          mkldnn_utils::global_cpu_engine},
@@ -157,17 +172,31 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     mkldnn::primitive_attr conv_attr;
     conv_attr.set_post_ops(pops);
 
+    mkldnn::memory::dims mkldnn_strides(strides.begin(), strides.end());
+    mkldnn::memory::dims mkldnn_dilation_strides(dilation_strides.begin(), dilation_strides.end());
+    mkldnn::memory::dims mkldnn_padding_below(padding_below.begin(), padding_below.end());
+    mkldnn::memory::dims mkldnn_padding_above(padding_above.begin(), padding_above.end());
+    mkldnn::algorithm conv_algorithm =
+        mkldnn_tuning::get_convolution_algorithm(input_data_desc,
+                                                 weights_desc,
+                                                 &bias_desc,
+                                                 result_desc,
+                                                 mkldnn_strides,
+                                                 mkldnn_dilation_strides,
+                                                 mkldnn_padding_below,
+                                                 mkldnn_padding_above);
+
     const size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
         {{mkldnn::prop_kind::forward,
-          mkldnn::algorithm::convolution_direct,
+          conv_algorithm,
           input_data_desc,
           weights_desc,
           bias_desc,
           result_desc,
-          mkldnn::memory::dims(strides.begin(), strides.end()),
-          mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
-          mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
-          mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+          mkldnn_strides,
+          mkldnn_dilation_strides,
+          mkldnn_padding_below,
+          mkldnn_padding_above,
           mkldnn::padding_kind::zero},
          conv_attr,
          mkldnn_utils::global_cpu_engine},
@@ -0,0 +1,317 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <sys/file.h>
+#include <unistd.h>
+#include <vector>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
+
+#include "mkldnn_tuning.hpp"
+#include "mkldnn_utils.hpp"
+
+using namespace mkldnn;
+using namespace ngraph;
+using namespace std;
+
+// Candidates in order of preference when timings tie
+static const vector<pair<algorithm, string>> s_convolution_algorithms{
+    {algorithm::convolution_direct, "direct"}, {algorithm::convolution_winograd, "winograd"}};
+
+static const size_t s_benchmark_iterations = 5;
+
+static mutex s_tuning_mutex;
+static string s_db_path;
+static map<string, string> s_db;
+
+static const char* get_db_path()
+{
+    return std::getenv("NGRAPH_CPU_CONV_TUNING_DB");
+}
+
+static void append_dims(ostringstream& key, const string& name, const memory::dims& dims)
+{
+    key << " " << name << "=" << join(dims, ",");
+}
+
+static void append_desc(ostringstream& key, const string& name, const memory::desc& desc)
+{
+    const mkldnn_memory_desc_t& data = desc.data;
+    append_dims(key, name, memory::dims(data.dims, data.dims + data.ndims));
+}
+
+// Adds the entries of the database at path to db. A missing or empty file has no entries.
+static void read_db(const string& path, map<string, string>& db)
+{
+    if (!file_util::exists(path))
+    {
+        return;
+    }
+    string text = file_util::read_file_to_string(path);
+    if (text.empty())
+    {
+        return;
+    }
+    try
+    {
+        nlohmann::json j = nlohmann::json::parse(text);
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            db[it.key()] = it.value().get<string>();
+        }
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Ignoring unreadable convolution tuning database " << path << ": "
+                    << e.what();
+    }
+}
+
+// Reads the database if it isn't the one in memory. Must be called with s_tuning_mutex held.
+static void load_db(const string& path)
+{
+    if (path == s_db_path)
+    {
+        return;
+    }
+    s_db_path = path;
+    s_db.clear();
+    read_db(path, s_db);
+}
+
+// Records an entry in the database file, which other processes may be tuning into too. Under
+// an exclusive lock on a companion lock file, the entries on disk are merged with the ones in
+// memory and written to a temporary file that replaces the database, so readers never see a
+// partial file. Must be called with s_tuning_mutex held.
+static void save_db(const string& key, const string& value)
+{
+    string lock_path = s_db_path + ".lock";
+    int lock_fd = open(lock_path.c_str(), O_RDWR | O_CREAT, 0666);
+    if (lock_fd < 0 || flock(lock_fd, LOCK_EX) != 0)
+    {
+        NGRAPH_WARN << "Unable to lock convolution tuning database " << lock_path;
+        if (lock_fd >= 0)
+        {
+            close(lock_fd);
+        }
+        return;
+    }
+
+    read_db(s_db_path, s_db);
+    s_db[key] = value;
+    nlohmann::json j;
+    for (auto& entry : s_db)
+    {
+        j[entry.first] = entry.second;
+    }
+    string temp_path = s_db_path + ".tmp." + to_string(getpid());
+    {
+        ofstream out(temp_path);
+        out << j.dump(4) << "\n";
+        out.close();
+        if (!out || rename(temp_path.c_str(), s_db_path.c_str()) != 0)
+        {
+            NGRAPH_WARN << "Unable to write convolution tuning database " << s_db_path;
+            remove(temp_path.c_str());
+        }
+    }
+
+    flock(lock_fd, LOCK_UN);
+    close(lock_fd);
+}
+
+static memory::desc any_format(const memory::desc& desc)
+{
+    const mkldnn_memory_desc_t& data = desc.data;
+    return memory::desc(memory::dims(data.dims, data.dims + data.ndims),
+                        static_cast<memory::data_type>(data.data_type),
+                        memory::format::any);
+}
+
+static memory make_zeroed_memory(memory::primitive_desc pd)
+{
+    memory m(pd);
+    memset(m.get_data_handle(), 0, pd.get_size());
+    return m;
+}
+
+// Returns the best time of a few runs in microseconds, or the maximum if MKLDNN has no
+// implementation of the algorithm for the signature
+static size_t benchmark_convolution(algorithm conv_algorithm,
+                                    const memory::desc& input_data_desc,
+                                    const memory::desc& weights_desc,
+                                    const memory::desc* bias_desc,
+                                    const memory::desc& result_desc,
+                                    const memory::dims& strides,
+                                    const memory::dims& dilation_strides,
+                                    const memory::dims& padding_below,
+                                    const memory::dims& padding_above)
+{
+    try
+    {
+        unique_ptr<convolution_forward::desc> desc;
+        if (bias_desc)
+        {
+            desc.reset(new convolution_forward::desc(prop_kind::forward,
+                                                     conv_algorithm,
+                                                     any_format(input_data_desc),
+                                                     any_format(weights_desc),
+                                                     any_format(*bias_desc),
+                                                     any_format(result_desc),
+                                                     strides,
+                                                     dilation_strides,
+                                                     padding_below,
+                                                     padding_above,
+                                                     padding_kind::zero));
+        }
+        else
+        {
+            desc.reset(new convolution_forward::desc(prop_kind::forward,
+                                                     conv_algorithm,
+                                                     any_format(input_data_desc),
+                                                     any_format(weights_desc),
+                                                     any_format(result_desc),
+                                                     strides,
+                                                     dilation_strides,
+                                                     padding_below,
+                                                     padding_above,
+                                                     padding_kind::zero));
+        }
+        convolution_forward::primitive_desc pd(*desc,
+                                               runtime::cpu::mkldnn_utils::global_cpu_engine);
+
+        memory input_data = make_zeroed_memory(pd.src_primitive_desc());
+        memory weights = make_zeroed_memory(pd.weights_primitive_desc());
+        memory result = make_zeroed_memory(pd.dst_primitive_desc());
+        unique_ptr<convolution_forward> conv;
+        unique_ptr<memory> bias;
+        if (bias_desc)
+        {
+            bias.reset(new memory(make_zeroed_memory(pd.bias_primitive_desc())));
+            conv.reset(new convolution_forward(pd, input_data, weights, *bias, result));
+        }
+        else
+        {
+            conv.reset(new convolution_forward(pd, input_data, weights, result));
+        }
+
+        // The first run warms up caches and lets MKLDNN finish any lazy initialization
+        stream(stream::kind::eager).submit({*conv}).wait();
+        size_t best = numeric_limits<size_t>::max();
+        for (size_t i = 0; i < s_benchmark_iterations; i++)
+        {
+            stopwatch timer;
+            timer.start();
+            stream(stream::kind::eager).submit({*conv}).wait();
+            timer.stop();
+            best = min(best, timer.get_microseconds());
+        }
+        return best;
+    }
+    catch (const mkldnn::error&)
+    {
+        return numeric_limits<size_t>::max();
+    }
+}
+
+algorithm runtime::cpu::mkldnn_tuning::get_convolution_algorithm(
+    const memory::desc& input_data_desc,
+    const memory::desc& weights_desc,
+    const memory::desc* bias_desc,
+    const memory::desc& result_desc,
+    const memory::dims& strides,
+    const memory::dims& dilation_strides,
+    const memory::dims& padding_below,
+    const memory::dims& padding_above)
+{
+    const char* path = get_db_path();
+    if (path == nullptr)
+    {
+        return algorithm::convolution_direct;
+    }
+
+    ostringstream key;
+    key << "type=" << input_data_desc.data.data_type;
+    append_desc(key, "input", input_data_desc);
+    append_desc(key, "weights", weights_desc);
+    if (bias_desc)
+    {
+        append_desc(key, "bias", *bias_desc);
+    }
+    append_desc(key, "result", result_desc);
+    append_dims(key, "strides", strides);
+    append_dims(key, "dilation", dilation_strides);
+    append_dims(key, "padding_below", padding_below);
+    append_dims(key, "padding_above", padding_above);
+
+    lock_guard<mutex> lock(s_tuning_mutex);
+    load_db(path);
+    auto it = s_db.find(key.str());
+    if (it == s_db.end())
+    {
+        // Another process may have tuned it since the database was read
+        read_db(path, s_db);
+        it = s_db.find(key.str());
+    }
+    if (it != s_db.end())
+    {
+        for (auto& candidate : s_convolution_algorithms)
+        {
+            if (candidate.second == it->second)
+            {
+                return candidate.first;
+            }
+        }
+        NGRAPH_WARN << "Unknown convolution algorithm " << it->second << " in " << path;
+    }
+
+    auto best = s_convolution_algorithms.front();
+    size_t best_time = numeric_limits<size_t>::max();
+    for (auto& candidate : s_convolution_algorithms)
+    {
+        size_t time = benchmark_convolution(candidate.first,
+                                            input_data_desc,
+                                            weights_desc,
+                                            bias_desc,
+                                            result_desc,
+                                            strides,
+                                            dilation_strides,
+                                            padding_below,
+                                            padding_above);
+        NGRAPH_DEBUG << "Convolution " << key.str() << ": " << candidate.second << " " << time
+                     << "us";
+        if (time < best_time)
+        {
+            best = candidate;
+            best_time = time;
+        }
+    }
+
+    save_db(key.str(), best.second);
+    return best.first;
+}
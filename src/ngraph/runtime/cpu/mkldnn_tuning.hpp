@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// Convolution autotuning. When NGRAPH_CPU_CONV_TUNING_DB names a file, the first
+            /// compile that meets a convolution signature (element type, shapes, strides,
+            /// dilation, padding and bias) benchmarks each MKLDNN algorithm for it, with the
+            /// memory formats MKLDNN prefers for that algorithm, and records the fastest in
+            /// the file. Later lookups, including those of other processes that read the same
+            /// file, reuse the recorded choice. Without the variable every convolution is
+            /// direct.
+            namespace mkldnn_tuning
+            {
+                /// Returns the algorithm to build a forward convolution with. Only the dims
+                /// and data types of the descriptors are part of the signature, so the layout
+                /// pass, which passes format::any, and the emitter, which passes the formats
+                /// the layout pass chose, see the same algorithm. bias_desc may be null.
+                /// dilation_strides are in MKLDNN form, i.e. one less than nGraph's.
+                mkldnn::algorithm
+                    get_convolution_algorithm(const mkldnn::memory::desc& input_data_desc,
+                                              const mkldnn::memory::desc& weights_desc,
+                                              const mkldnn::memory::desc* bias_desc,
+                                              const mkldnn::memory::desc& result_desc,
+                                              const mkldnn::memory::dims& strides,
+                                              const mkldnn::memory::dims& dilation_strides,
+                                              const mkldnn::memory::dims& padding_below,
+                                              const mkldnn::memory::dims& padding_above);
+            }
+        }
+    }
+}
@@ -60,6 +60,8 @@ static const std::unordered_set<std::type_index> s_op_registry{
 // Mapping from POD types to MKLDNN data types
 static const std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_data_type_map{
     {element::boolean, mkldnn::memory::data_type::s8},
+    {element::bf16, mkldnn::memory::data_type::data_undef},
+    {element::f16, mkldnn::memory::data_type::data_undef},
     {element::f32, mkldnn::memory::data_type::f32},
     {element::f64, mkldnn::memory::data_type::data_undef},
     {element::i8, mkldnn::memory::data_type::s8},
@@ -73,6 +75,8 @@ static const std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_d
 
 static const std::map<element::Type, const std::string> s_mkldnn_data_type_string_map{
     {element::boolean, "mkldnn::memory::data_type::s8"},
+    {element::bf16, "mkldnn::memory::data_type::data_undef"},
+    {element::f16, "mkldnn::memory::data_type::data_undef"},
     {element::f32, "mkldnn::memory::data_type::f32"},
     {element::f64, "mkldnn::memory::data_type::data_undef"},
     {element::i8, "mkldnn::memory::data_type::s8"},
@@ -200,6 +204,32 @@ bool runtime::cpu::mkldnn_utils::use_mkldnn_kernel(const ngraph::Node* node)
                 ->is_mkldnn_op());
 }
 
+bool runtime::cpu::mkldnn_utils::is_in_place(const ngraph::Node* node)
+{
+    auto op_annotations = static_cast<const ngraph::op::Op*>(node)->get_op_annotations();
+    return (op_annotations &&
+            static_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(op_annotations)
+                ->is_in_place());
+}
+
+// Row-major with no blocking, so that elements can be addressed by their coordinates
+bool runtime::cpu::mkldnn_utils::is_native_layout(const ngraph::descriptor::TensorView& tv)
+{
+    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tv.get_tensor_view_layout().get());
+    if (!cpu_tvl)
+    {
+        return false;
+    }
+    auto rank = tv.get_tensor_view_type()->get_shape().size();
+    if (cpu_tvl->get_axis_order() != runtime::cpu::LayoutDescriptor::create_native_axis_order(rank))
+    {
+        return false;
+    }
+    auto format = cpu_tvl->get_mkldnn_format();
+    return format == memory::format::format_undef ||
+           compare_mkldnn_formats(format, CreateNativeDataFormat(*cpu_tvl));
+}
+
 bool runtime::cpu::mkldnn_utils::compare_mkldnn_formats(mkldnn::memory::format fmt1,
                                                         mkldnn::memory::format fmt2)
 {
@@ -42,6 +42,8 @@ namespace ngraph
                 mkldnn::memory::format get_input_mkldnn_format(const Node* node, size_t index);
                 mkldnn::memory::format get_output_mkldnn_format(const Node* node, size_t index);
                 bool use_mkldnn_kernel(const ngraph::Node* node);
+                bool is_in_place(const ngraph::Node* node);
+                bool is_native_layout(const ngraph::descriptor::TensorView& tv);
                 bool compare_mkldnn_formats(mkldnn::memory::format fmt1,
                                             mkldnn::memory::format fmt2);
                 bool is_mkldnn_filter_format(mkldnn::memory::format fmt);
@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/op/lstm.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks that gates is [N, 4H] and cell_state is [N, H] of the same element type
+static void check_lstm_args(const shared_ptr<Node>& gates,
+                            const shared_ptr<Node>& cell_state,
+                            size_t& batch_size,
+                            size_t& hidden_size)
+{
+    const Shape& gates_shape = gates->get_shape();
+    const Shape& cell_shape = cell_state->get_shape();
+    if (gates_shape.size() != 2 || cell_shape.size() != 2)
+    {
+        throw ngraph_error("LSTM gates and cell state must be matrices");
+    }
+    batch_size = cell_shape[0];
+    hidden_size = cell_shape[1];
+    if (gates_shape[0] != batch_size || gates_shape[1] != 4 * hidden_size)
+    {
+        throw ngraph_error("LSTM gates shape must be [batch, 4 * hidden]");
+    }
+    if (gates->get_element_type() != cell_state->get_element_type())
+    {
+        throw ngraph_error("LSTM gates and cell state element types do not match");
+    }
+}
+
+op::Lstm::Lstm(shared_ptr<Node> gates, shared_ptr<Node> cell_state)
+    : RequiresTensorViewArgs("Lstm", {gates, cell_state})
+{
+    check_lstm_args(gates, cell_state, m_batch_size, m_hidden_size);
+
+    add_output(cell_state->get_element_type(), cell_state->get_shape());
+    add_output(cell_state->get_element_type(), cell_state->get_shape());
+}
+
+op::Lstm::Lstm(shared_ptr<Node> input_gates,
+               shared_ptr<Node> hidden_state,
+               shared_ptr<Node> weights,
+               shared_ptr<Node> cell_state)
+    : RequiresTensorViewArgs("Lstm", {input_gates, hidden_state, weights, cell_state})
+{
+    check_lstm_args(input_gates, cell_state, m_batch_size, m_hidden_size);
+    if (hidden_state->get_shape() != cell_state->get_shape() ||
+        weights->get_shape() != Shape{4 * m_hidden_size, m_hidden_size})
+    {
+        throw ngraph_error(
+            "LSTM hidden state shape must be [batch, hidden] and weights [4 * hidden, hidden]");
+    }
+    if (hidden_state->get_element_type() != cell_state->get_element_type() ||
+        weights->get_element_type() != cell_state->get_element_type())
+    {
+        throw ngraph_error("LSTM hidden state, weights and cell state element types do not match");
+    }
+
+    add_output(cell_state->get_element_type(), cell_state->get_shape());
+    add_output(cell_state->get_element_type(), cell_state->get_shape());
+    add_output(input_gates->get_element_type(), input_gates->get_shape());
+}
+
+shared_ptr<Node> op::Lstm::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() == 2)
+    {
+        return make_shared<Lstm>(new_args.at(0), new_args.at(1));
+    }
+    if (new_args.size() == 4)
+    {
+        return make_shared<Lstm>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+    }
+    throw ngraph_error("Incorrect number of new arguments");
+}
+
+void op::Lstm::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    if (!has_recurrent_weights())
+    {
+        auto gates = get_argument(0);
+        auto cell_state = get_argument(1);
+
+        auto backprop =
+            make_shared<op::LstmBackprop>(gates, cell_state, deltas.at(0), deltas.at(1));
+        adjoints.add_delta(gates, make_shared<op::GetOutputElement>(backprop, 0));
+        adjoints.add_delta(cell_state, make_shared<op::GetOutputElement>(backprop, 1));
+        return;
+    }
+
+    auto input_gates = get_argument(0);
+    auto hidden_state = get_argument(1);
+    auto weights = get_argument(2);
+    auto cell_state = get_argument(3);
+    auto gates = make_shared<op::GetOutputElement>(shared_from_this(), 2);
+
+    auto backprop = make_shared<op::LstmBackprop>(gates, cell_state, deltas.at(0), deltas.at(1));
+    shared_ptr<Node> delta_gates =
+        make_shared<op::GetOutputElement>(backprop, 0) + deltas.at(2);
+    adjoints.add_delta(input_gates, delta_gates);
+    adjoints.add_delta(hidden_state, make_shared<op::Dot>(delta_gates, weights));
+    adjoints.add_delta(
+        weights,
+        make_shared<op::Dot>(make_shared<op::Reshape>(delta_gates,
+                                                      AxisVector{1, 0},
+                                                      Shape{4 * m_hidden_size, m_batch_size}),
+                             hidden_state));
+    adjoints.add_delta(cell_state, make_shared<op::GetOutputElement>(backprop, 1));
+}
+
+op::LstmBackprop::LstmBackprop(shared_ptr<Node> gates,
+                               shared_ptr<Node> cell_state,
+                               shared_ptr<Node> delta_hidden,
+                               shared_ptr<Node> delta_cell)
+    : RequiresTensorViewArgs("LstmBackprop", {gates, cell_state, delta_hidden, delta_cell})
+{
+    check_lstm_args(gates, cell_state, m_batch_size, m_hidden_size);
+    if (delta_hidden->get_shape() != cell_state->get_shape() ||
+        delta_cell->get_shape() != cell_state->get_shape())
+    {
+        throw ngraph_error("LSTM backprop deltas must have the shape of the cell state");
+    }
+
+    add_output(gates->get_element_type(), gates->get_shape());
+    add_output(cell_state->get_element_type(), cell_state->get_shape());
+}
+
+shared_ptr<Node> op::LstmBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 4)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<LstmBackprop>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Fused LSTM cell.
+        ///
+        /// Takes the pre-activation gates \f$[N, 4H]\f$, laid out as the input, forget,
+        /// candidate and output gates along the second axis, and the previous cell state
+        /// \f$c_{t-1}\f$ of shape \f$[N, H]\f$. Computes
+        ///
+        ///     c_t = sigmoid(f) * c_{t-1} + sigmoid(i) * tanh(g)
+        ///     h_t = sigmoid(o) * tanh(c_t)
+        ///
+        /// Output 0 is \f$h_t\f$ and output 1 is \f$c_t\f$.
+        ///
+        /// The second form also takes the previous hidden state \f$h_{t-1}\f$ of shape
+        /// \f$[N, H]\f$ and the recurrent weights \f$W\f$ of shape \f$[4H, H]\f$, and adds
+        /// \f$h_{t-1} W^T\f$ to the given gates itself. Output 2 is then the complete
+        /// pre-activation gates, which the adjoint reads.
+        class Lstm : public util::RequiresTensorViewArgs
+        {
+        public:
+            Lstm(std::shared_ptr<Node> gates, std::shared_ptr<Node> cell_state);
+            Lstm(std::shared_ptr<Node> input_gates,
+                 std::shared_ptr<Node> hidden_state,
+                 std::shared_ptr<Node> weights,
+                 std::shared_ptr<Node> cell_state);
+
+            size_t get_batch_size() const { return m_batch_size; }
+            size_t get_hidden_size() const { return m_hidden_size; }
+            /// \brief Whether the cell multiplies the hidden state by the recurrent weights
+            bool has_recurrent_weights() const { return get_input_size() == 4; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+        private:
+            size_t m_batch_size;
+            size_t m_hidden_size;
+        };
+
+        /// \brief Gradient of the fused LSTM cell.
+        ///
+        /// Takes the forward inputs and the deltas of \f$h_t\f$ and \f$c_t\f$. Output 0 is the
+        /// delta of the gates and output 1 the delta of \f$c_{t-1}\f$.
+        class LstmBackprop : public util::RequiresTensorViewArgs
+        {
+        public:
+            LstmBackprop(std::shared_ptr<Node> gates,
+                         std::shared_ptr<Node> cell_state,
+                         std::shared_ptr<Node> delta_hidden,
+                         std::shared_ptr<Node> delta_cell);
+
+            size_t get_batch_size() const { return m_batch_size; }
+            size_t get_hidden_size() const { return m_hidden_size; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            size_t m_batch_size;
+            size_t m_hidden_size;
+        };
+    }
+}
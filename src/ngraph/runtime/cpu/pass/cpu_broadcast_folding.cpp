@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/descriptor/input.hpp"
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+
+#include "cpu_broadcast_folding.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The consumer's kernel can read a broadcast input at stride 0
+static bool takes_broadcast_input(const shared_ptr<Node>& node)
+{
+    if (!dynamic_pointer_cast<ngraph::op::Add>(node) &&
+        !dynamic_pointer_cast<ngraph::op::Subtract>(node) &&
+        !dynamic_pointer_cast<ngraph::op::Multiply>(node) &&
+        !(dynamic_pointer_cast<ngraph::op::Divide>(node) && node->get_element_type().is_real()))
+    {
+        return false;
+    }
+    if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()) ||
+        !runtime::cpu::mkldnn_utils::is_native_layout(*node->get_output_tensor_view(0)))
+    {
+        return false;
+    }
+    for (const descriptor::Input& input : node->get_inputs())
+    {
+        if (!runtime::cpu::mkldnn_utils::is_native_layout(
+                *input.get_output().get_tensor_view()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUBroadcastFolding::run_on_function(
+    shared_ptr<ngraph::Function> function)
+{
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        auto broadcast = dynamic_pointer_cast<ngraph::op::Broadcast>(node);
+        if (!broadcast || broadcast->get_users().empty() ||
+            !runtime::cpu::mkldnn_utils::is_native_layout(
+                *broadcast->get_inputs().at(0).get_output().get_tensor_view()))
+        {
+            continue;
+        }
+
+        bool fold = true;
+        for (shared_ptr<Node> user : broadcast->get_users())
+        {
+            fold &= takes_broadcast_input(user);
+        }
+        if (!fold)
+        {
+            continue;
+        }
+
+        auto op_annotations = broadcast->get_op_annotations();
+        if (!op_annotations)
+        {
+            op_annotations = std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+            broadcast->set_op_annotations(op_annotations);
+        }
+        static_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(op_annotations)
+            ->set_in_place(true);
+        NGRAPH_DEBUG << "Folded " << broadcast->get_name() << " into its consumers";
+    }
+    return false;
+}
@@ -30,23 +30,28 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 
@@ -389,6 +394,220 @@ static bool
     return true;
 }
 
+// Splits the gates of an LSTM cell into h_{t-1} W^T and the rest when the cell state comes
+// from an already fused cell and the gates are Add(h_{t-1} W^T, x) or Add(Add(h_{t-1} W^T, b), x)
+// in any order, as the MXNet LSTM models produce them. A bias in the MatmulBias of the GEMM
+// moves to the rest.
+static bool split_recurrent_gemm(const std::shared_ptr<ngraph::Node>& gates,
+                                 const std::shared_ptr<ngraph::Node>& cell_state,
+                                 std::shared_ptr<ngraph::Node>& input_gates,
+                                 std::shared_ptr<ngraph::Node>& hidden_state,
+                                 std::shared_ptr<ngraph::Node>& weights)
+{
+    auto cell_output = std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(cell_state);
+    if (!cell_output || cell_output->get_n() != 1)
+    {
+        return false;
+    }
+    // get_argument refuses multi-output arguments
+    auto previous_cell = cell_output->get_inputs().at(0).get_output().get_node();
+    if (!std::dynamic_pointer_cast<ngraph::op::Lstm>(previous_cell))
+    {
+        return false;
+    }
+    const ngraph::Shape& gates_shape = gates->get_shape();
+
+    std::shared_ptr<ngraph::Node> bias;
+    auto is_recurrent = [&](const std::shared_ptr<ngraph::Node>& n) {
+        auto matmul = std::dynamic_pointer_cast<ngraph::op::MatmulBias>(n);
+        if (!matmul || matmul->get_users().size() != 1 || matmul->get_is_arg0_transposed() ||
+            !matmul->get_is_arg1_transposed())
+        {
+            return false;
+        }
+        if (matmul->get_arguments().size() == 3 &&
+            (matmul->get_broadcast_axes() != ngraph::AxisSet{0} ||
+             matmul->get_argument(2)->get_shape() != ngraph::Shape{gates_shape[1]}))
+        {
+            return false;
+        }
+        auto hidden_output =
+            std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(matmul->get_argument(0));
+        if (!hidden_output || hidden_output->get_n() != 0 ||
+            hidden_output->get_inputs().at(0).get_output().get_node() != previous_cell ||
+            matmul->get_argument(1)->get_shape() !=
+                ngraph::Shape{gates_shape[1], gates_shape[1] / 4})
+        {
+            return false;
+        }
+        hidden_state = hidden_output;
+        weights = matmul->get_argument(1);
+        if (matmul->get_arguments().size() == 3)
+        {
+            bias = std::make_shared<ngraph::op::Broadcast>(
+                matmul->get_argument(2), gates_shape, ngraph::AxisSet{0});
+        }
+        return true;
+    };
+
+    // The slices of the gates are their only users, so the sum can be rebuilt without the GEMM
+    if (!std::dynamic_pointer_cast<ngraph::op::Add>(gates) || gates->get_users().size() != 4)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < 2 && !input_gates; i++)
+    {
+        auto term = gates->get_argument(i);
+        auto other = gates->get_argument(1 - i);
+        if (is_recurrent(term))
+        {
+            input_gates = other;
+        }
+        else if (std::dynamic_pointer_cast<ngraph::op::Add>(term) && term->get_users().size() == 1)
+        {
+            for (size_t j = 0; j < 2 && !input_gates; j++)
+            {
+                if (is_recurrent(term->get_argument(j)))
+                {
+                    input_gates =
+                        std::make_shared<ngraph::op::Add>(term->get_argument(1 - j), other);
+                }
+            }
+        }
+    }
+    if (input_gates && bias)
+    {
+        input_gates = std::make_shared<ngraph::op::Add>(input_gates, bias);
+    }
+    return input_gates != nullptr;
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_lstm_cell()
+{
+    auto slice_pred = [](std::shared_ptr<Node> n) {
+        return std::dynamic_pointer_cast<op::Slice>(n) != nullptr;
+    };
+    Shape shape{2, 3};
+    auto input_gate = std::make_shared<pattern::op::Label>(element::f32, shape, slice_pred);
+    auto forget_gate = std::make_shared<pattern::op::Label>(element::f32, shape, slice_pred);
+    auto candidate_gate = std::make_shared<pattern::op::Label>(element::f32, shape, slice_pred);
+    auto output_gate = std::make_shared<pattern::op::Label>(element::f32, shape, slice_pred);
+    auto cell_state = std::make_shared<pattern::op::Label>(element::f32, shape);
+
+    // Activations are wrapped in labels so the callback can check that nothing outside the
+    // cell uses them
+    auto input_sigmoid = std::make_shared<op::Sigmoid>(input_gate);
+    auto input_label =
+        std::make_shared<pattern::op::Label>(input_sigmoid, nullptr, NodeVector{input_sigmoid});
+    auto forget_sigmoid = std::make_shared<op::Sigmoid>(forget_gate);
+    auto forget_label =
+        std::make_shared<pattern::op::Label>(forget_sigmoid, nullptr, NodeVector{forget_sigmoid});
+    auto candidate_tanh = std::make_shared<op::Tanh>(candidate_gate);
+    auto candidate_label =
+        std::make_shared<pattern::op::Label>(candidate_tanh, nullptr, NodeVector{candidate_tanh});
+    auto output_sigmoid = std::make_shared<op::Sigmoid>(output_gate);
+    auto output_label =
+        std::make_shared<pattern::op::Label>(output_sigmoid, nullptr, NodeVector{output_sigmoid});
+
+    auto forget = std::make_shared<op::Multiply>(forget_label, cell_state);
+    auto forget_product = std::make_shared<pattern::op::Label>(forget, nullptr, NodeVector{forget});
+    auto input = std::make_shared<op::Multiply>(input_label, candidate_label);
+    auto input_product = std::make_shared<pattern::op::Label>(input, nullptr, NodeVector{input});
+    auto cell = std::make_shared<op::Add>(forget_product, input_product);
+    auto cell_label = std::make_shared<pattern::op::Label>(cell, nullptr, NodeVector{cell});
+    auto hidden =
+        std::make_shared<op::Multiply>(output_label, std::make_shared<op::Tanh>(cell_label));
+
+    pattern::graph_rewrite_callback callback = [input_gate,
+                                                forget_gate,
+                                                candidate_gate,
+                                                output_gate,
+                                                cell_state,
+                                                input_label,
+                                                forget_label,
+                                                candidate_label,
+                                                output_label,
+                                                forget_product,
+                                                input_product,
+                                                cell_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_lstm_cell against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        if (m.get_match_root()->get_element_type() != element::f32)
+        {
+            NGRAPH_DEBUG << "LSTM cell isn't of type float";
+            return false;
+        }
+
+        for (auto label : {input_label,
+                           forget_label,
+                           candidate_label,
+                           output_label,
+                           forget_product,
+                           input_product})
+        {
+            if (pattern_map[label]->get_users().size() > 1)
+            {
+                NGRAPH_DEBUG << pattern_map[label]->get_name() << " is used outside the cell";
+                return false;
+            }
+        }
+
+        // The gates must be consecutive column blocks of one [N, 4H] matrix, in the order
+        // input, forget, candidate, output
+        auto gates = pattern_map[input_gate]->get_argument(0);
+        const Shape& gates_shape = gates->get_shape();
+        const Shape& cell_shape = pattern_map[cell_state]->get_shape();
+        if (gates_shape.size() != 2 || cell_shape.size() != 2 ||
+            gates_shape[0] != cell_shape[0] || gates_shape[1] != 4 * cell_shape[1])
+        {
+            NGRAPH_DEBUG << "LSTM gates aren't a [N, 4H] matrix";
+            return false;
+        }
+        size_t batch_size = cell_shape[0];
+        size_t hidden_size = cell_shape[1];
+        std::shared_ptr<pattern::op::Label> gate_labels[] = {
+            input_gate, forget_gate, candidate_gate, output_gate};
+        for (size_t i = 0; i < 4; i++)
+        {
+            auto slice = std::static_pointer_cast<op::Slice>(pattern_map[gate_labels[i]]);
+            if (slice->get_argument(0) != gates ||
+                slice->get_lower_bounds() != Coordinate{0, i * hidden_size} ||
+                slice->get_upper_bounds() != Coordinate{batch_size, (i + 1) * hidden_size} ||
+                slice->get_strides() != Strides{1, 1})
+            {
+                NGRAPH_DEBUG << slice->get_name() << " isn't gate " << i << " of "
+                             << gates->get_name();
+                return false;
+            }
+        }
+
+        std::shared_ptr<Node> lstm;
+        std::shared_ptr<Node> input_gates;
+        std::shared_ptr<Node> hidden_state;
+        std::shared_ptr<Node> weights;
+        if (split_recurrent_gemm(
+                gates, pattern_map[cell_state], input_gates, hidden_state, weights))
+        {
+            lstm = std::make_shared<op::Lstm>(
+                input_gates, hidden_state, weights, pattern_map[cell_state]);
+        }
+        else
+        {
+            lstm = std::make_shared<op::Lstm>(gates, pattern_map[cell_state]);
+        }
+        auto hidden_output = std::make_shared<op::GetOutputElement>(lstm, 0);
+        auto cell_output = std::make_shared<op::GetOutputElement>(lstm, 1);
+        ngraph::replace_node(pattern_map[cell_label], cell_output);
+        ngraph::replace_node(m.get_match_root(), hidden_output);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(hidden, callback);
+    this->add_matcher(m);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_zero_padded_reshaped_conv()
 {
     auto pad_input = std::make_shared<pattern::op::Label>(element::f32, Shape{});
@@ -943,3 +1162,43 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_relu()
     auto m = std::make_shared<pattern::Matcher>(prelu, callback);
     this->add_matcher(m);
 }
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_embedding_lookup()
+{
+    auto indices = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto table = std::make_shared<pattern::op::Label>(element::f32, Shape{8, 2});
+
+    auto one_hot = std::make_shared<op::OneHot>(indices, Shape{4, 8}, 1);
+    auto dot = std::make_shared<op::Dot>(one_hot, table);
+
+    pattern::graph_rewrite_callback callback = [indices, table](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_embedding_lookup against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto dot_m = std::dynamic_pointer_cast<op::Dot>(m.get_match_root());
+        auto one_hot_m = std::dynamic_pointer_cast<op::OneHot>(dot_m->get_argument(0));
+
+        // Only a one-hot encoding along the last axis, contracted against the rows of the
+        // table, selects one row of the table per index
+        if (dot_m->get_reduction_axes_count() != 1)
+        {
+            NGRAPH_DEBUG << "Dot doesn't reduce exactly one axis";
+            return false;
+        }
+
+        if (one_hot_m->get_one_hot_axis() != one_hot_m->get_shape().size() - 1)
+        {
+            NGRAPH_DEBUG << "OneHot isn't along the last axis";
+            return false;
+        }
+
+        auto lookup =
+            std::make_shared<op::EmbeddingLookup>(pattern_map[indices], pattern_map[table]);
+        ngraph::replace_node(m.get_match_root(), lookup);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(dot, callback);
+    this->add_matcher(m);
+}
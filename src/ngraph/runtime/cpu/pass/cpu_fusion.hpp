@@ -59,6 +59,7 @@ public:
             construct_zero_padded_conv_backprop_filters();
             construct_sigmoid();
             construct_sigmoid_bprop();
+            construct_lstm_cell();
 
             construct_batch_norm_relu();
             construct_batch_norm_relu_global_stats();
@@ -68,6 +69,7 @@ public:
         if (fusions & DIFFERENTIABLE_FUSIONS)
         {
             construct_conv_bias();
+            construct_embedding_lookup();
         }
     }
 
@@ -78,10 +80,12 @@ private:
     void construct_fprop_bn();
     void construct_sigmoid();
     void construct_sigmoid_bprop();
+    void construct_lstm_cell();
     void construct_zero_padded_reshaped_conv();
     void construct_zero_padded_conv();
     void construct_zero_padded_conv_backprop_filters();
     void construct_batch_norm_relu();
     void construct_batch_norm_relu_global_stats();
     void construct_conv_relu();
+    void construct_embedding_lookup();
 };
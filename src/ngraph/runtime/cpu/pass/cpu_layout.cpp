@@ -38,6 +38,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/mkldnn_tuning.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
@@ -280,9 +281,19 @@ namespace ngraph
                         auto arg2_shape = node->get_input_shape(2);
                         memory::dims mkldnn_arg2_shape(arg2_shape.begin(), arg2_shape.end());
                         const memory::desc bias_desc(mkldnn_arg2_shape, et, memory::format::any);
+                        algorithm conv_algorithm =
+                            runtime::cpu::mkldnn_tuning::get_convolution_algorithm(
+                                input_data_desc,
+                                weights_desc,
+                                &bias_desc,
+                                result_desc,
+                                mkldnn_filter_strides,
+                                mkldnn_dilated_strides,
+                                mkldnn_padding_below,
+                                mkldnn_padding_above);
 
                         fwd_desc.reset(new convolution_forward::desc(prop_kind::forward,
-                                                                     algorithm::convolution_direct,
+                                                                     conv_algorithm,
                                                                      input_data_desc,
                                                                      weights_desc,
                                                                      bias_desc, // with bias
@@ -295,8 +306,19 @@ namespace ngraph
                     }
                     else
                     {
+                        algorithm conv_algorithm =
+                            runtime::cpu::mkldnn_tuning::get_convolution_algorithm(
+                                input_data_desc,
+                                weights_desc,
+                                nullptr,
+                                result_desc,
+                                mkldnn_filter_strides,
+                                mkldnn_dilated_strides,
+                                mkldnn_padding_below,
+                                mkldnn_padding_above);
+
                         fwd_desc.reset(new convolution_forward::desc(prop_kind::forward,
-                                                                     algorithm::convolution_direct,
+                                                                     conv_algorithm,
                                                                      input_data_desc,
                                                                      weights_desc,
                                                                      result_desc,
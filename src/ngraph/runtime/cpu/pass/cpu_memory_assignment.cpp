@@ -0,0 +1,370 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ngraph/descriptor/input.hpp"
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/util.hpp"
+
+#include "cpu_memory_assignment.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Tensors that share one pool allocation. The buffer is either the output of an in-place
+    // Concat, whose inputs are written directly into it, or a tensor that views alias.
+    struct InPlaceGroup
+    {
+        descriptor::Tensor* buffer;
+        vector<pair<descriptor::Tensor*, size_t>> members; // tensor, byte offset in buffer
+        size_t live_members;
+        bool allocated;
+        size_t pool_offset;
+    };
+}
+
+// The tensor is allocated from the pool by its producer and does not leave the function
+static bool is_pool_temporary(descriptor::Output& output)
+{
+    if (!contains(output.get_node()->liveness_new_list, &output.get_tensor()))
+    {
+        return false;
+    }
+    for (descriptor::Input* input : output.get_inputs())
+    {
+        // Results that do not copy make their argument write to the function output
+        if (dynamic_pointer_cast<ngraph::op::Result>(input->get_node()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// If the output of a Reshape or Slice is a contiguous block of its input, return true and set
+// view_offset to the block's byte offset in the input
+static bool is_view(const Node* node, size_t& view_offset)
+{
+    if (auto reshape = dynamic_cast<const ngraph::op::Reshape*>(node))
+    {
+        const AxisVector& input_order = reshape->get_input_order();
+        view_offset = 0;
+        return is_sorted(input_order.begin(), input_order.end());
+    }
+
+    auto slice = dynamic_cast<const ngraph::op::Slice*>(node);
+    if (!slice)
+    {
+        return false;
+    }
+    for (size_t stride : slice->get_strides())
+    {
+        if (stride != 1)
+        {
+            return false;
+        }
+    }
+
+    // Find the innermost axis that is not taken whole; every axis ahead of it must have
+    // extent one for the slice to be contiguous
+    const Shape& arg_shape = slice->get_input_shape(0);
+    const Coordinate& lower_bounds = slice->get_lower_bounds();
+    const Coordinate& upper_bounds = slice->get_upper_bounds();
+    size_t partial_axis = arg_shape.size();
+    for (size_t i = arg_shape.size(); i-- > 0;)
+    {
+        if (lower_bounds[i] != 0 || upper_bounds[i] != arg_shape[i])
+        {
+            partial_axis = i;
+            break;
+        }
+    }
+    for (size_t i = 0; i < partial_axis; i++)
+    {
+        if (upper_bounds[i] - lower_bounds[i] != 1)
+        {
+            return false;
+        }
+    }
+
+    Strides arg_strides = row_major_strides(arg_shape);
+    view_offset = 0;
+    for (size_t i = 0; i < arg_shape.size(); i++)
+    {
+        view_offset += lower_bounds[i] * arg_strides[i];
+    }
+    view_offset *= slice->get_element_type().size();
+    return true;
+}
+
+static void set_in_place(const shared_ptr<Node>& node)
+{
+    auto op = static_pointer_cast<ngraph::op::Op>(node);
+    auto op_annotations = op->get_op_annotations();
+    if (!op_annotations)
+    {
+        op_annotations = std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+        op->set_op_annotations(op_annotations);
+    }
+    static_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(op_annotations)
+        ->set_in_place(true);
+}
+
+runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
+    CPU_ExternalFunction* external_function, size_t alignment, bool disable_memory_sharing)
+    : m_external_function(external_function)
+    , m_alignment(alignment)
+    , m_disable_memory_sharing(disable_memory_sharing)
+{
+}
+
+// Adds alias at byte offset view_offset into arg. The alias joins the group of arg, which keeps
+// the buffer alive for as long as the alias is.
+static void add_alias(list<InPlaceGroup>& groups,
+                      unordered_map<descriptor::Tensor*, InPlaceGroup*>& tensor_groups,
+                      descriptor::Tensor* arg,
+                      descriptor::Tensor* alias,
+                      size_t view_offset)
+{
+    InPlaceGroup* group;
+    size_t arg_offset = 0;
+    auto it = tensor_groups.find(arg);
+    if (it == tensor_groups.end())
+    {
+        groups.push_back(InPlaceGroup());
+        group = &groups.back();
+        group->buffer = arg;
+        group->members.push_back({arg, 0});
+        group->allocated = false;
+        group->pool_offset = 0;
+        tensor_groups[arg] = group;
+    }
+    else
+    {
+        group = it->second;
+        for (auto& member : group->members)
+        {
+            if (member.first == arg)
+            {
+                arg_offset = member.second;
+            }
+        }
+    }
+    group->members.push_back({alias, arg_offset + view_offset});
+    tensor_groups[alias] = group;
+}
+
+bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(
+    shared_ptr<ngraph::Function> function)
+{
+    list<InPlaceGroup> groups;
+    unordered_map<descriptor::Tensor*, InPlaceGroup*> tensor_groups;
+    unordered_set<descriptor::Tensor*> unallocated;
+    size_t eliminated_bytes = 0;
+    size_t eliminated_copies = 0;
+
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<ngraph::op::Broadcast>(node) &&
+            runtime::cpu::mkldnn_utils::is_in_place(node.get()))
+        {
+            // Folded by CPUBroadcastFolding; consumers read the input directly, so the output
+            // needs no memory but must keep a temporary input alive
+            descriptor::Output& output = node->get_outputs().at(0);
+            descriptor::Output& arg = node->get_inputs().at(0).get_output();
+            if (is_pool_temporary(arg))
+            {
+                add_alias(groups, tensor_groups, &arg.get_tensor(), &output.get_tensor(), 0);
+            }
+            else
+            {
+                unallocated.insert(&output.get_tensor());
+            }
+            eliminated_copies++;
+            continue;
+        }
+
+        size_t view_offset;
+        if (is_view(node.get(), view_offset))
+        {
+            descriptor::Output& output = node->get_outputs().at(0);
+            descriptor::Output& arg = node->get_inputs().at(0).get_output();
+            if (view_offset % s_sub_block_alignment != 0 || !is_pool_temporary(output) ||
+                !is_pool_temporary(arg) ||
+                !runtime::cpu::mkldnn_utils::is_native_layout(*output.get_tensor_view()) ||
+                !runtime::cpu::mkldnn_utils::is_native_layout(*arg.get_tensor_view()))
+            {
+                continue;
+            }
+
+            add_alias(
+                groups, tensor_groups, &arg.get_tensor(), &output.get_tensor(), view_offset);
+            set_in_place(node);
+            NGRAPH_DEBUG << node->get_name() << " is a view of " << arg.get_node()->get_name();
+            eliminated_copies++;
+            continue;
+        }
+
+        auto concat = dynamic_pointer_cast<ngraph::op::Concat>(node);
+        if (!concat)
+        {
+            continue;
+        }
+
+        // The inputs are contiguous sub-blocks of the output only if every axis ahead of
+        // the concatenation axis has length one
+        const Shape& result_shape = concat->get_output_shape(0);
+        size_t axis = concat->get_concatenation_axis();
+        if (shape_size(Shape(result_shape.begin(), result_shape.begin() + axis)) != 1)
+        {
+            continue;
+        }
+
+        descriptor::Output& output = concat->get_outputs().at(0);
+        if (!is_pool_temporary(output) ||
+            !runtime::cpu::mkldnn_utils::is_native_layout(*output.get_tensor_view()) ||
+            contains_key(tensor_groups, &output.get_tensor()))
+        {
+            continue;
+        }
+
+        InPlaceGroup group;
+        group.buffer = &output.get_tensor();
+        group.members.push_back({group.buffer, 0});
+        group.allocated = false;
+        group.pool_offset = 0;
+
+        bool in_place = true;
+        size_t byte_offset = 0;
+        for (descriptor::Input& input : concat->get_inputs())
+        {
+            descriptor::Output& arg = input.get_output();
+            descriptor::Tensor* tensor = &arg.get_tensor();
+            bool repeated = false;
+            for (auto& member : group.members)
+            {
+                repeated |= (member.first == tensor);
+            }
+            if (repeated || byte_offset % s_sub_block_alignment != 0 ||
+                !is_pool_temporary(arg) ||
+                !runtime::cpu::mkldnn_utils::is_native_layout(*arg.get_tensor_view()) ||
+                contains_key(tensor_groups, tensor))
+            {
+                in_place = false;
+                break;
+            }
+            group.members.push_back({tensor, byte_offset});
+            byte_offset += tensor->size();
+        }
+        if (!in_place)
+        {
+            continue;
+        }
+
+        groups.push_back(group);
+        for (auto& member : groups.back().members)
+        {
+            tensor_groups[member.first] = &groups.back();
+        }
+
+        set_in_place(node);
+        NGRAPH_DEBUG << "Concat " << concat->get_name() << " is computed in place";
+        eliminated_bytes += group.buffer->size();
+        eliminated_copies++;
+    }
+    for (InPlaceGroup& group : groups)
+    {
+        group.live_members = group.members.size();
+    }
+
+    ngraph::pass::MemoryManager mm(m_alignment);
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            if (contains(unallocated, tensor))
+            {
+                continue;
+            }
+            auto it = tensor_groups.find(tensor);
+            if (it == tensor_groups.end())
+            {
+                tensor->set_pool_offset(mm.allocate(tensor->size()));
+                continue;
+            }
+
+            // The first member to come alive allocates the whole group
+            InPlaceGroup& group = *it->second;
+            if (!group.allocated)
+            {
+                group.pool_offset = mm.allocate(group.buffer->size());
+                group.allocated = true;
+                for (auto& member : group.members)
+                {
+                    member.first->set_pool_offset(group.pool_offset + member.second);
+                }
+            }
+        }
+        if (!m_disable_memory_sharing)
+        {
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
+            {
+                if (contains(unallocated, tensor))
+                {
+                    continue;
+                }
+                auto it = tensor_groups.find(tensor);
+                if (it == tensor_groups.end())
+                {
+                    mm.free(tensor->get_pool_offset());
+                }
+                else if (--it->second->live_members == 0)
+                {
+                    mm.free(it->second->pool_offset);
+                }
+            }
+        }
+    }
+    function->set_temporary_pool_size(mm.max_allocated());
+
+    if (eliminated_copies > 0)
+    {
+        NGRAPH_DEBUG << function->get_name() << ": " << eliminated_copies
+                     << " copies eliminated, " << eliminated_bytes << " bytes by in-place Concat";
+        m_external_function->add_eliminated_copies(eliminated_copies);
+        m_external_function->add_concat_bytes_eliminated(eliminated_bytes);
+    }
+
+    return false;
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Assigns pool offsets to the temporaries of a function.
+                ///
+                /// Works like ngraph::pass::MemoryLayout, except that when the inputs of a
+                /// Concat are contiguous sub-blocks of its output, their producers are placed
+                /// directly inside the Concat's buffer, and Slices and Reshapes whose output
+                /// is a contiguous block of their input alias that input, which then stays
+                /// allocated for as long as the alias is live. Such ops are annotated as in
+                /// place so that the emitter skips the copy. Broadcasts folded by
+                /// CPUBroadcastFolding get no memory of their own.
+                class CPUMemoryAssignment : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUMemoryAssignment(CPU_ExternalFunction* external_function,
+                                        size_t alignment = 1,
+                                        bool disable_memory_sharing = false);
+                    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+                    /// In-place sub-blocks and views must start on this byte boundary since some
+                    /// kernels emit aligned Eigen maps for their outputs.
+                    static const size_t s_sub_block_alignment = 64;
+
+                private:
+                    CPU_ExternalFunction* m_external_function;
+                    size_t m_alignment;
+                    bool m_disable_memory_sharing;
+                };
+            }
+        }
+    }
+}
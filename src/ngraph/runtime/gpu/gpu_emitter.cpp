@@ -31,6 +31,7 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/add_n.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/asin.hpp"
 #include "ngraph/op/atan.hpp"
@@ -179,6 +180,42 @@ CUDNN_SAFE_CALL(cudnnSetOpTensorDescriptor(opTensorDesc,
                 writer.block_end();
             }
 
+            template <>
+            void GPU_Emitter::EMITTER_DECL(ngraph::op::AddN)
+            {
+                if (out[0].get_size() == 0)
+                {
+                    return;
+                }
+                writer.block_begin("  // " + node->get_name());
+                writer << "int count = " << out[0].get_size() << ";\n";
+                writer += R"(
+float alpha = 1.0, beta = 0;
+auto& descriptor = descriptors.build<cudnnTensorDescriptor_t>();
+CUDNN_SAFE_CALL(cudnnSetTensor4dDescriptor(descriptor,
+                            /*format=*/CUDNN_TENSOR_NCHW,
+                            /*dataType=*/CUDNN_DATA_FLOAT,
+                            /*batch_size=*/1,
+                            /*channels=*/1,
+                            /*image_height=*/1,
+                            /*image_width=*/count));
+    )";
+                // out = arg0, then out += arg_i
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    writer << "CUDNN_SAFE_CALL(cudnnAddTensor(*ctx->cudnn_handle,"
+                           << "&alpha,"
+                           << "descriptor," << args[i].get_name() << ","
+                           << "&beta,"
+                           << "descriptor," << out[0].get_name() << "));\n";
+                    if (i == 0)
+                    {
+                        writer << "beta = 1.0;\n";
+                    }
+                }
+                writer.block_end();
+            }
+
             template <>
             void GPU_Emitter::EMITTER_DECL(ngraph::op::Convolution)
             {
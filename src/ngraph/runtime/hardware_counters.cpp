@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/hardware_counters.hpp"
+
+#ifdef __linux__
+#include <cstring>
+#include <initializer_list>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace ngraph;
+
+#ifdef __linux__
+namespace
+{
+    // One event group per thread so that a single read() returns all counters consistently.
+    class ThreadCounters
+    {
+    public:
+        ThreadCounters()
+        {
+            m_leader = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+            if (m_leader < 0)
+            {
+                return;
+            }
+            m_instructions = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, m_leader);
+            m_llc_misses = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, m_leader);
+            ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+
+        ~ThreadCounters()
+        {
+            for (int fd : {m_llc_misses, m_instructions, m_leader})
+            {
+                if (fd >= 0)
+                {
+                    close(fd);
+                }
+            }
+        }
+
+        bool is_available() const { return m_leader >= 0; }
+        runtime::HardwareCounterValues read() const
+        {
+            runtime::HardwareCounterValues values;
+            if (m_leader < 0)
+            {
+                return values;
+            }
+            // PERF_FORMAT_GROUP layout: count, then one value per event in creation order
+            uint64_t data[4] = {0, 0, 0, 0};
+            if (::read(m_leader, data, sizeof(data)) < 0)
+            {
+                return values;
+            }
+            size_t index = 1;
+            values.cycles = data[index++];
+            if (m_instructions >= 0)
+            {
+                values.instructions = data[index++];
+            }
+            if (m_llc_misses >= 0)
+            {
+                values.llc_misses = data[index++];
+            }
+            return values;
+        }
+
+    private:
+        static int open_event(uint32_t type, uint64_t config, int group)
+        {
+            struct perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = (group < 0 ? 1 : 0);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+        }
+
+        int m_leader = -1;
+        int m_instructions = -1;
+        int m_llc_misses = -1;
+    };
+
+    const ThreadCounters& get_thread_counters()
+    {
+        thread_local ThreadCounters counters;
+        return counters;
+    }
+}
+
+runtime::HardwareCounterValues runtime::HardwareCounters::read()
+{
+    return get_thread_counters().read();
+}
+
+bool runtime::HardwareCounters::is_available()
+{
+    return get_thread_counters().is_available();
+}
+#else
+runtime::HardwareCounterValues runtime::HardwareCounters::read()
+{
+    return HardwareCounterValues();
+}
+
+bool runtime::HardwareCounters::is_available()
+{
+    return false;
+}
+#endif
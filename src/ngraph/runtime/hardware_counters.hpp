@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Hardware event counts; all zero when counters are unavailable.
+        struct HardwareCounterValues
+        {
+            uint64_t cycles = 0;
+            uint64_t instructions = 0;
+            uint64_t llc_misses = 0;
+
+            HardwareCounterValues& operator+=(const HardwareCounterValues& other)
+            {
+                cycles += other.cycles;
+                instructions += other.instructions;
+                llc_misses += other.llc_misses;
+                return *this;
+            }
+
+            HardwareCounterValues operator-(const HardwareCounterValues& other) const
+            {
+                HardwareCounterValues rc;
+                rc.cycles = cycles - other.cycles;
+                rc.instructions = instructions - other.instructions;
+                rc.llc_misses = llc_misses - other.llc_misses;
+                return rc;
+            }
+        };
+
+        /// \brief Cycles, instructions and last-level cache misses of the calling thread, read
+        ///        from Linux perf events.
+        ///
+        /// The counters are opened on first use by each thread. They are unavailable on other
+        /// platforms and when perf events are restricted (see
+        /// /proc/sys/kernel/perf_event_paranoid), in which case every read returns zeros. Work
+        /// that a kernel hands to other threads is not counted.
+        class HardwareCounters
+        {
+        public:
+            /// \brief Reads the running totals of the calling thread.
+            static HardwareCounterValues read();
+
+            /// \brief True if the calling thread's counters could be opened.
+            static bool is_available();
+        };
+    }
+}
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/pass/assign_placement.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/host_tensor_view.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const size_t s_boundary = numeric_limits<size_t>::max();
+
+runtime::hybrid::HybridBackend::HybridBackend(
+    const function<Placement(shared_ptr<Node>)>& placement_policy, const BackendMap& backends)
+    : m_backends(backends)
+{
+    m_assign_placement = [placement_policy](shared_ptr<Function> func) {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AssignPlacement>(placement_policy);
+        pass_manager.run_passes(func);
+    };
+}
+
+runtime::hybrid::HybridBackend::HybridBackend(const vector<pass::DeviceModel>& devices,
+                                              const pass::TransferModel& transfer,
+                                              const BackendMap& backends)
+    : m_backends(backends)
+{
+    m_assign_placement = [devices, transfer](shared_ptr<Function> func) {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CostModelPlacement>(devices, transfer);
+        pass_manager.run_passes(func);
+    };
+}
+
+shared_ptr<runtime::TensorView>
+    runtime::hybrid::HybridBackend::create_tensor(const element::Type& element_type,
+                                                  const Shape& shape)
+{
+    return make_shared<HostTensorView>(element_type, shape, "external");
+}
+
+shared_ptr<runtime::TensorView> runtime::hybrid::HybridBackend::create_tensor(
+    const element::Type& element_type, const Shape& shape, void* memory_pointer)
+{
+    return make_shared<HostTensorView>(element_type, shape, memory_pointer, "external");
+}
+
+shared_ptr<runtime::Backend> runtime::hybrid::HybridBackend::get_backend(Placement placement)
+{
+    auto it = m_backends.find(placement);
+    if (it == m_backends.end())
+    {
+        it = m_backends.insert({placement, Backend::create(placement_to_string(placement))}).first;
+    }
+    return it->second;
+}
+
+bool runtime::hybrid::HybridBackend::compile(shared_ptr<Function> func)
+{
+    if (m_function_map.count(func) != 0)
+    {
+        return true;
+    }
+
+    FunctionInstance instance;
+    instance.m_function = clone_function(*func);
+    m_assign_placement(instance.m_function);
+
+    vector<shared_ptr<Function>> sub_functions;
+    unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> map_parameter_to_result;
+    tie(sub_functions, map_parameter_to_result) =
+        split_function_by_placement(instance.m_function);
+
+    unordered_map<const Node*, size_t> input_index;
+    for (size_t i = 0; i < instance.m_function->get_parameters().size(); i++)
+    {
+        input_index[instance.m_function->get_parameters()[i].get()] = i;
+    }
+    unordered_map<const Node*, size_t> output_index;
+    for (size_t i = 0; i < instance.m_function->get_results().size(); i++)
+    {
+        output_index[instance.m_function->get_results()[i].get()] = i;
+    }
+
+    // One buffer per Result that other sub-functions read
+    unordered_map<const Node*, void*> boundary_buffers;
+    auto get_buffer = [&](const Node* result) {
+        auto it = boundary_buffers.find(result);
+        if (it == boundary_buffers.end())
+        {
+            size_t size = shape_size(result->get_shape()) * result->get_element_type().size();
+            auto buffer = make_shared<AlignedBuffer>(size, runtime::alignment);
+            instance.m_buffers.push_back(buffer);
+            it = boundary_buffers.insert({result, buffer->get_ptr()}).first;
+        }
+        return it->second;
+    };
+
+    for (shared_ptr<Function> sub_function : sub_functions)
+    {
+        SubFunction sub;
+        sub.function = sub_function;
+        sub.backend = get_backend(get_colocated_function_placement(sub_function));
+        sub.backend->compile(sub_function);
+
+        for (shared_ptr<op::Parameter> param : sub_function->get_parameters())
+        {
+            auto it = input_index.find(param.get());
+            if (it != input_index.end())
+            {
+                sub.inputs.push_back({it->second, nullptr});
+            }
+            else
+            {
+                void* buffer = get_buffer(map_parameter_to_result.at(param).get());
+                sub.inputs.push_back(
+                    {s_boundary,
+                     sub.backend->create_tensor(
+                         param->get_element_type(), param->get_shape(), buffer)});
+            }
+        }
+        for (shared_ptr<op::Result> result : sub_function->get_results())
+        {
+            auto it = output_index.find(result.get());
+            if (it != output_index.end())
+            {
+                sub.outputs.push_back({it->second, nullptr});
+            }
+            else
+            {
+                void* buffer = get_buffer(result.get());
+                sub.outputs.push_back(
+                    {s_boundary,
+                     sub.backend->create_tensor(
+                         result->get_element_type(), result->get_shape(), buffer)});
+            }
+        }
+        instance.m_sub_functions.push_back(sub);
+    }
+
+    m_function_map.insert({func, instance});
+    return true;
+}
+
+bool runtime::hybrid::HybridBackend::call(shared_ptr<Function> func,
+                                          const vector<shared_ptr<TensorView>>& outputs,
+                                          const vector<shared_ptr<TensorView>>& inputs)
+{
+    validate_call(func, outputs, inputs);
+    compile(func);
+    FunctionInstance& instance = m_function_map.at(func);
+
+    // Every sub-function backend wraps the caller's host memory in a tensor of its own.
+    auto bind = [](const SubFunction& sub,
+                   const vector<Binding>& bindings,
+                   const vector<shared_ptr<TensorView>>& tensors) {
+        vector<shared_ptr<TensorView>> bound;
+        for (const Binding& binding : bindings)
+        {
+            if (binding.tensor)
+            {
+                bound.push_back(binding.tensor);
+                continue;
+            }
+            auto tensor = tensors.at(binding.index);
+            auto host_tensor = dynamic_pointer_cast<HostTensorView>(tensor);
+            if (!host_tensor)
+            {
+                throw runtime_error("HybridBackend needs tensors made by its create_tensor");
+            }
+            bound.push_back(sub.backend->create_tensor(tensor->get_tensor().get_element_type(),
+                                                       tensor->get_shape(),
+                                                       host_tensor->get_data_ptr()));
+        }
+        return bound;
+    };
+
+    for (const SubFunction& sub : instance.m_sub_functions)
+    {
+        sub.backend->call(
+            sub.function, bind(sub, sub.outputs, outputs), bind(sub, sub.inputs, inputs));
+    }
+    return true;
+}
+
+void runtime::hybrid::HybridBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end())
+    {
+        for (const SubFunction& sub : it->second.m_sub_functions)
+        {
+            sub.backend->remove_compiled_function(sub.function);
+        }
+        m_function_map.erase(it);
+    }
+}
+
+vector<shared_ptr<Function>>
+    runtime::hybrid::HybridBackend::get_sub_functions(shared_ptr<Function> func)
+{
+    compile(func);
+    vector<shared_ptr<Function>> sub_functions;
+    for (const SubFunction& sub : m_function_map.at(func).m_sub_functions)
+    {
+        sub_functions.push_back(sub.function);
+    }
+    return sub_functions;
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ngraph/pass/cost_model_placement.hpp"
+#include "ngraph/placement.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class HybridBackend;
+        }
+    }
+}
+
+/// @brief Runs each function split across several backends by the placement of its ops.
+///
+/// The function is cloned, placed, split with split_function_by_placement and each
+/// sub-function compiled on the backend for its placement. Backends not given explicitly are
+/// created by placement name. Every backend must address host memory, as CPU and INTERPRETER
+/// do: tensors are host tensors, and each tensor passed between sub-functions lives in one
+/// buffer that both backends wrap, so it crosses without a copy.
+class ngraph::runtime::hybrid::HybridBackend : public Backend
+{
+public:
+    using BackendMap = std::map<Placement, std::shared_ptr<Backend>>;
+
+    /// @brief Place each op where placement_policy says.
+    HybridBackend(const std::function<Placement(std::shared_ptr<Node>)>& placement_policy,
+                  const BackendMap& backends = BackendMap());
+
+    /// @brief Place ops with pass::CostModelPlacement to minimize the estimated time.
+    HybridBackend(const std::vector<pass::DeviceModel>& devices,
+                  const pass::TransferModel& transfer = pass::TransferModel(),
+                  const BackendMap& backends = BackendMap());
+
+    std::shared_ptr<TensorView> create_tensor(const element::Type& element_type,
+                                              const Shape& shape) override;
+
+    std::shared_ptr<TensorView> create_tensor(const element::Type& element_type,
+                                              const Shape& shape,
+                                              void* memory_pointer) override;
+
+    bool compile(std::shared_ptr<Function> func) override;
+
+    bool call(std::shared_ptr<Function> func,
+              const std::vector<std::shared_ptr<TensorView>>& outputs,
+              const std::vector<std::shared_ptr<TensorView>>& inputs) override;
+
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
+    /// @brief The sub-functions func was split into, in the order they run.
+    std::vector<std::shared_ptr<Function>> get_sub_functions(std::shared_ptr<Function> func);
+
+private:
+    // Where a sub-function parameter or result gets its tensor: the call's input or output at
+    // index, or a tensor over a buffer shared with another sub-function.
+    struct Binding
+    {
+        size_t index;
+        std::shared_ptr<TensorView> tensor;
+    };
+
+    struct SubFunction
+    {
+        std::shared_ptr<Function> function;
+        std::shared_ptr<Backend> backend;
+        std::vector<Binding> inputs;
+        std::vector<Binding> outputs;
+    };
+
+    class FunctionInstance
+    {
+    public:
+        std::shared_ptr<Function> m_function;
+        std::vector<SubFunction> m_sub_functions;
+        std::vector<std::shared_ptr<AlignedBuffer>> m_buffers;
+    };
+
+    std::shared_ptr<Backend> get_backend(Placement placement);
+
+    std::function<void(std::shared_ptr<Function>)> m_assign_placement;
+    BackendMap m_backends;
+    std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+};
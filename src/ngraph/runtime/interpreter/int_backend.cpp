@@ -52,14 +52,22 @@ shared_ptr<runtime::TensorView> runtime::interpreter::INTBackend::create_tensor(
 
 bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[function];
     if (!instance.m_is_compiled)
     {
         instance.m_is_compiled = true;
-        pass::Manager pass_manager;
-        pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
-        pass_manager.register_pass<pass::Liveness>();
-        pass_manager.run_passes(function);
+        FunctionSignature signature = get_function_signature(function);
+        instance.m_compiled_function = m_compiled_function_cache.find(signature);
+        if (instance.m_compiled_function == nullptr)
+        {
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.run_passes(function);
+            instance.m_compiled_function = function;
+            m_compiled_function_cache.insert(signature, function);
+        }
     }
 
     return true;
@@ -72,7 +80,11 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
     validate_call(function, outputs, inputs);
 
     compile(function);
+    unique_lock<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[function];
+    lock.unlock();
+    // Run the shared graph; it has the same parameters and results as function.
+    function = instance.m_compiled_function;
 
     // convert inputs to HostTensorView
     vector<shared_ptr<runtime::HostTensorView>> func_inputs;
@@ -116,6 +128,23 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         tensor_map.insert({tv, func_outputs[output_count]});
     }
 
+    // the tensors created for op outputs, which are freed by liveness
+    unordered_map<const descriptor::Tensor*, descriptor::TensorView*> created_tensors;
+
+    // AllReduces run in order on a background thread, overlapping the ops after them until
+    // their result is read
+    AsyncExecutor collectives(1);
+    unordered_map<runtime::HostTensorView*, future<bool>> pending_collectives;
+    auto wait_for_collective = [&pending_collectives](runtime::HostTensorView* tensor) {
+        auto it = pending_collectives.find(tensor);
+        if (it != pending_collectives.end())
+        {
+            future<bool> collective = move(it->second);
+            pending_collectives.erase(it);
+            collective.get();
+        }
+    };
+
     // for each ordered op in the graph
     for (shared_ptr<Node> op : function->get_ordered_ops())
     {
@@ -130,6 +159,7 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             descriptor::TensorView* tv = input.get_output().get_tensor_view().get();
             op_inputs.push_back(tensor_map.at(tv));
+            wait_for_collective(op_inputs.back().get());
         }
 
         // get op outputs from map or create
@@ -138,7 +168,8 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             descriptor::TensorView* tv = op->get_output_tensor_view(i).get();
             shared_ptr<runtime::HostTensorView> htv;
-            if (!contains_key(tensor_map, tv))
+            auto it = tensor_map.find(tv);
+            if (it == tensor_map.end())
             {
                 // the output tensor is not in the tensor map so create a new tensor
                 const Shape& shape = op->get_output_shape(i);
@@ -146,10 +177,11 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
                 string name = op->get_output_tensor(i).get_name();
                 htv = make_shared<runtime::HostTensorView>(type, shape, name);
                 tensor_map.insert({tv, htv});
+                created_tensors.insert({&op->get_output_tensor(i), tv});
             }
             else
             {
-                htv = tensor_map.at(tv);
+                htv = it->second;
             }
             op_outputs.push_back(htv);
         }
@@ -173,37 +205,75 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             type = op->get_outputs().at(0).get_element_type();
         }
 
+        HardwareCounterValues counters_at_start;
+        if (instance.m_hardware_counters_enabled)
+        {
+            counters_at_start = HardwareCounters::read();
+        }
         if (instance.m_performance_counters_enabled)
         {
             instance.m_timer_map[op.get()].start();
         }
-        generate_calls(type, *op, op_outputs, op_inputs);
+        if (op->description() == "AllReduce")
+        {
+            pending_collectives[op_outputs[0].get()] =
+                collectives.submit(&collectives, [this, type, op, op_outputs, op_inputs]() {
+                    generate_calls(type, *op, op_outputs, op_inputs);
+                    return true;
+                });
+        }
+        else
+        {
+            generate_calls(type, *op, op_outputs, op_inputs);
+        }
         if (instance.m_performance_counters_enabled)
         {
             instance.m_timer_map[op.get()].stop();
         }
+        if (instance.m_hardware_counters_enabled)
+        {
+            instance.m_hardware_counter_map[op.get()] +=
+                HardwareCounters::read() - counters_at_start;
+        }
         if (instance.m_nan_check_enabled)
         {
+            for (auto& htv : op_outputs)
+            {
+                wait_for_collective(htv.get());
+            }
             perform_nan_check(op_outputs, op.get());
         }
 
         // delete any obsolete tensors
         for (const descriptor::Tensor* t : op->liveness_free_list)
         {
-            for (auto it = tensor_map.begin(); it != tensor_map.end(); ++it)
+            auto it = created_tensors.find(t);
+            if (it != created_tensors.end())
             {
-                if (it->second->get_tensor().get_name() == t->get_name())
-                {
-                    tensor_map.erase(it);
-                    break;
-                }
+                tensor_map.erase(it->second);
+                created_tensors.erase(it);
             }
         }
     }
+    while (!pending_collectives.empty())
+    {
+        wait_for_collective(pending_collectives.begin()->first);
+    }
 
     return true;
 }
 
+future<bool> runtime::interpreter::INTBackend::async_call(
+    shared_ptr<Function> function,
+    const vector<shared_ptr<runtime::TensorView>>& outputs,
+    const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    compile(function);
+    return m_executor.submit(function.get(), [this, function, outputs, inputs]() {
+        return call(function, outputs, inputs);
+    });
+}
+
 void runtime::interpreter::INTBackend::generate_calls(
     const element::Type& type,
     Node& op,
@@ -214,6 +284,10 @@ void runtime::interpreter::INTBackend::generate_calls(
     {
         op_engine<char>(op, outputs, inputs);
     }
+    else if (type == element::bf16 || type == element::f16)
+    {
+        generate_calls_in_f32(op, outputs, inputs);
+    }
     else if (type == element::f32)
     {
         op_engine<float>(op, outputs, inputs);
@@ -262,6 +336,92 @@ void runtime::interpreter::INTBackend::generate_calls(
     }
 }
 
+static bool is_16bit_real(const element::Type& type)
+{
+    return type == element::bf16 || type == element::f16;
+}
+
+static shared_ptr<runtime::HostTensorView> widen_to_f32(shared_ptr<runtime::HostTensorView> tv)
+{
+    const element::Type& type = tv->get_element_type();
+    if (!is_16bit_real(type))
+    {
+        return tv;
+    }
+    auto rc = make_shared<runtime::HostTensorView>(
+        element::f32, tv->get_shape(), tv->get_tensor().get_name());
+    if (type == element::bf16)
+    {
+        runtime::reference::convert(
+            tv->get_data_ptr<bfloat16>(), rc->get_data_ptr<float>(), tv->get_element_count());
+    }
+    else
+    {
+        runtime::reference::convert(
+            tv->get_data_ptr<float16>(), rc->get_data_ptr<float>(), tv->get_element_count());
+    }
+    return rc;
+}
+
+static void narrow_from_f32(shared_ptr<runtime::HostTensorView> f32_tv,
+                            shared_ptr<runtime::HostTensorView> tv)
+{
+    const element::Type& type = tv->get_element_type();
+    if (type == element::bf16)
+    {
+        runtime::reference::convert(
+            f32_tv->get_data_ptr<float>(), tv->get_data_ptr<bfloat16>(), tv->get_element_count());
+    }
+    else if (type == element::f16)
+    {
+        runtime::reference::convert(
+            f32_tv->get_data_ptr<float>(), tv->get_data_ptr<float16>(), tv->get_element_count());
+    }
+}
+
+// bf16 and f16 are storage types. Each 16 bit tensor is widened to f32, the f32 reference
+// kernel is run and the results are rounded back, so every op computes and accumulates in f32.
+void runtime::interpreter::INTBackend::generate_calls_in_f32(
+    Node& op,
+    const vector<shared_ptr<HostTensorView>>& outputs,
+    const vector<shared_ptr<HostTensorView>>& inputs)
+{
+    if (op.description() == "Constant")
+    {
+        const op::Constant* c = static_cast<const op::Constant*>(&op);
+        size_t num_bytes = outputs[0]->get_element_count() * outputs[0]->get_element_type().size();
+        memcpy(outputs[0]->get_data_ptr(), c->get_data_ptr(), num_bytes);
+        return;
+    }
+
+    vector<shared_ptr<HostTensorView>> f32_inputs;
+    for (shared_ptr<HostTensorView> tv : inputs)
+    {
+        f32_inputs.push_back(widen_to_f32(tv));
+    }
+
+    vector<shared_ptr<HostTensorView>> f32_outputs;
+    for (shared_ptr<HostTensorView> tv : outputs)
+    {
+        if (is_16bit_real(tv->get_element_type()))
+        {
+            f32_outputs.push_back(make_shared<HostTensorView>(
+                element::f32, tv->get_shape(), tv->get_tensor().get_name()));
+        }
+        else
+        {
+            f32_outputs.push_back(tv);
+        }
+    }
+
+    op_engine<float>(op, f32_outputs, f32_inputs);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        narrow_from_f32(f32_outputs[i], outputs[i]);
+    }
+}
+
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
     FunctionInstance& instance = m_function_map[func];
@@ -275,6 +435,17 @@ void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Functi
     instance.m_performance_counters_enabled = enable;
 }
 
+void runtime::interpreter::INTBackend::enable_hardware_counters(shared_ptr<Function> func,
+                                                                bool enable)
+{
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_hardware_counters_enabled = enable;
+    if (enable)
+    {
+        instance.m_performance_counters_enabled = true;
+    }
+}
+
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTBackend::get_performance_data(shared_ptr<Function> func) const
 {
@@ -285,6 +456,12 @@ vector<runtime::PerformanceCounter>
         rc.emplace_back(p.first->get_name().c_str(),
                         p.second.get_total_microseconds(),
                         p.second.get_call_count());
+        rc.back().set_op_cost(estimate_op_cost(*p.first));
+        auto counters = instance.m_hardware_counter_map.find(p.first);
+        if (counters != instance.m_hardware_counter_map.end())
+        {
+            rc.back().set_hardware_counters(counters->second);
+        }
     }
     return rc;
 }
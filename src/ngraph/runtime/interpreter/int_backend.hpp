@@ -17,11 +17,15 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "ngraph/runtime/async_executor.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/compiled_function_cache.hpp"
 #include "ngraph/runtime/host_tensor_view.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 
@@ -32,6 +36,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max.hpp"
 #include "ngraph/op/max_pool.hpp"
@@ -47,12 +52,15 @@
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sum.hpp"
 
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/add_n.hpp"
+#include "ngraph/runtime/reference/allreduce.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/asin.hpp"
 #include "ngraph/runtime/reference/atan.hpp"
@@ -69,6 +77,7 @@
 #include "ngraph/runtime/reference/cosh.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/exp.hpp"
 #include "ngraph/runtime/reference/floor.hpp"
@@ -105,15 +114,15 @@
 #include "ngraph/runtime/reference/sinh.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/softmax_cross_entropy.hpp"
 #include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/runtime/reference/tan.hpp"
 #include "ngraph/runtime/reference/tanh.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
-#ifdef NGRAPH_DISTRIBUTED
-#include "ngraph/runtime/reference/allreduce.hpp"
-#endif
 
 namespace ngraph
 {
@@ -140,9 +149,14 @@ public:
               const std::vector<std::shared_ptr<TensorView>>& outputs,
               const std::vector<std::shared_ptr<TensorView>>& intputs) override;
 
+    std::future<bool> async_call(std::shared_ptr<Function> function,
+                                 const std::vector<std::shared_ptr<TensorView>>& outputs,
+                                 const std::vector<std::shared_ptr<TensorView>>& inputs) override;
+
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
+    void enable_hardware_counters(std::shared_ptr<Function> func, bool enable) override;
     std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const override;
 
@@ -151,11 +165,18 @@ private:
     {
     public:
         bool m_is_compiled = false;
+        // The graph that is executed: the function itself, or a structurally identical one
+        // compiled earlier.
+        std::shared_ptr<Function> m_compiled_function;
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
+        bool m_hardware_counters_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
+        std::unordered_map<const Node*, HardwareCounterValues> m_hardware_counter_map;
     };
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+    std::mutex m_function_map_mutex;
+    CompiledFunctionCache<Function> m_compiled_function_cache;
     static bool init;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensorView>>&,
@@ -166,6 +187,35 @@ private:
                         const std::vector<std::shared_ptr<HostTensorView>>& outputs,
                         const std::vector<std::shared_ptr<HostTensorView>>& inputs);
 
+    void generate_calls_in_f32(Node& op,
+                               const std::vector<std::shared_ptr<HostTensorView>>& outputs,
+                               const std::vector<std::shared_ptr<HostTensorView>>& inputs);
+
+    template <typename T, typename U>
+    void embedding_lookup(Node& node,
+                          const std::vector<std::shared_ptr<HostTensorView>>& out,
+                          const std::vector<std::shared_ptr<HostTensorView>>& args)
+    {
+        if (node.description() == "EmbeddingLookup")
+        {
+            reference::embedding_lookup<T, U>(args[0]->get_data_ptr<U>(),
+                                              args[1]->get_data_ptr<T>(),
+                                              out[0]->get_data_ptr<T>(),
+                                              args[0]->get_element_count(),
+                                              args[1]->get_shape());
+        }
+        else
+        {
+            op::EmbeddingLookupBackprop* backprop =
+                dynamic_cast<op::EmbeddingLookupBackprop*>(&node);
+            reference::embedding_lookup_backprop<T, U>(args[0]->get_data_ptr<U>(),
+                                                       args[1]->get_data_ptr<T>(),
+                                                       out[0]->get_data_ptr<T>(),
+                                                       args[0]->get_element_count(),
+                                                       backprop->get_table_shape());
+        }
+    }
+
     template <typename T>
     void op_engine(Node& node,
                    const std::vector<std::shared_ptr<HostTensorView>>& out,
@@ -189,7 +239,15 @@ private:
                               out[0]->get_data_ptr<T>(),
                               out[0]->get_element_count());
         }
-#ifdef NGRAPH_DISTRIBUTED
+        else if (node_op == "AddN")
+        {
+            std::vector<const T*> arg_ptrs;
+            for (auto& arg : args)
+            {
+                arg_ptrs.push_back(arg->get_data_ptr<T>());
+            }
+            reference::add_n<T>(arg_ptrs, out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+        }
         else if (node_op == "AllReduce")
         {
             reference::allreduce<T>(args[0]->get_data_ptr<T>(),
@@ -197,7 +255,6 @@ private:
                                     args[0]->get_element_type(),
                                     static_cast<int>(args[0]->get_element_count()));
         }
-#endif
         else if (node_op == "And")
         {
             reference::logical_and(args[0]->get_data_ptr<char>(),
@@ -318,14 +375,27 @@ private:
         }
         else if (node_op == "Convert")
         {
-            // const op::Convert* c = static_cast<const op::Convert*>(&node);
-            element::Type type = node.get_element_type();
+            // Dispatch on the output tensor rather than the node so that a Convert to a 16 bit
+            // type can also write into the f32 tensor used when computing 16 bit types in f32
+            element::Type type = out[0]->get_element_type();
             if (type == element::boolean)
             {
                 reference::convert<T>(args[0]->get_data_ptr<T>(),
                                       out[0]->get_data_ptr<char>(),
                                       out[0]->get_element_count());
             }
+            else if (type == element::bf16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<bfloat16>(),
+                                      out[0]->get_element_count());
+            }
+            else if (type == element::f16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<float16>(),
+                                      out[0]->get_element_count());
+            }
             else if (type == element::f32)
             {
                 reference::convert<T>(args[0]->get_data_ptr<T>(),
@@ -489,7 +559,57 @@ private:
                            out[0]->get_shape(),
                            dot->get_reduction_axes_count());
         }
-
+        else if (node_op == "EmbeddingLookup" || node_op == "EmbeddingLookupBackprop")
+        {
+            // The indices may have any numeric type, independent of the table
+            element::Type type = args[0]->get_element_type();
+            if (type == element::f32)
+            {
+                embedding_lookup<T, float>(node, out, args);
+            }
+            else if (type == element::f64)
+            {
+                embedding_lookup<T, double>(node, out, args);
+            }
+            else if (type == element::i8)
+            {
+                embedding_lookup<T, int8_t>(node, out, args);
+            }
+            else if (type == element::i16)
+            {
+                embedding_lookup<T, int16_t>(node, out, args);
+            }
+            else if (type == element::i32)
+            {
+                embedding_lookup<T, int32_t>(node, out, args);
+            }
+            else if (type == element::i64)
+            {
+                embedding_lookup<T, int64_t>(node, out, args);
+            }
+            else if (type == element::u8)
+            {
+                embedding_lookup<T, uint8_t>(node, out, args);
+            }
+            else if (type == element::u16)
+            {
+                embedding_lookup<T, uint16_t>(node, out, args);
+            }
+            else if (type == element::u32)
+            {
+                embedding_lookup<T, uint32_t>(node, out, args);
+            }
+            else if (type == element::u64)
+            {
+                embedding_lookup<T, uint64_t>(node, out, args);
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "Unsupported index type " << type << " in " << node_op;
+                throw ngraph_error(ss.str());
+            }
+        }
         else if (node_op == "Equal")
         {
             reference::equal<T>(args[0]->get_data_ptr<T>(),
@@ -882,6 +1002,27 @@ private:
                                   out[0]->get_shape(),
                                   softmax->get_axes());
         }
+        else if (node_op == "SoftmaxCrossEntropy")
+        {
+            const op::SoftmaxCrossEntropy* loss =
+                static_cast<const op::SoftmaxCrossEntropy*>(&node);
+            reference::softmax_cross_entropy<T>(args[0]->get_data_ptr<T>(),
+                                                args[1]->get_data_ptr<T>(),
+                                                out[0]->get_data_ptr<T>(),
+                                                args[0]->get_shape(),
+                                                loss->get_axes());
+        }
+        else if (node_op == "SoftmaxCrossEntropyBackprop")
+        {
+            const op::SoftmaxCrossEntropyBackprop* backprop =
+                static_cast<const op::SoftmaxCrossEntropyBackprop*>(&node);
+            reference::softmax_cross_entropy_backprop<T>(args[0]->get_data_ptr<T>(),
+                                                         args[1]->get_data_ptr<T>(),
+                                                         args[2]->get_data_ptr<T>(),
+                                                         out[0]->get_data_ptr<T>(),
+                                                         args[0]->get_shape(),
+                                                         backprop->get_axes());
+        }
         else if (node_op == "Sqrt")
         {
             reference::sqrt<T>(
@@ -920,4 +1061,7 @@ private:
             throw ngraph_error(ss.str());
         }
     }
+
+    // Declared last so queued calls finish before the function map is destroyed.
+    AsyncExecutor m_executor{std::thread::hardware_concurrency()};
 };
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/op_cost.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::OpCost runtime::estimate_op_cost(const Node& node)
+{
+    OpCost cost;
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        cost.bytes += shape_size(node.get_input_shape(i)) * node.get_input_element_type(i).size();
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        cost.bytes +=
+            shape_size(node.get_output_shape(i)) * node.get_output_element_type(i).size();
+    }
+    if (node.get_output_size() != 1)
+    {
+        return cost;
+    }
+
+    double output_size = shape_size(node.get_output_shape(0));
+    const string& description = node.description();
+    if (dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseComparison*>(&node) ||
+        dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node))
+    {
+        cost.flops = output_size;
+    }
+    else if (dynamic_cast<const op::util::ArithmeticReduction*>(&node))
+    {
+        cost.flops = shape_size(node.get_input_shape(0));
+    }
+    else if (auto dot = dynamic_cast<const op::Dot*>(&node))
+    {
+        const Shape& arg0_shape = node.get_input_shape(0);
+        double reduction_size = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count();
+             i < arg0_shape.size();
+             i++)
+        {
+            reduction_size *= arg0_shape[i];
+        }
+        cost.flops = 2 * output_size * reduction_size;
+    }
+    else if (auto pool = dynamic_cast<const op::AvgPool*>(&node))
+    {
+        cost.flops = output_size * shape_size(pool->get_window_shape());
+    }
+    else if (auto pool = dynamic_cast<const op::MaxPool*>(&node))
+    {
+        cost.flops = output_size * shape_size(pool->get_window_shape());
+    }
+    else if (dynamic_cast<const op::Softmax*>(&node))
+    {
+        // max, subtract and exp, sum, divide
+        cost.flops = 4 * output_size;
+    }
+    else if (description == "Convolution" || description == "ConvolutionBias" ||
+             description == "ConvolutionRelu" || description == "ConvolutionBiasAdd")
+    {
+        // Backend fusions of Convolution keep the data batch and filters as their first two
+        // arguments. Each output element is a dot product over one filter.
+        const Shape& filters_shape = node.get_input_shape(1);
+        if (filters_shape[0] > 0)
+        {
+            cost.flops = 2 * output_size * shape_size(filters_shape) / filters_shape[0];
+        }
+    }
+    return cost;
+}
@@ -0,0 +1,37 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Analytical cost of one execution of an op.
+        struct OpCost
+        {
+            /// Arithmetic operations implied by the op's semantics and shapes; 0 for data
+            /// movement and for ops without a model.
+            double flops = 0;
+            /// Bytes of all inputs and outputs, i.e. the least traffic the op can cause.
+            double bytes = 0;
+        };
+
+        OpCost estimate_op_cost(const Node& node);
+    }
+}
@@ -17,6 +17,10 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
+
+#include "ngraph/runtime/hardware_counters.hpp"
+#include "ngraph/runtime/op_cost.hpp"
 
 namespace ngraph
 {
@@ -35,10 +39,48 @@ namespace ngraph
             size_t total_microseconds() const { return m_total_microseconds; }
             size_t microseconds() const { return m_total_microseconds / m_call_count; }
             size_t call_count() const { return m_call_count; }
+            /// Hardware counts summed over all calls; zero unless hardware counters were
+            /// enabled and are available on this machine
+            const HardwareCounterValues& hardware_counters() const { return m_hardware_counters; }
+            void set_hardware_counters(const HardwareCounterValues& values)
+            {
+                m_hardware_counters = values;
+            }
+            /// Analytical cost of a single call
+            const OpCost& op_cost() const { return m_op_cost; }
+            void set_op_cost(const OpCost& cost) { m_op_cost = cost; }
+            /// Instructions per cycle, or 0 without hardware counters
+            double ipc() const
+            {
+                return m_hardware_counters.cycles == 0
+                           ? 0
+                           : double(m_hardware_counters.instructions) / m_hardware_counters.cycles;
+            }
+            /// Achieved arithmetic throughput
+            double gflops() const
+            {
+                return m_total_microseconds == 0
+                           ? 0
+                           : m_op_cost.flops * m_call_count / m_total_microseconds / 1000;
+            }
+            /// Operations per byte moved, the op's position on a roofline plot
+            double arithmetic_intensity() const
+            {
+                return m_op_cost.bytes == 0 ? 0 : m_op_cost.flops / m_op_cost.bytes;
+            }
+            /// Bytes fetched from memory past the last-level cache per call, estimated from
+            /// LLC misses and a 64-byte line
+            double memory_bytes() const
+            {
+                return m_call_count == 0 ? 0 : 64.0 * m_hardware_counters.llc_misses / m_call_count;
+            }
+
         private:
             std::string m_name;
             size_t m_total_microseconds;
             size_t m_call_count;
+            HardwareCounterValues m_hardware_counters;
+            OpCost m_op_cost;
         };
     }
 }
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename T>
+            void add_n(const std::vector<const T*>& args, T* out, size_t count)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    T sum = args[0][i];
+                    for (size_t j = 1; j < args.size(); j++)
+                    {
+                        sum += args[j][i];
+                    }
+                    out[i] = sum;
+                }
+            }
+        }
+    }
+}
@@ -16,9 +16,9 @@
 
 #pragma once
 
-#ifdef NGRAPH_DISTRIBUTED
+#include <algorithm>
 
-#include <mpi.h>
+#include "ngraph/runtime/collective.hpp"
 #include "ngraph/type/element_type.hpp"
 
 namespace ngraph
@@ -30,21 +30,9 @@ namespace ngraph
             template <typename T>
             void allreduce(const T* arg, T* out, const element::Type element_type, int count)
             {
-                auto data_type = MPI_FLOAT;
-
-                if (element_type == element::f32)
-                {
-                    data_type = MPI_FLOAT;
-                }
-                else if (element_type == element::f64)
-                {
-                    data_type = MPI_DOUBLE;
-                }
-
-                MPI_Allreduce(arg, out, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+                std::copy(arg, arg + count, out);
+                get_collective()->allreduce(out, count, element_type);
             }
         }
     }
 }
-
-#endif
@@ -22,6 +22,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/im2col.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -119,16 +120,18 @@ namespace ngraph
                 }
             }
 
+            /// Coordinate-walking average pool; kept as the baseline the direct kernel is checked
+            /// against.
             template <typename T>
-            void avg_pool(const T* arg,
-                          T* out,
-                          const Shape& arg_shape,
-                          const Shape& out_shape,
-                          const Shape& window_shape,
-                          const Strides& window_movement_strides,
-                          const Shape& padding_below,
-                          const Shape& padding_above,
-                          bool include_padding_in_avg_computation)
+            void avg_pool_generic(const T* arg,
+                                  T* out,
+                                  const Shape& arg_shape,
+                                  const Shape& out_shape,
+                                  const Shape& window_shape,
+                                  const Strides& window_movement_strides,
+                                  const Shape& padding_below,
+                                  const Shape& padding_above,
+                                  bool include_padding_in_avg_computation)
             {
                 // At the outermost level we will walk over every output coordinate O.
                 CoordinateTransform output_transform(out_shape);
@@ -228,6 +231,71 @@ namespace ngraph
                     out[output_transform.index(out_coord)] = result / n_elements;
                 }
             }
+
+            /// Average pool over precomputed window offsets, reused for every (batch, channel)
+            /// plane. Windows are summed in the same order as avg_pool_generic.
+            template <typename T>
+            void avg_pool(const T* arg,
+                          T* out,
+                          const Shape& arg_shape,
+                          const Shape& out_shape,
+                          const Shape& window_shape,
+                          const Strides& window_movement_strides,
+                          const Shape& padding_below,
+                          const Shape& padding_above,
+                          bool include_padding_in_avg_computation)
+            {
+                Shape in_spatial_shape(arg_shape.begin() + 2, arg_shape.end());
+                Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                size_t n_spatial_dimensions = in_spatial_shape.size();
+
+                std::vector<std::ptrdiff_t> offsets =
+                    im2col_offsets(in_spatial_shape,
+                                   window_shape,
+                                   out_spatial_shape,
+                                   window_movement_strides,
+                                   Strides(n_spatial_dimensions, 1),
+                                   CoordinateDiff(padding_below.begin(), padding_below.end()),
+                                   Strides(n_spatial_dimensions, 1));
+
+                size_t in_size = shape_size(in_spatial_shape);
+                size_t out_size = shape_size(out_spatial_shape);
+                size_t window_size = shape_size(window_shape);
+                size_t planes = out_shape[0] * out_shape[1];
+
+                // The divisor depends only on the output position, not on the plane.
+                std::vector<size_t> n_elements(out_size, 0);
+                for (size_t i = 0; i < window_size * out_size; i++)
+                {
+                    if (offsets[i] >= 0 || include_padding_in_avg_computation)
+                    {
+                        n_elements[i % out_size]++;
+                    }
+                }
+
+                std::vector<T> sums(out_size);
+                for (size_t plane = 0; plane < planes; plane++)
+                {
+                    const T* src = arg + plane * in_size;
+                    T* dst = out + plane * out_size;
+                    std::fill(sums.begin(), sums.end(), T(0));
+                    for (size_t w = 0; w < window_size; w++)
+                    {
+                        const std::ptrdiff_t* window_offsets = &offsets[w * out_size];
+                        for (size_t o = 0; o < out_size; o++)
+                        {
+                            if (window_offsets[o] >= 0)
+                            {
+                                sums[o] += src[window_offsets[o]];
+                            }
+                        }
+                    }
+                    for (size_t o = 0; o < out_size; o++)
+                    {
+                        dst[o] = sums[o] / n_elements[o];
+                    }
+                }
+            }
         }
     }
 }
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -33,6 +34,22 @@ namespace ngraph
                         const Shape& out_shape,
                         size_t concatenation_axis)
             {
+                // Concatenating along the outermost axis of any size places the inputs one
+                // after another
+                size_t outer_size = 1;
+                for (size_t axis = 0; axis < concatenation_axis; axis++)
+                {
+                    outer_size *= out_shape[axis];
+                }
+                if (outer_size == 1)
+                {
+                    for (size_t i = 0; i < args.size(); i++)
+                    {
+                        out = std::copy(args[i], args[i] + shape_size(in_shapes[i]), out);
+                    }
+                    return;
+                }
+
                 // We will copy the inputs to the output one at a time. As we go, we will move out along the
                 // concatenation axis, starting at 0.
                 size_t concatenation_pos = 0;
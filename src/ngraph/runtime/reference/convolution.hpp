@@ -17,9 +17,12 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/im2col.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -28,25 +31,27 @@ namespace ngraph
     {
         namespace reference
         {
+            /// Coordinate-walking convolution; kept as the baseline the im2col kernel is checked
+            /// against.
             template <typename T>
-            void convolution(const T* arg0,
-                             const T* arg1,
-                             T* out,
-                             const Shape& arg0_shape,
-                             const Shape& arg1_shape,
-                             const Shape& out_shape,
-                             const Strides& window_movement_strides,
-                             const Strides& window_dilation_strides,
-                             const CoordinateDiff& padding_below,
-                             const CoordinateDiff& padding_above,
-                             const Strides& data_dilation_strides,
-                             size_t batch_axis_data,
-                             size_t input_channel_axis_data,
-                             size_t input_channel_axis_filters,
-                             size_t output_channel_axis_filters,
-                             size_t batch_axis_result,
-                             size_t output_channel_axis_result,
-                             bool rotate_filter)
+            void convolution_generic(const T* arg0,
+                                     const T* arg1,
+                                     T* out,
+                                     const Shape& arg0_shape,
+                                     const Shape& arg1_shape,
+                                     const Shape& out_shape,
+                                     const Strides& window_movement_strides,
+                                     const Strides& window_dilation_strides,
+                                     const CoordinateDiff& padding_below,
+                                     const CoordinateDiff& padding_above,
+                                     const Strides& data_dilation_strides,
+                                     size_t batch_axis_data,
+                                     size_t input_channel_axis_data,
+                                     size_t input_channel_axis_filters,
+                                     size_t output_channel_axis_filters,
+                                     size_t batch_axis_result,
+                                     size_t output_channel_axis_result,
+                                     bool rotate_filter)
             {
                 // Comments throughout assume without loss of generality that:
                 //
@@ -201,6 +206,104 @@ namespace ngraph
                     out[output_transform.index(out_coord)] = result;
                 }
             }
+
+            /// Convolution lowered to im2col plus a blocked matrix product. For each batch item the
+            /// padded, dilated input windows are unrolled into a (channels * window) x (output
+            /// positions) matrix, which is multiplied by the filters viewed as an (output channels)
+            /// x (channels * window) matrix. The sums run in the same order as convolution_generic.
+            template <typename T>
+            void convolution(const T* arg0,
+                             const T* arg1,
+                             T* out,
+                             const Shape& arg0_shape,
+                             const Shape& arg1_shape,
+                             const Shape& out_shape,
+                             const Strides& window_movement_strides,
+                             const Strides& window_dilation_strides,
+                             const CoordinateDiff& padding_below,
+                             const CoordinateDiff& padding_above,
+                             const Strides& data_dilation_strides,
+                             size_t batch_axis_data,
+                             size_t input_channel_axis_data,
+                             size_t input_channel_axis_filters,
+                             size_t output_channel_axis_filters,
+                             size_t batch_axis_result,
+                             size_t output_channel_axis_result,
+                             bool rotate_filter)
+            {
+                // The spatial axes are always the trailing axes, so each (batch, channel) slice of
+                // every tensor is a contiguous row-major block.
+                Shape in_spatial_shape(arg0_shape.begin() + 2, arg0_shape.end());
+                Shape window_shape(arg1_shape.begin() + 2, arg1_shape.end());
+                Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+
+                size_t batch_size = arg0_shape[batch_axis_data];
+                size_t n_input_channels = arg0_shape[input_channel_axis_data];
+                size_t n_output_channels = out_shape[output_channel_axis_result];
+                size_t window_size = shape_size(window_shape);
+                size_t out_size = shape_size(out_spatial_shape);
+                size_t col_rows = n_input_channels * window_size;
+
+                Strides arg0_strides = row_major_strides(arg0_shape);
+                Strides arg1_strides = row_major_strides(arg1_shape);
+                Strides out_strides = row_major_strides(out_shape);
+
+                std::vector<std::ptrdiff_t> offsets = im2col_offsets(in_spatial_shape,
+                                                                     window_shape,
+                                                                     out_spatial_shape,
+                                                                     window_movement_strides,
+                                                                     window_dilation_strides,
+                                                                     padding_below,
+                                                                     data_dilation_strides);
+
+                // Gather the filters into an (output channels) x (channels * window) matrix,
+                // reversing the spatial axes if requested. Reversing every spatial axis of a
+                // row-major block simply reverses the block.
+                std::vector<T> filters(n_output_channels * col_rows);
+                for (size_t co = 0; co < n_output_channels; co++)
+                {
+                    for (size_t ci = 0; ci < n_input_channels; ci++)
+                    {
+                        const T* src = arg1 + co * arg1_strides[output_channel_axis_filters] +
+                                       ci * arg1_strides[input_channel_axis_filters];
+                        T* dst = &filters[co * col_rows + ci * window_size];
+                        for (size_t w = 0; w < window_size; w++)
+                        {
+                            dst[w] = src[rotate_filter ? window_size - 1 - w : w];
+                        }
+                    }
+                }
+
+                std::vector<T> columns(col_rows * out_size);
+                std::vector<T> result(n_output_channels * out_size);
+                for (size_t n = 0; n < batch_size; n++)
+                {
+                    for (size_t ci = 0; ci < n_input_channels; ci++)
+                    {
+                        const T* src = arg0 + n * arg0_strides[batch_axis_data] +
+                                       ci * arg0_strides[input_channel_axis_data];
+                        T* dst = &columns[ci * window_size * out_size];
+                        for (size_t i = 0; i < window_size * out_size; i++)
+                        {
+                            dst[i] = offsets[i] < 0 ? T(0) : src[offsets[i]];
+                        }
+                    }
+
+                    matrix_multiply<T>(filters.data(),
+                                       columns.data(),
+                                       result.data(),
+                                       n_output_channels,
+                                       col_rows,
+                                       out_size);
+
+                    for (size_t co = 0; co < n_output_channels; co++)
+                    {
+                        T* dst = out + n * out_strides[batch_axis_result] +
+                                 co * out_strides[output_channel_axis_result];
+                        std::copy(&result[co * out_size], &result[co * out_size] + out_size, dst);
+                    }
+                }
+            }
         }
     }
 }
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 
@@ -27,14 +29,69 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
-            void dot(const T* arg0,
-                     const T* arg1,
-                     T* out,
-                     const Shape& arg0_shape,
-                     const Shape& arg1_shape,
-                     const Shape& out_shape,
-                     size_t reduction_axes_count)
+            /// \brief Row-major matrix product out[m,n] = a[m,k] * b[k,n].
+            ///
+            /// The loops are tiled so that a block of b and a block of accumulators stay in cache
+            /// while a block of rows of a streams past them. Every output element is still summed
+            /// over k in ascending order, so the result is identical to the coordinate walk in
+            /// dot_generic.
+            template <typename T, typename ACCUMULATION = T>
+            void matrix_multiply(const T* a, const T* b, T* out, size_t m, size_t k, size_t n)
+            {
+                const size_t m_block = 32;
+                const size_t k_block = 128;
+                const size_t n_block = 256;
+
+                std::vector<ACCUMULATION> acc(m_block * n_block);
+
+                for (size_t m_begin = 0; m_begin < m; m_begin += m_block)
+                {
+                    size_t m_end = std::min(m, m_begin + m_block);
+                    for (size_t n_begin = 0; n_begin < n; n_begin += n_block)
+                    {
+                        size_t n_count = std::min(n, n_begin + n_block) - n_begin;
+                        std::fill(acc.begin(), acc.end(), ACCUMULATION(0));
+
+                        for (size_t k_begin = 0; k_begin < k; k_begin += k_block)
+                        {
+                            size_t k_end = std::min(k, k_begin + k_block);
+                            for (size_t i = m_begin; i < m_end; i++)
+                            {
+                                ACCUMULATION* acc_row = &acc[(i - m_begin) * n_block];
+                                for (size_t p = k_begin; p < k_end; p++)
+                                {
+                                    const T a_ip = a[i * k + p];
+                                    const T* b_row = b + p * n + n_begin;
+                                    for (size_t j = 0; j < n_count; j++)
+                                    {
+                                        acc_row[j] += a_ip * b_row[j];
+                                    }
+                                }
+                            }
+                        }
+
+                        for (size_t i = m_begin; i < m_end; i++)
+                        {
+                            const ACCUMULATION* acc_row = &acc[(i - m_begin) * n_block];
+                            T* out_row = out + i * n + n_begin;
+                            for (size_t j = 0; j < n_count; j++)
+                            {
+                                out_row[j] = static_cast<T>(acc_row[j]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// Coordinate-walking dot; kept as the baseline the blocked kernel is checked against.
+            template <typename T, typename ACCUMULATION = T>
+            void dot_generic(const T* arg0,
+                             const T* arg1,
+                             T* out,
+                             const Shape& arg0_shape,
+                             const Shape& arg1_shape,
+                             const Shape& out_shape,
+                             size_t reduction_axes_count)
             {
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because they're
                 // right up front.
@@ -83,7 +140,7 @@ namespace ngraph
                             arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
 
                         // Zero out to start the sum.
-                        T sum = 0;
+                        ACCUMULATION sum = 0;
 
                         size_t out_index = output_transform.index(out_coord);
 
@@ -112,10 +169,45 @@ namespace ngraph
                         }
 
                         // Write the sum back.
-                        out[out_index] = sum;
+                        out[out_index] = static_cast<T>(sum);
                     }
                 }
             }
+
+            /// ACCUMULATION is the type the sum of products is carried in; it defaults to T but
+            /// 16 bit floating point types should accumulate in float.
+            ///
+            /// The dotted axes are the trailing axes of arg0 and the leading axes of arg1, so in
+            /// row-major layout the product is always a single (m x k) * (k x n) matrix product.
+            template <typename T, typename ACCUMULATION = T>
+            void dot(const T* arg0,
+                     const T* arg1,
+                     T* out,
+                     const Shape& arg0_shape,
+                     const Shape& arg1_shape,
+                     const Shape& out_shape,
+                     size_t reduction_axes_count)
+            {
+                size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
+
+                size_t m = 1;
+                for (size_t i = 0; i < arg0_projected_rank; i++)
+                {
+                    m *= arg0_shape[i];
+                }
+                size_t k = 1;
+                for (size_t i = 0; i < reduction_axes_count; i++)
+                {
+                    k *= arg1_shape[i];
+                }
+                size_t n = 1;
+                for (size_t i = reduction_axes_count; i < arg1_shape.size(); i++)
+                {
+                    n *= arg1_shape[i];
+                }
+
+                matrix_multiply<T, ACCUMULATION>(arg0, arg1, out, m, k, n);
+            }
         }
     }
 }
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // NOTE: Execution throws `std::range_error` if either a non-integral value or an
+            // out-of-bounds value is detected in the indices, just like OneHot.
+            template <typename U>
+            size_t embedding_row(U index, size_t rows)
+            {
+                double value = static_cast<double>(index);
+                if (std::floor(value) < value || std::floor(value) > value)
+                {
+                    throw(std::range_error("Embedding lookup: non-integral index"));
+                }
+                if (value < 0 || value >= static_cast<double>(rows))
+                {
+                    throw(std::range_error("Embedding lookup: index is out of range"));
+                }
+                return static_cast<size_t>(value);
+            }
+
+            template <typename T, typename U>
+            void embedding_lookup(const U* indices,
+                                  const T* table,
+                                  T* out,
+                                  size_t indices_count,
+                                  const Shape& table_shape)
+            {
+                size_t rows = table_shape.at(0);
+                size_t row_size = shape_size(Shape(table_shape.begin() + 1, table_shape.end()));
+
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    size_t row = embedding_row(indices[i], rows);
+                    std::copy(table + row * row_size,
+                              table + (row + 1) * row_size,
+                              out + i * row_size);
+                }
+            }
+
+            template <typename T, typename U>
+            void embedding_lookup_backprop(const U* indices,
+                                           const T* delta,
+                                           T* out,
+                                           size_t indices_count,
+                                           const Shape& table_shape)
+            {
+                size_t rows = table_shape.at(0);
+                size_t row_size = shape_size(Shape(table_shape.begin() + 1, table_shape.end()));
+
+                std::fill(out, out + shape_size(table_shape), 0);
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    size_t row = embedding_row(indices[i], rows);
+                    for (size_t j = 0; j < row_size; j++)
+                    {
+                        out[row * row_size + j] += delta[i * row_size + j];
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Precomputes, for every (window position, output position) pair of a
+            ///        sliding window over the spatial axes of one channel, where the window
+            ///        element lands in the unpadded, undilated input.
+            ///
+            /// The result is laid out [window element][output position], both in row-major order
+            /// over the spatial axes, and holds the row-major offset into the input's spatial block
+            /// or -1 where the element falls in padding or in a data dilation gap. This mirrors the
+            /// has_source_coordinate / index logic of the padded, dilated CoordinateTransform used
+            /// by the generic kernels, but is computed once per call instead of per element.
+            inline std::vector<std::ptrdiff_t> im2col_offsets(const Shape& in_spatial_shape,
+                                                              const Shape& window_shape,
+                                                              const Shape& out_spatial_shape,
+                                                              const Strides& movement_strides,
+                                                              const Strides& window_dilation,
+                                                              const CoordinateDiff& padding_below,
+                                                              const Strides& data_dilation)
+            {
+                size_t n_dims = in_spatial_shape.size();
+
+                // Per axis, the input position (or -1) for each (window, output) coordinate pair.
+                std::vector<std::vector<std::ptrdiff_t>> axis_positions(n_dims);
+                for (size_t d = 0; d < n_dims; d++)
+                {
+                    std::ptrdiff_t dilated_size =
+                        in_spatial_shape[d] == 0
+                            ? 0
+                            : (in_spatial_shape[d] - 1) * data_dilation[d] + 1;
+                    axis_positions[d].resize(window_shape[d] * out_spatial_shape[d]);
+                    for (size_t w = 0; w < window_shape[d]; w++)
+                    {
+                        for (size_t o = 0; o < out_spatial_shape[d]; o++)
+                        {
+                            std::ptrdiff_t pos =
+                                static_cast<std::ptrdiff_t>(o * movement_strides[d] +
+                                                            w * window_dilation[d]) -
+                                padding_below[d];
+                            bool valid = pos >= 0 && pos < dilated_size &&
+                                         pos % static_cast<std::ptrdiff_t>(data_dilation[d]) == 0;
+                            axis_positions[d][w * out_spatial_shape[d] + o] =
+                                valid ? pos / static_cast<std::ptrdiff_t>(data_dilation[d]) : -1;
+                        }
+                    }
+                }
+
+                size_t window_size = shape_size(window_shape);
+                size_t out_size = shape_size(out_spatial_shape);
+                Strides in_strides = row_major_strides(in_spatial_shape);
+
+                std::vector<std::ptrdiff_t> offsets(window_size * out_size);
+                std::vector<size_t> w_coord(n_dims, 0);
+                for (size_t w = 0; w < window_size; w++)
+                {
+                    std::vector<size_t> o_coord(n_dims, 0);
+                    for (size_t o = 0; o < out_size; o++)
+                    {
+                        std::ptrdiff_t offset = 0;
+                        for (size_t d = 0; d < n_dims && offset >= 0; d++)
+                        {
+                            std::ptrdiff_t pos =
+                                axis_positions[d][w_coord[d] * out_spatial_shape[d] + o_coord[d]];
+                            offset = pos < 0 ? -1 : offset + pos * in_strides[d];
+                        }
+                        offsets[w * out_size + o] = offset;
+
+                        for (size_t d = n_dims; d-- > 0;)
+                        {
+                            if (++o_coord[d] < out_spatial_shape[d])
+                            {
+                                break;
+                            }
+                            o_coord[d] = 0;
+                        }
+                    }
+
+                    for (size_t d = n_dims; d-- > 0;)
+                    {
+                        if (++w_coord[d] < window_shape[d])
+                        {
+                            break;
+                        }
+                        w_coord[d] = 0;
+                    }
+                }
+
+                return offsets;
+            }
+        }
+    }
+}
@@ -17,9 +17,12 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 #include <numeric>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/im2col.hpp"
 
 namespace ngraph
 {
@@ -121,15 +124,17 @@ namespace ngraph
                 }
             }
 
+            /// Coordinate-walking max pool; kept as the baseline the direct kernel is checked
+            /// against.
             template <typename T>
-            void max_pool(const T* arg,
-                          T* out,
-                          const Shape& arg_shape,
-                          const Shape& out_shape,
-                          const Shape& window_shape,
-                          const Strides& window_movement_strides,
-                          const Shape& padding_below,
-                          const Shape& padding_above)
+            void max_pool_generic(const T* arg,
+                                  T* out,
+                                  const Shape& arg_shape,
+                                  const Shape& out_shape,
+                                  const Shape& window_shape,
+                                  const Strides& window_movement_strides,
+                                  const Shape& padding_below,
+                                  const Shape& padding_above)
             {
                 // At the outermost level we will walk over every output coordinate O.
                 CoordinateTransform output_transform(out_shape);
@@ -219,6 +224,57 @@ namespace ngraph
                     out[output_transform.index(out_coord)] = result;
                 }
             }
+
+            /// Max pool over precomputed window offsets. Each (batch, channel) plane is contiguous,
+            /// so the window offsets are computed once and reused for every plane; windows are
+            /// scanned in the same order as max_pool_generic.
+            template <typename T>
+            void max_pool(const T* arg,
+                          T* out,
+                          const Shape& arg_shape,
+                          const Shape& out_shape,
+                          const Shape& window_shape,
+                          const Strides& window_movement_strides,
+                          const Shape& padding_below,
+                          const Shape& padding_above)
+            {
+                Shape in_spatial_shape(arg_shape.begin() + 2, arg_shape.end());
+                Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                size_t n_spatial_dimensions = in_spatial_shape.size();
+
+                std::vector<std::ptrdiff_t> offsets =
+                    im2col_offsets(in_spatial_shape,
+                                   window_shape,
+                                   out_spatial_shape,
+                                   window_movement_strides,
+                                   Strides(n_spatial_dimensions, 1),
+                                   CoordinateDiff(padding_below.begin(), padding_below.end()),
+                                   Strides(n_spatial_dimensions, 1));
+
+                size_t in_size = shape_size(in_spatial_shape);
+                size_t out_size = shape_size(out_spatial_shape);
+                size_t window_size = shape_size(window_shape);
+                size_t planes = out_shape[0] * out_shape[1];
+
+                for (size_t plane = 0; plane < planes; plane++)
+                {
+                    const T* src = arg + plane * in_size;
+                    T* dst = out + plane * out_size;
+                    std::fill(dst, dst + out_size, std::numeric_limits<T>::lowest());
+                    for (size_t w = 0; w < window_size; w++)
+                    {
+                        const std::ptrdiff_t* window_offsets = &offsets[w * out_size];
+                        for (size_t o = 0; o < out_size; o++)
+                        {
+                            if (window_offsets[o] >= 0)
+                            {
+                                T x = src[window_offsets[o]];
+                                dst[o] = x > dst[o] ? x : dst[o];
+                            }
+                        }
+                    }
+                }
+            }
         }
     }
 }
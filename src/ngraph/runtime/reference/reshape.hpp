@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/axis_vector.hpp"
@@ -34,6 +35,18 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
+                // Without a transpose the elements stay in order
+                bool transpose = false;
+                for (size_t i = 0; i < in_axis_order.size(); i++)
+                {
+                    transpose = transpose || in_axis_order[i] != i;
+                }
+                if (!transpose)
+                {
+                    std::copy(arg, arg + shape_size(in_shape), out);
+                    return;
+                }
+
                 // Unfortunately we don't yet have a constructor for CoordinateTransform that lets us pass only source_space_shape
                 // and source_axis_order so we have to construct the defaults here.
                 Shape in_start_corner(in_shape.size(), 0); // (0,...0)
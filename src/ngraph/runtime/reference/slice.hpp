@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -35,6 +36,23 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
+                // A unit-stride slice of only the first axis is one contiguous range
+                bool contiguous = arg_shape.size() > 0;
+                for (size_t axis = 0; contiguous && axis < arg_shape.size(); axis++)
+                {
+                    contiguous = strides[axis] == 1 &&
+                                 (axis == 0 || (lower_bounds[axis] == 0 &&
+                                                upper_bounds[axis] == arg_shape[axis]));
+                }
+                if (contiguous)
+                {
+                    size_t row_size = shape_size(arg_shape) / std::max<size_t>(arg_shape[0], 1);
+                    std::copy(arg + lower_bounds[0] * row_size,
+                              arg + upper_bounds[0] * row_size,
+                              out);
+                    return;
+                }
+
                 CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
                 CoordinateTransform output_transform(out_shape);
 
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
@@ -27,8 +31,10 @@ namespace ngraph
     {
         namespace reference
         {
+            /// Coordinate-walking softmax; handles any set of axes and is the baseline the
+            /// contiguous kernel is checked against.
             template <typename T>
-            void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            void softmax_generic(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
             {
                 auto temp_shape = project(shape, axes);
                 auto temp_elements = std::accumulate(
@@ -56,6 +62,82 @@ namespace ngraph
 
                 delete[] temp_ptr;
             }
+
+            /// Softmax over a run of adjacent axes. The tensor is viewed as [outer, reduced,
+            /// inner]; for each outer index the max, then the exponentials together with their sum,
+            /// then the normalization are computed while the [reduced, inner] block is still in
+            /// cache, with the innermost loop running over contiguous elements. Sums are taken in
+            /// the same order as softmax_generic. Any other set of axes falls back to
+            /// softmax_generic.
+            template <typename T>
+            void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                if (axes.empty() || *axes.rbegin() - *axes.begin() + 1 != axes.size())
+                {
+                    softmax_generic(arg, out, shape, axes);
+                    return;
+                }
+
+                size_t outer = 1;
+                size_t reduced = 1;
+                size_t inner = 1;
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    if (i < *axes.begin())
+                    {
+                        outer *= shape[i];
+                    }
+                    else if (i <= *axes.rbegin())
+                    {
+                        reduced *= shape[i];
+                    }
+                    else
+                    {
+                        inner *= shape[i];
+                    }
+                }
+
+                std::vector<T> maxes(inner);
+                std::vector<T> sums(inner);
+                for (size_t o = 0; o < outer; o++)
+                {
+                    const T* src = arg + o * reduced * inner;
+                    T* dst = out + o * reduced * inner;
+
+                    std::fill(maxes.begin(),
+                              maxes.end(),
+                              std::numeric_limits<T>::has_infinity
+                                  ? -std::numeric_limits<T>::infinity()
+                                  : std::numeric_limits<T>::lowest());
+                    for (size_t r = 0; r < reduced; r++)
+                    {
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            T x = src[r * inner + i];
+                            maxes[i] = x > maxes[i] ? x : maxes[i];
+                        }
+                    }
+
+                    std::fill(sums.begin(), sums.end(), T(0));
+                    for (size_t r = 0; r < reduced; r++)
+                    {
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            T e = std::exp(src[r * inner + i] - maxes[i]);
+                            dst[r * inner + i] = e;
+                            sums[i] += e;
+                        }
+                    }
+
+                    for (size_t r = 0; r < reduced; r++)
+                    {
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            dst[r * inner + i] /= sums[i];
+                        }
+                    }
+                }
+            }
         }
     }
 }
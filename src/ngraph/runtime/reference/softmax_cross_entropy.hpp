@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// Online log-sum-exp in a single pass over one group of n logits. On return max is
+            /// the largest logit, sum_exp is the sum of exp(logit - max), label_sum is the sum of
+            /// the labels, and the result is the sum of label * (logit - max).
+            template <typename T>
+            T softmax_cross_entropy_row(
+                const T* logits, const T* labels, size_t n, T& max, T& sum_exp, T& label_sum)
+            {
+                max = logits[0];
+                sum_exp = 1;
+                label_sum = labels[0];
+                T weighted_sum = 0;
+                for (size_t i = 1; i < n; i++)
+                {
+                    if (logits[i] > max)
+                    {
+                        // Move the running sums to the new maximum
+                        T shift = max - logits[i];
+                        sum_exp = sum_exp * std::exp(shift) + 1;
+                        weighted_sum += label_sum * shift;
+                        max = logits[i];
+                    }
+                    else
+                    {
+                        T shifted = logits[i] - max;
+                        sum_exp += std::exp(shifted);
+                        weighted_sum += labels[i] * shifted;
+                    }
+                    label_sum += labels[i];
+                }
+                return weighted_sum;
+            }
+
+            /// -sum(labels * log(softmax(logits))) for one group of n logits
+            template <typename T>
+            T softmax_cross_entropy_loss(const T* logits, const T* labels, size_t n)
+            {
+                if (n == 0)
+                {
+                    return 0;
+                }
+                T max;
+                T sum_exp;
+                T label_sum;
+                T weighted_sum =
+                    softmax_cross_entropy_row(logits, labels, n, max, sum_exp, label_sum);
+                return label_sum * std::log(sum_exp) - weighted_sum;
+            }
+
+            /// delta * (softmax(logits) * sum(labels) - labels) for one group of n logits
+            template <typename T>
+            void softmax_cross_entropy_gradient(
+                const T* logits, const T* labels, T delta, T* out, size_t n)
+            {
+                if (n == 0)
+                {
+                    return;
+                }
+                T max;
+                T sum_exp;
+                T label_sum;
+                softmax_cross_entropy_row(logits, labels, n, max, sum_exp, label_sum);
+                T scale = delta * label_sum / sum_exp;
+                for (size_t i = 0; i < n; i++)
+                {
+                    out[i] = scale * std::exp(logits[i] - max) - delta * labels[i];
+                }
+            }
+
+            // The class axes are the innermost ones, so each group of logits is contiguous
+            template <typename T>
+            void softmax_cross_entropy(
+                const T* logits, const T* labels, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                size_t n = shape_size(Shape(shape.end() - axes.size(), shape.end()));
+                size_t rows = shape_size(project(shape, axes));
+                for (size_t row = 0; row < rows; row++)
+                {
+                    out[row] = softmax_cross_entropy_loss(logits + row * n, labels + row * n, n);
+                }
+            }
+
+            template <typename T>
+            void softmax_cross_entropy_backprop(const T* logits,
+                                                const T* labels,
+                                                const T* delta,
+                                                T* out,
+                                                const Shape& shape,
+                                                const AxisSet& axes)
+            {
+                size_t n = shape_size(Shape(shape.end() - axes.size(), shape.end()));
+                size_t rows = shape_size(project(shape, axes));
+                for (size_t row = 0; row < rows; row++)
+                {
+                    softmax_cross_entropy_gradient(
+                        logits + row * n, labels + row * n, delta[row], out + row * n, n);
+                }
+            }
+        }
+    }
+}
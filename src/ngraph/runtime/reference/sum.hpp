@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 
@@ -26,7 +27,9 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
+            /// ACCUMULATION is the type partial sums are carried in; it defaults to T but 16 bit
+            /// floating point types should accumulate in float.
+            template <typename T, typename ACCUMULATION = T>
             void sum(const T* arg,
                      T* out,
                      const Shape& in_shape,
@@ -34,11 +37,7 @@ namespace ngraph
                      const AxisSet& reduction_axes)
             {
                 CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
+                std::vector<ACCUMULATION> accumulators(shape_size(out_shape), 0);
 
                 CoordinateTransform input_transform(in_shape);
 
@@ -46,9 +45,15 @@ namespace ngraph
                 {
                     Coordinate output_coord = project(input_coord, reduction_axes);
 
-                    out[output_transform.index(output_coord)] +=
+                    accumulators[output_transform.index(output_coord)] +=
                         arg[input_transform.index(input_coord)];
                 }
+
+                for (const Coordinate& output_coord : output_transform)
+                {
+                    size_t output_index = output_transform.index(output_coord);
+                    out[output_index] = static_cast<T>(accumulators[output_index]);
+                }
             }
         }
     }
@@ -0,0 +1,298 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/shm_ring_collective.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const size_t s_alignment = 64;
+static const uint32_t s_ready = 0x52494e47;
+
+struct runtime::ShmRingCollective::Header
+{
+    atomic<uint32_t> ready;
+    atomic<uint64_t> arrived;
+    atomic<uint64_t> generation;
+};
+
+// Waits for attaching processes, which start in any order, for up to a minute.
+static void wait_for(const function<bool()>& condition, const string& what)
+{
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(60);
+    while (!condition())
+    {
+        if (chrono::steady_clock::now() > deadline)
+        {
+            throw ngraph_error("Timed out waiting for " + what);
+        }
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+}
+
+runtime::ShmRingCollective::ShmRingCollective(const string& name,
+                                              size_t rank,
+                                              size_t size,
+                                              size_t capacity_bytes)
+    : m_rank(rank)
+    , m_size(size)
+    , m_capacity((max(capacity_bytes, s_alignment) + s_alignment - 1) / s_alignment * s_alignment)
+    , m_segment(nullptr)
+    , m_header(nullptr)
+    , m_step(0)
+{
+    if (rank >= size)
+    {
+        throw ngraph_error("ShmRingCollective rank " + to_string(rank) + " is not below size " +
+                           to_string(size));
+    }
+    static_assert(sizeof(Header) <= s_alignment, "Header must fit before the mailboxes");
+    // Two mailbox slots per process follow the header
+    m_segment_size = s_alignment + 2 * m_size * m_capacity;
+
+    int fd;
+    if (m_rank == 0)
+    {
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0)
+        {
+            throw ngraph_error("Cannot create shared memory '" + name + "': " + strerror(errno));
+        }
+        if (ftruncate(fd, m_segment_size) != 0)
+        {
+            string error = strerror(errno);
+            close(fd);
+            shm_unlink(name.c_str());
+            throw ngraph_error("Cannot size shared memory '" + name + "': " + error);
+        }
+    }
+    else
+    {
+        wait_for(
+            [&]() {
+                fd = shm_open(name.c_str(), O_RDWR, 0600);
+                if (fd < 0 && errno != ENOENT)
+                {
+                    throw ngraph_error("Cannot open shared memory '" + name + "': " +
+                                       strerror(errno));
+                }
+                return fd >= 0;
+            },
+            "shared memory '" + name + "'");
+        try
+        {
+            wait_for(
+                [&]() {
+                    struct stat status;
+                    return fstat(fd, &status) == 0 &&
+                           static_cast<size_t>(status.st_size) == m_segment_size;
+                },
+                "shared memory '" + name + "' to be sized");
+        }
+        catch (...)
+        {
+            close(fd);
+            throw;
+        }
+    }
+
+    void* segment = mmap(nullptr, m_segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED)
+    {
+        if (m_rank == 0)
+        {
+            shm_unlink(name.c_str());
+        }
+        throw ngraph_error("Cannot map shared memory '" + name + "': " + strerror(errno));
+    }
+    m_segment = static_cast<char*>(segment);
+
+    if (m_rank == 0)
+    {
+        m_header = new (m_segment) Header();
+        m_header->ready.store(s_ready, memory_order_release);
+    }
+    else
+    {
+        m_header = reinterpret_cast<Header*>(m_segment);
+        try
+        {
+            wait_for([this]() { return m_header->ready.load(memory_order_acquire) == s_ready; },
+                     "shared memory '" + name + "' to be initialized");
+        }
+        catch (...)
+        {
+            munmap(m_segment, m_segment_size);
+            throw;
+        }
+    }
+
+    // Once every process has mapped the segment its name is no longer needed
+    barrier();
+    if (m_rank == 0)
+    {
+        shm_unlink(name.c_str());
+    }
+}
+
+runtime::ShmRingCollective::~ShmRingCollective()
+{
+    munmap(m_segment, m_segment_size);
+}
+
+void runtime::ShmRingCollective::barrier()
+{
+    uint64_t generation = m_header->generation.load(memory_order_acquire);
+    if (m_header->arrived.fetch_add(1, memory_order_acq_rel) + 1 == m_size)
+    {
+        m_header->arrived.store(0, memory_order_relaxed);
+        m_header->generation.store(generation + 1, memory_order_release);
+    }
+    else
+    {
+        // Spin briefly, as the others are usually close behind, then back off so that waiting
+        // does not take the cores the others need to get here.
+        for (size_t spin = 0; m_header->generation.load(memory_order_acquire) == generation;
+             spin++)
+        {
+            if (spin < 1000)
+            {
+                this_thread::yield();
+            }
+            else
+            {
+                this_thread::sleep_for(chrono::microseconds(50));
+            }
+        }
+    }
+}
+
+char* runtime::ShmRingCollective::get_mailbox(size_t rank) const
+{
+    // Every process is on the same step, so a process reads its neighbor's slot for the step
+    // while the slot it wrote the step before may still be being read.
+    return m_segment + s_alignment + (2 * rank + m_step % 2) * m_capacity;
+}
+
+template <typename T>
+void runtime::ShmRingCollective::ring_allreduce(T* data, size_t count)
+{
+    size_t left = (m_rank + m_size - 1) % m_size;
+    size_t piece_capacity = m_capacity / sizeof(T) * m_size;
+    for (size_t offset = 0; offset < count; offset += piece_capacity)
+    {
+        T* piece = data + offset;
+        size_t piece_count = min(piece_capacity, count - offset);
+        // Chunk c of the piece starts at begin(c)
+        auto begin = [this, piece_count](size_t c) { return piece_count * c / m_size; };
+
+        // Reduce-scatter: at step s each process sends chunk rank - s and adds the chunk from
+        // its left neighbor, so it ends with the sum of chunk rank + 1.
+        for (size_t s = 0; s + 1 < m_size; s++)
+        {
+            size_t send = (m_rank + m_size - s) % m_size;
+            size_t receive = (m_rank + 2 * m_size - s - 1) % m_size;
+            copy(piece + begin(send),
+                 piece + begin(send + 1),
+                 reinterpret_cast<T*>(get_mailbox(m_rank)));
+            barrier();
+            const T* incoming = reinterpret_cast<const T*>(get_mailbox(left));
+            for (size_t i = begin(receive); i < begin(receive + 1); i++)
+            {
+                piece[i] += *incoming++;
+            }
+            m_step++;
+        }
+
+        // Allgather: each process passes on the summed chunk it received last
+        for (size_t s = 0; s + 1 < m_size; s++)
+        {
+            size_t send = (m_rank + 1 + m_size - s) % m_size;
+            size_t receive = (m_rank + m_size - s) % m_size;
+            copy(piece + begin(send),
+                 piece + begin(send + 1),
+                 reinterpret_cast<T*>(get_mailbox(m_rank)));
+            barrier();
+            const T* incoming = reinterpret_cast<const T*>(get_mailbox(left));
+            copy(incoming, incoming + begin(receive + 1) - begin(receive), piece + begin(receive));
+            m_step++;
+        }
+    }
+}
+
+void runtime::ShmRingCollective::do_allreduce(void* data, size_t count, const element::Type& type)
+{
+    if (type == element::f32)
+    {
+        ring_allreduce(static_cast<float*>(data), count);
+    }
+    else if (type == element::f64)
+    {
+        ring_allreduce(static_cast<double*>(data), count);
+    }
+    else if (type == element::i8)
+    {
+        ring_allreduce(static_cast<int8_t*>(data), count);
+    }
+    else if (type == element::i16)
+    {
+        ring_allreduce(static_cast<int16_t*>(data), count);
+    }
+    else if (type == element::i32)
+    {
+        ring_allreduce(static_cast<int32_t*>(data), count);
+    }
+    else if (type == element::i64)
+    {
+        ring_allreduce(static_cast<int64_t*>(data), count);
+    }
+    else if (type == element::u8)
+    {
+        ring_allreduce(static_cast<uint8_t*>(data), count);
+    }
+    else if (type == element::u16)
+    {
+        ring_allreduce(static_cast<uint16_t*>(data), count);
+    }
+    else if (type == element::u32)
+    {
+        ring_allreduce(static_cast<uint32_t*>(data), count);
+    }
+    else if (type == element::u64)
+    {
+        ring_allreduce(static_cast<uint64_t*>(data), count);
+    }
+    else
+    {
+        throw ngraph_error("Unsupported data type for AllReduce");
+    }
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ngraph/runtime/collective.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ShmRingCollective;
+    }
+}
+
+/// @brief A ring allreduce between the processes of one host through POSIX shared memory, for
+/// data-parallel runs without MPI.
+///
+/// Process 0 creates the shared memory segment called name and the others attach to it, so
+/// the name must be unique to the job; it is unlinked once every process has attached.
+/// Buffers are reduced in pieces of size * capacity_bytes, by a reduce-scatter and then an
+/// allgather around the ring. Each step passes one chunk per process through a
+/// double-buffered mailbox in the segment and costs one barrier.
+class ngraph::runtime::ShmRingCollective : public Collective
+{
+public:
+    ShmRingCollective(const std::string& name,
+                      size_t rank,
+                      size_t size,
+                      size_t capacity_bytes = 1 << 20);
+    ~ShmRingCollective();
+
+    ShmRingCollective(const ShmRingCollective&) = delete;
+    ShmRingCollective& operator=(const ShmRingCollective&) = delete;
+
+    size_t get_rank() const override { return m_rank; }
+    size_t get_size() const override { return m_size; }
+
+protected:
+    void do_allreduce(void* data, size_t count, const element::Type& element_type) override;
+
+private:
+    struct Header;
+
+    template <typename T>
+    void ring_allreduce(T* data, size_t count);
+
+    void barrier();
+    char* get_mailbox(size_t rank) const;
+
+    size_t m_rank;
+    size_t m_size;
+    size_t m_capacity;
+    size_t m_segment_size;
+    char* m_segment;
+    Header* m_header;
+    size_t m_step;
+};
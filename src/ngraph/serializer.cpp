@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <fstream>
+#include <sstream>
 #include <functional>
 
 #include "ngraph/cpio.hpp"
@@ -23,6 +24,7 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/add_n.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/asin.hpp"
@@ -39,6 +41,7 @@
 #include "ngraph/op/cosh.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
@@ -79,6 +82,7 @@
 #include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -114,7 +118,7 @@ static std::shared_ptr<ngraph::Function>
                   function<const_data_callback_t>);
 
 static json write(const ngraph::Function&, bool binary_constant_data);
-static json write(const ngraph::Node&, bool binary_constant_data);
+static json write(const ngraph::Node&, bool binary_constant_data, bool* known = nullptr);
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
 
@@ -273,57 +277,129 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     return rc;
 }
 
-static json write(const Function& f, bool binary_constant_data)
+// FNV-1a, enough to tell constants apart within a signature.
+static string digest(const void* data, size_t size)
 {
-    json function;
-    function["name"] = f.get_name();
-
-    vector<string> parameter_list;
-    for (auto param : f.get_parameters())
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++)
     {
-        parameter_list.push_back(param->get_name());
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
     }
-    function["parameters"] = parameter_list;
+    stringstream ss;
+    ss << hex << hash;
+    return ss.str();
+}
 
-    // TODO Functions can return multiple results
-    for (size_t i = 0; i < f.get_output_size(); ++i)
+string ngraph::get_structural_signature(shared_ptr<ngraph::Function> func)
+{
+    vector<shared_ptr<Function>> functions;
+    traverse_functions(func, [&](shared_ptr<Function> f) { functions.push_back(f); });
+    unordered_map<string, size_t> function_index;
+    for (size_t i = 0; i < functions.size(); i++)
     {
-        function["result"].push_back(f.get_output_op(i)->get_name());
+        function_index[functions[i]->get_name()] = i;
     }
 
-    list<shared_ptr<Node>> result_list;
+    json signature = json::array();
+    for (shared_ptr<Function> f : functions)
     {
-        deque<Node*> independent_nodes;
-        unordered_map<const Node*, size_t> node_depencency_count;
-        unordered_map<Node*, shared_ptr<Node>> node_map;
-
-        traverse_nodes(const_cast<Function*>(&f), [&](shared_ptr<Node> node) {
-            node_map[node.get()] = node;
-            node_depencency_count[node.get()] = node->get_arguments().size();
-            if (node->get_arguments().size() == 0)
+        unordered_map<string, size_t> node_index;
+        auto to_indices = [&](const json& names) {
+            json indices = json::array();
+            for (const json& name : names)
             {
-                independent_nodes.push_back(node.get());
+                indices.push_back(node_index.at(name.get<string>()));
             }
-        });
+            return indices;
+        };
 
-        while (independent_nodes.size() > 0)
+        json ops = json::array();
+        for (shared_ptr<Node> node : topological_sort(f->get_ops()))
         {
-            auto independent_node = independent_nodes.front();
-            result_list.push_back(node_map[independent_node]);
-            independent_nodes.pop_front();
+            bool known = true;
+            json op = write(*node, true, &known);
+            if (!known)
+            {
+                return "";
+            }
 
-            for (auto sp_user : independent_node->get_users())
+            // Names differ between otherwise identical graphs, so refer to nodes and
+            // functions by position instead.
+            op.erase("name");
+            op.erase("outputs");
+            op["inputs"] = to_indices(op["inputs"]);
+            if (op.count("control_deps") != 0)
+            {
+                op["control_deps"] = to_indices(op["control_deps"]);
+            }
+            for (const char* key : {"function", "selection_function", "scatter_function"})
             {
-                Node* user = sp_user.get();
-                node_depencency_count[user] -= 1;
-                size_t count = node_depencency_count[user];
-                if (count == 0)
+                if (op.count(key) != 0)
                 {
-                    independent_nodes.push_back(user);
+                    op[key] = function_index.at(op[key].get<string>());
                 }
             }
+
+            json output_types = json::array();
+            json output_shapes = json::array();
+            for (size_t i = 0; i < node->get_output_size(); i++)
+            {
+                output_types.push_back(write_element_type(node->get_output_element_type(i)));
+                output_shapes.push_back(node->get_output_shape(i));
+            }
+            op["output_types"] = output_types;
+            op["output_shapes"] = output_shapes;
+
+            if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+            {
+                op["digest"] = digest(constant->get_data_ptr(),
+                                      shape_size(constant->get_shape()) *
+                                          constant->get_element_type().size());
+            }
+
+            node_index[node->get_name()] = ops.size();
+            ops.push_back(op);
         }
+
+        json function;
+        json parameters = json::array();
+        for (auto param : f->get_parameters())
+        {
+            parameters.push_back(node_index.at(param->get_name()));
+        }
+        json results = json::array();
+        for (size_t i = 0; i < f->get_output_size(); ++i)
+        {
+            results.push_back(node_index.at(f->get_output_op(i)->get_name()));
+        }
+        function["parameters"] = parameters;
+        function["results"] = results;
+        function["ops"] = ops;
+        signature.push_back(function);
+    }
+    return signature.dump();
+}
+
+static json write(const Function& f, bool binary_constant_data)
+{
+    json function;
+    function["name"] = f.get_name();
+
+    vector<string> parameter_list;
+    for (auto param : f.get_parameters())
+    {
+        parameter_list.push_back(param->get_name());
     }
+    function["parameters"] = parameter_list;
+
+    // TODO Functions can return multiple results
+    for (size_t i = 0; i < f.get_output_size(); ++i)
+    {
+        function["result"].push_back(f.get_output_op(i)->get_name());
+    }
+
+    list<shared_ptr<Node>> result_list = topological_sort(f.get_ops());
 
     json nodes;
     for (shared_ptr<Node> node : result_list)
@@ -372,6 +448,10 @@ static shared_ptr<ngraph::Function>
             {
                 node = make_shared<op::Add>(args[0], args[1]);
             }
+            else if (node_op == "AddN")
+            {
+                node = make_shared<op::AddN>(args);
+            }
             else if (node_op == "AllReduce")
             {
                 node = make_shared<op::AllReduce>(args[0]);
@@ -591,6 +671,15 @@ static shared_ptr<ngraph::Function>
                     node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
                 }
             }
+            else if (node_op == "EmbeddingLookup")
+            {
+                node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
+            }
+            else if (node_op == "EmbeddingLookupBackprop")
+            {
+                auto table_shape = node_js.at("table_shape").get<vector<size_t>>();
+                node = make_shared<op::EmbeddingLookupBackprop>(args[0], args[1], table_shape);
+            }
             else if (node_op == "Equal")
             {
                 node = make_shared<op::Equal>(args[0], args[1]);
@@ -850,6 +939,17 @@ static shared_ptr<ngraph::Function>
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
                 node = make_shared<op::Softmax>(args[0], reduction_axes);
             }
+            else if (node_op == "SoftmaxCrossEntropy")
+            {
+                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+                node = make_shared<op::SoftmaxCrossEntropy>(args[0], args[1], reduction_axes);
+            }
+            else if (node_op == "SoftmaxCrossEntropyBackprop")
+            {
+                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+                node = make_shared<op::SoftmaxCrossEntropyBackprop>(
+                    args[0], args[1], args[2], reduction_axes);
+            }
             else if (node_op == "Sqrt")
             {
                 node = make_shared<op::Sqrt>(args[0]);
@@ -877,6 +977,14 @@ static shared_ptr<ngraph::Function>
                 ss << "unsupported op " << node_op;
                 throw runtime_error(ss.str());
             }
+            auto control_deps = node_js.find("control_deps");
+            if (control_deps != node_js.end())
+            {
+                for (const string& name : control_deps->get<vector<string>>())
+                {
+                    node->add_control_dependency(node_map.at(name));
+                }
+            }
             node_map[node_name] = node;
 
             // Typically, it could be unsafe to change the name of a node since it may break nameing
@@ -936,7 +1044,7 @@ static shared_ptr<ngraph::Function>
     return rc;
 }
 
-static json write(const Node& n, bool binary_constant_data)
+static json write(const Node& n, bool binary_constant_data, bool* known)
 {
     json node;
     node["name"] = n.get_name();
@@ -957,6 +1065,16 @@ static json write(const Node& n, bool binary_constant_data)
     node["inputs"] = inputs;
     node["outputs"] = outputs;
 
+    if (!n.get_control_dependencies().empty())
+    {
+        json control_deps = json::array();
+        for (auto& dependency : n.get_control_dependencies())
+        {
+            control_deps.push_back(dependency->get_name());
+        }
+        node["control_deps"] = control_deps;
+    }
+
     if (std::getenv("NGRAPH_SERIALIZER_OUTPUT_SHAPES") != nullptr)
     {
         json output_shapes = json::array();
@@ -977,6 +1095,9 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Add")
     {
     }
+    else if (node_op == "AddN")
+    {
+    }
     else if (node_op == "AllReduce")
     {
     }
@@ -1088,6 +1209,14 @@ static json write(const Node& n, bool binary_constant_data)
         auto tmp = dynamic_cast<const op::Dot*>(&n);
         node["reduction_axes_count"] = tmp->get_reduction_axes_count();
     }
+    else if (node_op == "EmbeddingLookup")
+    {
+    }
+    else if (node_op == "EmbeddingLookupBackprop")
+    {
+        auto tmp = dynamic_cast<const op::EmbeddingLookupBackprop*>(&n);
+        node["table_shape"] = tmp->get_table_shape();
+    }
     else if (node_op == "Equal")
     {
     }
@@ -1262,6 +1391,16 @@ static json write(const Node& n, bool binary_constant_data)
         node["upper_bounds"] = tmp->get_upper_bounds();
         node["strides"] = tmp->get_strides();
     }
+    else if (node_op == "SoftmaxCrossEntropy")
+    {
+        auto tmp = dynamic_cast<const op::SoftmaxCrossEntropy*>(&n);
+        node["reduction_axes"] = tmp->get_axes();
+    }
+    else if (node_op == "SoftmaxCrossEntropyBackprop")
+    {
+        auto tmp = dynamic_cast<const op::SoftmaxCrossEntropyBackprop*>(&n);
+        node["reduction_axes"] = tmp->get_axes();
+    }
     else if (node_op == "Sqrt")
     {
     }
@@ -1279,6 +1418,10 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Tanh")
     {
     }
+    else if (known != nullptr)
+    {
+        *known = false;
+    }
 
     return node;
 }
@@ -48,6 +48,14 @@ namespace ngraph
     //    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    // @brief A canonical description of a Function's structure
+    // @param func The Function to describe
+    // @returns The ops of func and of the functions it calls, with their attributes, output
+    //    types and shapes and a digest of each constant's data, with names replaced by
+    //    positions. Functions built the same way, such as one model deserialized twice, have
+    //    equal signatures. Empty if func contains an op the serializer does not describe.
+    std::string get_structural_signature(std::shared_ptr<ngraph::Function> func);
+
     // @brief Deserialize a Function
     // @param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace ngraph
+{
+    /// \brief Brain floating point storage type: the upper 16 bits of an IEEE 754 float.
+    ///
+    /// bfloat16 keeps the exponent range of f32 with an 8 bit mantissa. As with float16 all
+    /// arithmetic is done in float and the result is rounded back to 16 bits on assignment.
+    class bfloat16
+    {
+    public:
+        bfloat16()
+            : m_value{0}
+        {
+        }
+
+        bfloat16(float value)
+            : m_value{float_to_bits(value)}
+        {
+        }
+
+        operator float() const { return bits_to_float(m_value); }
+        uint16_t to_bits() const { return m_value; }
+        static bfloat16 from_bits(uint16_t bits)
+        {
+            bfloat16 rc;
+            rc.m_value = bits;
+            return rc;
+        }
+
+        template <typename T>
+        bfloat16& operator+=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) + other);
+        }
+        template <typename T>
+        bfloat16& operator-=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) - other);
+        }
+        template <typename T>
+        bfloat16& operator*=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) * other);
+        }
+        template <typename T>
+        bfloat16& operator/=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) / other);
+        }
+
+        /// \brief Round a float to the nearest bfloat16 value, ties to even.
+        static uint16_t float_to_bits(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if ((bits & 0x7fffffffu) > 0x7f800000u)
+            {
+                // Keep the sign and force a quiet NaN so truncation cannot produce Inf
+                return static_cast<uint16_t>((bits >> 16) | 0x0040u);
+            }
+            uint32_t rounding_bias = 0x7fffu + ((bits >> 16) & 1u);
+            return static_cast<uint16_t>((bits + rounding_bias) >> 16);
+        }
+
+        static float bits_to_float(uint16_t value)
+        {
+            uint32_t bits = static_cast<uint32_t>(value) << 16;
+            float rc;
+            std::memcpy(&rc, &bits, sizeof(rc));
+            return rc;
+        }
+
+    private:
+        uint16_t m_value;
+    };
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::bfloat16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr bool has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm = denorm_present;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr float_round_style round_style = round_to_nearest;
+        static constexpr bool is_iec559 = false;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = false;
+        static constexpr int digits = 8;
+        static constexpr int digits10 = 2;
+        static constexpr int max_digits10 = 4;
+        static constexpr int radix = 2;
+        static constexpr int min_exponent = -125;
+        static constexpr int min_exponent10 = -37;
+        static constexpr int max_exponent = 128;
+        static constexpr int max_exponent10 = 38;
+        static constexpr bool traps = false;
+        static constexpr bool tinyness_before = false;
+
+        static ngraph::bfloat16 min() { return ngraph::bfloat16::from_bits(0x0080); }
+        static ngraph::bfloat16 max() { return ngraph::bfloat16::from_bits(0x7f7f); }
+        static ngraph::bfloat16 lowest() { return ngraph::bfloat16::from_bits(0xff7f); }
+        static ngraph::bfloat16 epsilon() { return ngraph::bfloat16::from_bits(0x3c00); }
+        static ngraph::bfloat16 round_error() { return ngraph::bfloat16::from_bits(0x3f00); }
+        static ngraph::bfloat16 infinity() { return ngraph::bfloat16::from_bits(0x7f80); }
+        static ngraph::bfloat16 quiet_NaN() { return ngraph::bfloat16::from_bits(0x7fc0); }
+        static ngraph::bfloat16 signaling_NaN() { return ngraph::bfloat16::from_bits(0x7fa0); }
+        static ngraph::bfloat16 denorm_min() { return ngraph::bfloat16::from_bits(0x0001); }
+    };
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace ngraph
+{
+    /// \brief IEEE 754 half precision (binary16) storage type.
+    ///
+    /// Values are stored in 16 bits and converted to float for all arithmetic, so
+    /// expressions such as `a + b` compute in f32 and round back to 16 bits only when
+    /// assigned to a float16. The header is self-contained so that it can be used from
+    /// code generated by the CPU backend.
+    class float16
+    {
+    public:
+        float16()
+            : m_value{0}
+        {
+        }
+
+        float16(float value)
+            : m_value{float_to_bits(value)}
+        {
+        }
+
+        operator float() const { return bits_to_float(m_value); }
+        uint16_t to_bits() const { return m_value; }
+        static float16 from_bits(uint16_t bits)
+        {
+            float16 rc;
+            rc.m_value = bits;
+            return rc;
+        }
+
+        template <typename T>
+        float16& operator+=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) + other);
+        }
+        template <typename T>
+        float16& operator-=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) - other);
+        }
+        template <typename T>
+        float16& operator*=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) * other);
+        }
+        template <typename T>
+        float16& operator/=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) / other);
+        }
+
+        /// \brief Round a float to the nearest half precision value, ties to even.
+        static uint16_t float_to_bits(float value)
+        {
+            const uint32_t f32_infinity = 255u << 23;
+            const uint32_t f16_overflow = (127u + 16u) << 23;
+            const uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+
+            uint16_t rc;
+            if (bits >= f16_overflow)
+            {
+                // Inf stays Inf, NaN becomes a quiet NaN, anything else overflows to Inf
+                rc = (bits > f32_infinity) ? 0x7e00 : 0x7c00;
+            }
+            else if (bits < (113u << 23))
+            {
+                // The result is subnormal or zero; let the FPU do the rounding
+                float f;
+                float magic;
+                std::memcpy(&f, &bits, sizeof(f));
+                std::memcpy(&magic, &denorm_magic, sizeof(magic));
+                f += magic;
+                std::memcpy(&bits, &f, sizeof(bits));
+                rc = static_cast<uint16_t>(bits - denorm_magic);
+            }
+            else
+            {
+                uint32_t mantissa_odd = (bits >> 13) & 1;
+                bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff;
+                bits += mantissa_odd;
+                rc = static_cast<uint16_t>(bits >> 13);
+            }
+            return static_cast<uint16_t>(rc | (sign >> 16));
+        }
+
+        static float bits_to_float(uint16_t value)
+        {
+            const uint32_t shifted_exponent = 0x7c00u << 13;
+            const uint32_t magic = 113u << 23;
+
+            uint32_t bits = (value & 0x7fffu) << 13;
+            uint32_t exponent = shifted_exponent & bits;
+            bits += (127u - 15u) << 23;
+            if (exponent == shifted_exponent)
+            {
+                // Inf or NaN
+                bits += (128u - 16u) << 23;
+            }
+            else if (exponent == 0)
+            {
+                // Zero or subnormal, renormalize
+                bits += 1u << 23;
+                float f;
+                float m;
+                std::memcpy(&f, &bits, sizeof(f));
+                std::memcpy(&m, &magic, sizeof(m));
+                f -= m;
+                std::memcpy(&bits, &f, sizeof(bits));
+            }
+            bits |= static_cast<uint32_t>(value & 0x8000u) << 16;
+            float rc;
+            std::memcpy(&rc, &bits, sizeof(rc));
+            return rc;
+        }
+
+    private:
+        uint16_t m_value;
+    };
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::float16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr bool has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm = denorm_present;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr float_round_style round_style = round_to_nearest;
+        static constexpr bool is_iec559 = true;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = false;
+        static constexpr int digits = 11;
+        static constexpr int digits10 = 3;
+        static constexpr int max_digits10 = 5;
+        static constexpr int radix = 2;
+        static constexpr int min_exponent = -13;
+        static constexpr int min_exponent10 = -4;
+        static constexpr int max_exponent = 16;
+        static constexpr int max_exponent10 = 4;
+        static constexpr bool traps = false;
+        static constexpr bool tinyness_before = false;
+
+        static ngraph::float16 min() { return ngraph::float16::from_bits(0x0400); }
+        static ngraph::float16 max() { return ngraph::float16::from_bits(0x7bff); }
+        static ngraph::float16 lowest() { return ngraph::float16::from_bits(0xfbff); }
+        static ngraph::float16 epsilon() { return ngraph::float16::from_bits(0x1400); }
+        static ngraph::float16 round_error() { return ngraph::float16::from_bits(0x3800); }
+        static ngraph::float16 infinity() { return ngraph::float16::from_bits(0x7c00); }
+        static ngraph::float16 quiet_NaN() { return ngraph::float16::from_bits(0x7e00); }
+        static ngraph::float16 signaling_NaN() { return ngraph::float16::from_bits(0x7d00); }
+        static ngraph::float16 denorm_min() { return ngraph::float16::from_bits(0x0001); }
+    };
+}
@@ -21,19 +21,111 @@
 // sample models are under ../../test/models
 
 #include <fstream>
+#include <iomanip>
 #include <ngraph/file_util.hpp>
-#include <ngraph/file_util.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/pass/liveness.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/memory_layout.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
 #include <ngraph/runtime/backend.hpp>
 #include <ngraph/util.hpp>
+#include <nlohmann/json.hpp>
 
+#include "util/autodiff/backprop_function.hpp"
 #include "util/benchmark.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+struct LatencyRun
+{
+    string backend;
+    size_t batch_size;
+    BenchmarkStatistics stats;
+};
+
+static vector<size_t> parse_size_list(const string& list)
+{
+    vector<size_t> sizes;
+    stringstream ss(list);
+    string item;
+    while (getline(ss, item, ','))
+    {
+        sizes.push_back(stoull(item));
+    }
+    return sizes;
+}
+
+static void print_latency_runs(const vector<LatencyRun>& runs)
+{
+    cout << setw(6) << right << "batch" << setw(6) << "conc" << setw(9) << "calls" << setw(11)
+         << "mean ms" << setw(11) << "p50 ms" << setw(11) << "p95 ms" << setw(11) << "p99 ms"
+         << setw(11) << "max ms" << setw(12) << "calls/s" << setw(12) << "items/s" << setw(12)
+         << "pool MB" << setw(12) << "rss MB" << endl;
+    cout << fixed << setprecision(3);
+    for (const LatencyRun& run : runs)
+    {
+        const BenchmarkStatistics& s = run.stats;
+        cout << setw(6) << run.batch_size << setw(6) << s.concurrency << setw(9) << s.calls
+             << setw(11) << s.mean_ms << setw(11) << s.p50_ms << setw(11) << s.p95_ms
+             << setw(11) << s.p99_ms << setw(11) << s.max_ms << setw(12) << s.calls_per_second
+             << setw(12) << s.calls_per_second * run.batch_size << setw(12)
+             << s.temporary_pool_size / 1048576.0 << setw(12) << s.peak_rss / 1048576.0 << endl;
+    }
+    cout << defaultfloat;
+}
+
+static void
+    write_latency_json(const string& path, const string& model, const vector<LatencyRun>& runs)
+{
+    nlohmann::json results = nlohmann::json::array();
+    for (const LatencyRun& run : runs)
+    {
+        const BenchmarkStatistics& s = run.stats;
+        nlohmann::json entry;
+        entry["backend"] = run.backend;
+        entry["batch_size"] = run.batch_size;
+        entry["concurrency"] = s.concurrency;
+        entry["calls"] = s.calls;
+        entry["compile_ms"] = s.compile_ms;
+        entry["wall_ms"] = s.wall_ms;
+        entry["mean_ms"] = s.mean_ms;
+        entry["p50_ms"] = s.p50_ms;
+        entry["p95_ms"] = s.p95_ms;
+        entry["p99_ms"] = s.p99_ms;
+        entry["max_ms"] = s.max_ms;
+        entry["calls_per_second"] = s.calls_per_second;
+        entry["items_per_second"] = s.calls_per_second * run.batch_size;
+        entry["temporary_pool_bytes"] = s.temporary_pool_size;
+        entry["peak_rss_bytes"] = s.peak_rss;
+        results.push_back(entry);
+    }
+    nlohmann::json doc;
+    doc["model"] = model;
+    doc["results"] = results;
+    ofstream out(path);
+    out << doc.dump(4) << endl;
+}
+
+static void
+    write_latency_csv(const string& path, const string& model, const vector<LatencyRun>& runs)
+{
+    ofstream out(path);
+    out << "model,backend,batch_size,concurrency,calls,compile_ms,wall_ms,mean_ms,p50_ms,p95_ms,"
+           "p99_ms,max_ms,calls_per_second,items_per_second,temporary_pool_bytes,peak_rss_bytes\n";
+    for (const LatencyRun& run : runs)
+    {
+        const BenchmarkStatistics& s = run.stats;
+        out << model << "," << run.backend << "," << run.batch_size << "," << s.concurrency << ","
+            << s.calls << "," << s.compile_ms << "," << s.wall_ms << "," << s.mean_ms << ","
+            << s.p50_ms << "," << s.p95_ms << "," << s.p99_ms << "," << s.max_ms << ","
+            << s.calls_per_second << "," << s.calls_per_second * run.batch_size << ","
+            << s.temporary_pool_size << "," << s.peak_rss << "\n";
+    }
+}
+
 int main(int argc, char** argv)
 {
     string model;
@@ -42,7 +134,15 @@ int main(int argc, char** argv)
     bool failed = false;
     bool statistics = false;
     bool timing_detail = false;
+    bool hardware_counters = false;
     bool visualize = false;
+    bool checkpoint = false;
+    bool latency = false;
+    BenchmarkConfig latency_config;
+    vector<size_t> batch_sizes;
+    string json_path;
+    string csv_path;
+    autodiff::CheckpointPolicy checkpoint_policy(autodiff::CheckpointPolicy::Strategy::SQRT_N);
     for (size_t i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -66,6 +166,46 @@ int main(int argc, char** argv)
                 failed = true;
             }
         }
+        else if (arg == "-w" || arg == "--warmup" || arg == "-c" || arg == "--concurrency" ||
+                 arg == "--batch")
+        {
+            latency = true;
+            try
+            {
+                string value = argv[++i];
+                if (arg == "--batch")
+                {
+                    batch_sizes = parse_size_list(value);
+                }
+                else if (arg == "-w" || arg == "--warmup")
+                {
+                    latency_config.warmup_iterations = stoull(value);
+                }
+                else
+                {
+                    latency_config.concurrency = stoull(value);
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "-l" || arg == "--latency")
+        {
+            latency = true;
+        }
+        else if (arg == "--json")
+        {
+            latency = true;
+            json_path = argv[++i];
+        }
+        else if (arg == "--csv")
+        {
+            latency = true;
+            csv_path = argv[++i];
+        }
         else if (arg == "-s" || arg == "--statistics")
         {
             statistics = true;
@@ -74,10 +214,32 @@ int main(int argc, char** argv)
         {
             timing_detail = true;
         }
+        else if (arg == "--hardware_counters")
+        {
+            hardware_counters = true;
+        }
         else if (arg == "-v" || arg == "--visualize")
         {
             visualize = true;
         }
+        else if (arg == "--checkpoint")
+        {
+            checkpoint = true;
+            string policy = argv[++i];
+            if (policy != "sqrt")
+            {
+                try
+                {
+                    checkpoint_policy = autodiff::CheckpointPolicy(
+                        autodiff::CheckpointPolicy::Strategy::MEMORY_BUDGET, stoull(policy));
+                }
+                catch (...)
+                {
+                    cout << "Invalid Argument\n";
+                    failed = true;
+                }
+            }
+        }
         else
         {
             cout << "Unknown option: " << arg << endl;
@@ -97,7 +259,8 @@ DESCRIPTION
     Benchmark ngraph json model with given backend.
 
 SYNOPSIS
-        nbench [-f <filename>] [-b <backend>] [-i <iterations>]
+        nbench [-f <filename>] [-b <backend>] [-i <iterations>] [-l] [-w <warmup>]
+               [-c <concurrency>] [--batch <sizes>] [--json <file>] [--csv <file>]
 
 OPTIONS
         -f|--file          Serialized model file
@@ -106,6 +269,21 @@ OPTIONS
         -s|--statistics    Display op stastics
         -v|--visualize     Visualize a model (WARNING: requires GraphViz installed)
         --timing_detail    Gather detailed timing
+        --hardware_counters
+                           Also report per-op GFLOP/s, arithmetic intensity, IPC and LLC
+                           misses (Linux perf events)
+        -l|--latency       Report latency percentiles, throughput and memory instead of
+                           per-op times; implied by the options below
+        -w|--warmup <n>    Untimed calls per caller before measuring (default: 0)
+        -c|--concurrency <n>
+                           Callers running the model at the same time, each with its own
+                           compiled copy (default: 1)
+        --batch <n,n,...>  Run once per batch size, rewriting the leading dimension of
+                           every parameter that shares the first parameter's batch size
+        --json <file>      Write the latency results as JSON
+        --csv <file>       Write the latency results as CSV
+        --checkpoint <p>   Benchmark the model's backprop with and without activation
+                           recomputation; <p> is sqrt or a segment budget in bytes
 )###";
         return 1;
     }
@@ -158,11 +336,73 @@ OPTIONS
             cout << op_info.first << ": " << op_info.second << " ops" << endl;
         }
     }
+    else if (checkpoint)
+    {
+        for (auto policy : {autodiff::CheckpointPolicy(), checkpoint_policy})
+        {
+            auto df = autodiff::backprop_function(f, policy);
+            cout << "Benchmarking backprop of " << model << ", "
+                 << (policy.strategy == autodiff::CheckpointPolicy::Strategy::NONE
+                         ? "no checkpointing"
+                         : "checkpointing")
+                 << ", " << backend << " backend, " << iterations << " iterations.\n";
+            run_benchmark(df, backend, iterations, timing_detail);
+
+            auto layout = clone_function(*df);
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.register_pass<pass::MemoryLayout>();
+            pass_manager.run_passes(layout);
+            cout << "ops: " << layout->get_ops().size()
+                 << ", temporary_pool_size: " << layout->get_temporary_pool_size() << " bytes\n";
+        }
+    }
+    else if (latency && iterations > 0)
+    {
+        latency_config.iterations = iterations;
+        vector<LatencyRun> runs;
+        if (batch_sizes.empty())
+        {
+            const op::ParameterVector& params = f->get_parameters();
+            size_t batch_size = 1;
+            if (!params.empty() && !params[0]->get_shape().empty())
+            {
+                batch_size = params[0]->get_shape()[0];
+            }
+            runs.push_back({backend, batch_size, measure_benchmark(f, backend, latency_config)});
+        }
+        for (size_t batch_size : batch_sizes)
+        {
+            try
+            {
+                auto batched = set_batch_size(f, batch_size);
+                runs.push_back(
+                    {backend, batch_size, measure_benchmark(batched, backend, latency_config)});
+            }
+            catch (const exception& e)
+            {
+                cout << "Batch size " << batch_size << " skipped: " << e.what() << endl;
+            }
+        }
+
+        cout << "Benchmarking " << model << ", " << backend << " backend, " << iterations
+             << " iterations per caller, " << latency_config.warmup_iterations
+             << " warmup iterations.\n";
+        print_latency_runs(runs);
+        if (!json_path.empty())
+        {
+            write_latency_json(json_path, model, runs);
+        }
+        if (!csv_path.empty())
+        {
+            write_latency_csv(csv_path, model, runs);
+        }
+    }
     else if (iterations > 0)
     {
         cout << "Benchmarking " << model << ", " << backend << " backend, " << iterations
              << " iterations.\n";
-        run_benchmark(f, backend, iterations, timing_detail);
+        run_benchmark(f, backend, iterations, timing_detail, hardware_counters);
     }
 
     return 0;
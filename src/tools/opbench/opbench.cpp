@@ -0,0 +1,482 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+// Microbenchmarks single ops over a grid of representative shapes on each requested backend and
+// reports the achieved GFLOP/s and GB/s next to a peak measured on this machine.
+// Run with e.g.
+//   opbench -b CPU -b INTERPRETER --filter Dot
+// The CPU backend sizes its thread pool from OMP_NUM_THREADS at startup, so thread scaling is
+// measured by running the tool under different OMP_NUM_THREADS values.
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/util.hpp>
+
+#include "util/benchmark.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct OpCase
+{
+    string name;
+    function<shared_ptr<Function>()> make_function;
+    double flops; // floating point operations per call
+    double bytes; // minimum bytes moved to and from memory per call
+};
+
+static size_t get_default_threads()
+{
+    const char* omp_num_threads = getenv("OMP_NUM_THREADS");
+    if (omp_num_threads && atoi(omp_num_threads) > 0)
+    {
+        return atoi(omp_num_threads);
+    }
+    return max(thread::hardware_concurrency(), 1u);
+}
+
+// Runs body on n threads and returns the wall time in seconds.
+static double time_threads(size_t n, function<void(size_t)> body)
+{
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (size_t i = 0; i < n; i++)
+    {
+        threads.emplace_back(body, i);
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+// Best-of-five multiply-add throughput with enough independent accumulators to hide latency.
+static double measure_peak_gflops(size_t threads)
+{
+    const size_t lanes = 32;
+    const size_t iterations = 1 << 22;
+    vector<float> sinks(threads);
+    double best = 0;
+    for (int trial = 0; trial < 5; trial++)
+    {
+        double seconds = time_threads(threads, [&](size_t id) {
+            float acc[lanes];
+            for (size_t j = 0; j < lanes; j++)
+            {
+                acc[j] = static_cast<float>(j + id);
+            }
+            const float a = 0.999999f;
+            const float b = 1e-7f;
+            for (size_t i = 0; i < iterations; i++)
+            {
+                for (size_t j = 0; j < lanes; j++)
+                {
+                    acc[j] = acc[j] * a + b;
+                }
+            }
+            float sum = 0;
+            for (size_t j = 0; j < lanes; j++)
+            {
+                sum += acc[j];
+            }
+            sinks[id] = sum;
+        });
+        best = max(best, 2.0 * lanes * iterations * threads / seconds / 1e9);
+    }
+    return best;
+}
+
+// Best-of-five STREAM-style triad bandwidth over buffers much larger than the caches.
+static double measure_peak_gbps(size_t threads)
+{
+    const size_t elements = 1 << 24;
+    vector<double> a(elements, 1.0);
+    vector<double> b(elements, 2.0);
+    vector<double> c(elements, 0.0);
+    double best = 0;
+    for (int trial = 0; trial < 5; trial++)
+    {
+        double seconds = time_threads(threads, [&](size_t id) {
+            size_t begin = elements * id / threads;
+            size_t end = elements * (id + 1) / threads;
+            for (size_t i = begin; i < end; i++)
+            {
+                c[i] = a[i] + 3.0 * b[i];
+            }
+        });
+        best = max(best, 3.0 * elements * sizeof(double) / seconds / 1e9);
+    }
+    return best;
+}
+
+static shared_ptr<Function> make_unary(function<shared_ptr<Node>(shared_ptr<Node>)> make_op,
+                                       const Shape& shape)
+{
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    return make_shared<Function>(make_op(A), op::ParameterVector{A});
+}
+
+static shared_ptr<Function>
+    make_binary(function<shared_ptr<Node>(shared_ptr<Node>, shared_ptr<Node>)> make_op,
+                const Shape& shape_a,
+                const Shape& shape_b)
+{
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    return make_shared<Function>(make_op(A, B), op::ParameterVector{A, B});
+}
+
+static vector<OpCase> get_op_cases()
+{
+    const double f32 = sizeof(float);
+    vector<OpCase> cases;
+
+    for (size_t n : {size_t(1) << 10, size_t(1) << 16, size_t(1) << 20, size_t(1) << 24})
+    {
+        Shape shape{n};
+        cases.push_back({"Add {" + join(shape) + "}",
+                         [=]() {
+                             return make_binary(
+                                 [](shared_ptr<Node> a, shared_ptr<Node> b) { return a + b; },
+                                 shape,
+                                 shape);
+                         },
+                         double(n),
+                         3 * n * f32});
+        cases.push_back({"Multiply {" + join(shape) + "}",
+                         [=]() {
+                             return make_binary(
+                                 [](shared_ptr<Node> a, shared_ptr<Node> b) { return a * b; },
+                                 shape,
+                                 shape);
+                         },
+                         double(n),
+                         3 * n * f32});
+        cases.push_back({"Tanh {" + join(shape) + "}",
+                         [=]() {
+                             return make_unary(
+                                 [](shared_ptr<Node> a) { return make_shared<op::Tanh>(a); },
+                                 shape);
+                         },
+                         double(n),
+                         2 * n * f32});
+    }
+
+    vector<vector<size_t>> dots{{64, 64, 64},
+                                {256, 256, 256},
+                                {1024, 1024, 1024},
+                                {32, 1024, 4096},
+                                {4096, 1024, 32}};
+    for (auto& mkn : dots)
+    {
+        size_t m = mkn[0], k = mkn[1], n = mkn[2];
+        Shape shape_a{m, k};
+        Shape shape_b{k, n};
+        cases.push_back({"Dot {" + join(shape_a) + "}x{" + join(shape_b) + "}",
+                         [=]() {
+                             return make_binary(
+                                 [](shared_ptr<Node> a, shared_ptr<Node> b) {
+                                     return make_shared<op::Dot>(a, b);
+                                 },
+                                 shape_a,
+                                 shape_b);
+                         },
+                         2.0 * m * k * n,
+                         (m * k + k * n + m * n) * f32});
+    }
+
+    // {N, C, H, W, K, R}: square RxR filters, unit stride, "same" padding
+    vector<vector<size_t>> convolutions{{1, 64, 56, 56, 64, 3},
+                                        {8, 32, 28, 28, 64, 3},
+                                        {8, 256, 14, 14, 256, 1},
+                                        {1, 3, 224, 224, 64, 7}};
+    for (auto& p : convolutions)
+    {
+        size_t batch = p[0], channels = p[1], height = p[2], width = p[3], filters = p[4];
+        size_t window = p[5];
+        Shape data_shape{batch, channels, height, width};
+        Shape filter_shape{filters, channels, window, window};
+        size_t output_size = batch * filters * height * width;
+        std::ptrdiff_t pad = window / 2;
+        cases.push_back(
+            {"Convolution {" + join(data_shape) + "}x{" + join(filter_shape) + "}",
+             [=]() {
+                 return make_binary(
+                     [=](shared_ptr<Node> data, shared_ptr<Node> filter) {
+                         return make_shared<op::Convolution>(data,
+                                                             filter,
+                                                             Strides{1, 1},
+                                                             Strides{1, 1},
+                                                             CoordinateDiff{pad, pad},
+                                                             CoordinateDiff{pad, pad});
+                     },
+                     data_shape,
+                     filter_shape);
+             },
+             2.0 * output_size * channels * window * window,
+             (shape_size(data_shape) + shape_size(filter_shape) + output_size) * f32});
+    }
+
+    vector<pair<Shape, AxisVector>> transposes{{Shape{2048, 2048}, AxisVector{1, 0}},
+                                               {Shape{64, 256, 256}, AxisVector{0, 2, 1}},
+                                               {Shape{32, 64, 56, 56}, AxisVector{0, 2, 3, 1}},
+                                               {Shape{32, 56, 56, 64}, AxisVector{0, 3, 1, 2}}};
+    for (auto& t : transposes)
+    {
+        Shape shape = t.first;
+        AxisVector order = t.second;
+        Shape out_shape;
+        for (auto axis : order)
+        {
+            out_shape.push_back(shape[axis]);
+        }
+        cases.push_back({"Reshape {" + join(shape) + "} by {" + join(order) + "}",
+                         [=]() {
+                             return make_unary(
+                                 [=](shared_ptr<Node> a) {
+                                     return make_shared<op::Reshape>(a, order, out_shape);
+                                 },
+                                 shape);
+                         },
+                         0,
+                         2 * shape_size(shape) * f32});
+    }
+
+    vector<pair<Shape, AxisSet>> reductions{{Shape{4096, 4096}, AxisSet{0}},
+                                            {Shape{4096, 4096}, AxisSet{1}},
+                                            {Shape{64, 256, 256}, AxisSet{0, 2}},
+                                            {Shape{32, 64, 56, 56}, AxisSet{0, 2, 3}}};
+    for (auto& r : reductions)
+    {
+        Shape shape = r.first;
+        AxisSet axes = r.second;
+        size_t n = shape_size(shape);
+        size_t reduced = 1;
+        for (auto axis : axes)
+        {
+            reduced *= shape[axis];
+        }
+        cases.push_back(
+            {"Sum {" + join(shape) + "} over {" + join(axes) + "}",
+             [=]() {
+                 return make_unary(
+                     [=](shared_ptr<Node> a) { return make_shared<op::Sum>(a, axes); }, shape);
+             },
+             double(n),
+             (n + n / reduced) * f32});
+    }
+
+    vector<pair<Shape, AxisSet>> softmaxes{{Shape{128, 1000}, AxisSet{1}},
+                                           {Shape{64, 256, 256}, AxisSet{2}},
+                                           {Shape{32, 64, 56, 56}, AxisSet{1}}};
+    for (auto& s : softmaxes)
+    {
+        Shape shape = s.first;
+        AxisSet axes = s.second;
+        size_t n = shape_size(shape);
+        // max, subtract and exp, sum, divide
+        cases.push_back(
+            {"Softmax {" + join(shape) + "} over {" + join(axes) + "}",
+             [=]() {
+                 return make_unary(
+                     [=](shared_ptr<Node> a) { return make_shared<op::Softmax>(a, axes); },
+                     shape);
+             },
+             4.0 * n,
+             2 * n * f32});
+    }
+
+    return cases;
+}
+
+int main(int argc, char** argv)
+{
+    vector<string> backends;
+    string filter;
+    string csv_path;
+    BenchmarkConfig config;
+    config.warmup_iterations = 2;
+    config.iterations = 10;
+    size_t threads = get_default_threads();
+    bool list = false;
+    bool failed = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        try
+        {
+            if (arg == "-b" || arg == "--backend")
+            {
+                backends.push_back(argv[++i]);
+            }
+            else if (arg == "-i" || arg == "--iterations")
+            {
+                config.iterations = stoull(argv[++i]);
+            }
+            else if (arg == "-w" || arg == "--warmup")
+            {
+                config.warmup_iterations = stoull(argv[++i]);
+            }
+            else if (arg == "-t" || arg == "--threads")
+            {
+                threads = stoull(argv[++i]);
+            }
+            else if (arg == "--filter")
+            {
+                filter = argv[++i];
+            }
+            else if (arg == "--csv")
+            {
+                csv_path = argv[++i];
+            }
+            else if (arg == "-l" || arg == "--list")
+            {
+                list = true;
+            }
+            else
+            {
+                cout << "Unknown option: " << arg << endl;
+                failed = true;
+            }
+        }
+        catch (...)
+        {
+            cout << "Invalid Argument\n";
+            failed = true;
+        }
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Benchmark single ops over representative shapes and compare with the machine peak.
+
+SYNOPSIS
+        opbench [-b <backend>]... [-i <iterations>] [-w <warmup>] [-t <threads>]
+                [--filter <text>] [--csv <file>] [-l]
+
+OPTIONS
+        -b|--backend       Backend to use, may be repeated (default: CPU and INTERPRETER)
+        -i|--iterations    Timed iterations per case (default: 10)
+        -w|--warmup        Untimed iterations per case (default: 2)
+        -t|--threads       Threads used to measure the machine peak
+                           (default: OMP_NUM_THREADS, else all hardware threads)
+        --filter <text>    Only run cases whose name contains <text>
+        --csv <file>       Also write the results as CSV
+        -l|--list          List the cases and exit
+)###";
+        return 1;
+    }
+
+    vector<OpCase> cases;
+    for (const OpCase& c : get_op_cases())
+    {
+        if (c.name.find(filter) != string::npos)
+        {
+            cases.push_back(c);
+        }
+    }
+    if (list)
+    {
+        for (const OpCase& c : cases)
+        {
+            cout << c.name << endl;
+        }
+        return 0;
+    }
+    if (backends.empty())
+    {
+        backends = {"CPU", "INTERPRETER"};
+    }
+
+    double peak_gflops = measure_peak_gflops(threads);
+    double peak_gbps = measure_peak_gbps(threads);
+    cout << "Machine peak with " << threads << " threads: " << fixed << setprecision(1)
+         << peak_gflops << " GFLOP/s, " << peak_gbps << " GB/s\n\n";
+
+    ofstream csv;
+    if (!csv_path.empty())
+    {
+        csv.open(csv_path);
+        csv << "backend,op,p50_ms,gflops,gflops_percent_of_peak,gbps,gbps_percent_of_peak\n";
+    }
+
+    size_t name_width = 0;
+    for (const OpCase& c : cases)
+    {
+        name_width = max(name_width, c.name.size());
+    }
+
+    for (const string& backend_name : backends)
+    {
+        try
+        {
+            runtime::Backend::create(backend_name);
+        }
+        catch (const exception& e)
+        {
+            cout << "Backend " << backend_name << " skipped: " << e.what() << "\n\n";
+            continue;
+        }
+
+        cout << backend_name << endl;
+        cout << setw(name_width + 2) << left << "op" << right << setw(12) << "p50 ms"
+             << setw(12) << "GFLOP/s" << setw(8) << "%peak" << setw(12) << "GB/s" << setw(8)
+             << "%peak" << endl;
+        for (const OpCase& c : cases)
+        {
+            BenchmarkStatistics stats;
+            try
+            {
+                stats = measure_benchmark(c.make_function(), backend_name, config);
+            }
+            catch (const exception& e)
+            {
+                cout << setw(name_width + 2) << left << c.name << right << " failed: " << e.what()
+                     << endl;
+                continue;
+            }
+            double seconds = stats.p50_ms / 1000;
+            double gflops = (seconds > 0 ? c.flops / seconds / 1e9 : 0);
+            double gbps = (seconds > 0 ? c.bytes / seconds / 1e9 : 0);
+            cout << setw(name_width + 2) << left << c.name << right << setprecision(3)
+                 << setw(12) << stats.p50_ms << setprecision(2) << setw(12) << gflops
+                 << setprecision(1) << setw(8) << 100 * gflops / peak_gflops << setprecision(2)
+                 << setw(12) << gbps << setprecision(1) << setw(8) << 100 * gbps / peak_gbps
+                 << endl;
+            if (csv.is_open())
+            {
+                csv << backend_name << ",\"" << c.name << "\"," << stats.p50_ms << "," << gflops
+                    << "," << 100 * gflops / peak_gflops << "," << gbps << ","
+                    << 100 * gbps / peak_gbps << "\n";
+            }
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
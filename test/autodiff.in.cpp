@@ -408,6 +408,57 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_add)
     EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0, x1}, .01f, .01f));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_add_n)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    Shape shape{2, 3};
+    auto x0 = rng.initialize(backend->create_tensor<float>(shape));
+    auto x1 = rng.initialize(backend->create_tensor<float>(shape));
+
+    auto make_graph = [shape]() {
+        auto X0 = make_shared<op::Parameter>(element::f32, shape);
+        auto X1 = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::AddN>(NodeVector{X0, X1 * X0, X1}),
+                                     std::vector<std::shared_ptr<op::Parameter>>{X0, X1});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0, x1}, .01f, .01f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, backwards_accumulate_unrolled)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    Shape shape{2, 3};
+    size_t steps = 50;
+    auto x0 = rng.initialize(backend->create_tensor<float>(shape));
+    auto x1 = rng.initialize(backend->create_tensor<float>(shape));
+
+    // X1 is used at every step, like an RNN weight
+    auto make_graph = [shape, steps]() {
+        auto X0 = make_shared<op::Parameter>(element::f32, shape);
+        auto X1 = make_shared<op::Parameter>(element::f32, shape);
+        shared_ptr<Node> H = X0;
+        for (size_t i = 0; i < steps; i++)
+        {
+            H = make_shared<op::Tanh>(H * X1);
+        }
+        return make_shared<Function>(H, std::vector<std::shared_ptr<op::Parameter>>{X0, X1});
+    };
+
+    // The contributions to X1's adjoint are summed by a single AddN
+    auto f = make_graph();
+    auto df = autodiff::backprop_function(f);
+    auto X1_adjoint = df->get_output_op(1)->get_argument(0);
+    ASSERT_TRUE(dynamic_pointer_cast<op::AddN>(X1_adjoint));
+    EXPECT_EQ(X1_adjoint->get_input_size(), steps);
+    EXPECT_EQ(count_ops_of_type<op::Add>(df), 0);
+
+    EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0, x1}, .01f, .01f));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, backwards_add_nested)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
@@ -1029,6 +1080,31 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_reshape)
     EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0}, .01f, .01f));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_embedding_lookup)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    Shape shape_i{5};
+    Shape shape_t{3, 2};
+    auto make_graph = [shape_i, shape_t]() {
+        auto X0 = make_shared<op::Parameter>(element::f32, shape_i);
+        auto X1 = make_shared<op::Parameter>(element::f32, shape_t);
+        return make_shared<Function>(make_shared<op::EmbeddingLookup>(X0, X1),
+                                     std::vector<std::shared_ptr<op::Parameter>>{X0, X1});
+    };
+
+    for (auto i = 0; i < ${TEST_LOOPS}; i++)
+    {
+        auto x0 = backend->create_tensor(element::f32, shape_i);
+        write_vector(x0, vector<float>{2, 0, 2, 1, 2});
+        auto x1 = rng.initialize(backend->create_tensor<float>(shape_t));
+
+        EXPECT_TRUE(autodiff_numeric_compare_selective<float>(
+            backend, make_graph, {x0, x1}, .01f, .01f, std::vector<bool>{false, true}));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, backwards_select)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
@@ -1276,6 +1352,25 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_softmax_3d)
     EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph012, {x0}, .01f, .01f));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_softmax_cross_entropy)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    test::Uniform<float> rng_labels(0.0f, 1.0f);
+    Shape shape{2, 3, 4};
+    auto x0 = rng.initialize(backend->create_tensor<float>(shape));
+    auto x1 = rng_labels.initialize(backend->create_tensor<float>(shape));
+
+    auto make_graph = [shape]() {
+        auto X0 = make_shared<op::Parameter>(element::f32, shape);
+        auto X1 = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::SoftmaxCrossEntropy>(X0, X1, AxisSet{1, 2}),
+                                     std::vector<std::shared_ptr<op::Parameter>>{X0, X1});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0, x1}, .01f, .01f));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, backwards_subtract)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
@@ -1408,6 +1503,42 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_tanh)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_tanh_chain_checkpointed)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    Shape shape{2, 3};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto W = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> Y = X;
+    for (size_t i = 0; i < 9; i++)
+    {
+        Y = make_shared<op::Tanh>(Y * W + X);
+    }
+    auto f = make_shared<Function>(Y, op::ParameterVector{X, W});
+
+    auto x = rng.initialize(backend->create_tensor<float>(shape));
+    auto w = rng.initialize(backend->create_tensor<float>(shape));
+    auto c = rng.initialize(backend->create_tensor<float>(shape));
+    auto dx = backend->create_tensor<float>(shape);
+    auto dw = backend->create_tensor<float>(shape);
+    auto dx_checkpointed = backend->create_tensor<float>(shape);
+    auto dw_checkpointed = backend->create_tensor<float>(shape);
+
+    backend->call(autodiff::backprop_function(f), {dx, dw}, {x, w, c});
+    for (auto policy : {autodiff::CheckpointPolicy(autodiff::CheckpointPolicy::Strategy::SQRT_N),
+                        autodiff::CheckpointPolicy(
+                            autodiff::CheckpointPolicy::Strategy::MEMORY_BUDGET, 64)})
+    {
+        backend->call(autodiff::backprop_function(f, policy),
+                      {dx_checkpointed, dw_checkpointed},
+                      {x, w, c});
+        EXPECT_TRUE(test::all_close(read_vector<float>(dx), read_vector<float>(dx_checkpointed)));
+        EXPECT_TRUE(test::all_close(read_vector<float>(dw), read_vector<float>(dw_checkpointed)));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, backwards_abc)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
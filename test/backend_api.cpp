@@ -14,10 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <future>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/util.hpp"
+#include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -34,3 +37,75 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+TEST(backend_api, async_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<Function>(A + B, op::ParameterVector{A, B});
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto negate = make_shared<Function>(-C, op::ParameterVector{C});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    // Chain calls of one function through the same tensor; they must run in order.
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(c, vector<float>{5, 6, 7, 8});
+    auto negated = backend->create_tensor(element::f32, shape);
+
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 8; i++)
+    {
+        futures.push_back(backend->async_call(add, {a}, {a, b}));
+    }
+    future<bool> other = backend->async_call(negate, {negated}, {c});
+
+    for (future<bool>& f : futures)
+    {
+        EXPECT_TRUE(f.get());
+    }
+    EXPECT_TRUE(other.get());
+    EXPECT_EQ((vector<float>{9, 10, 11, 12}), read_vector<float>(a));
+    EXPECT_EQ((vector<float>{-5, -6, -7, -8}), read_vector<float>(negated));
+}
+
+TEST(backend_api, async_call_exception)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(-A, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{3});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    future<bool> call = backend->async_call(f, {result}, {a});
+    EXPECT_THROW(call.get(), runtime_error);
+}
+
+TEST(backend_api, identical_functions_share_compilation)
+{
+    auto make_function = [](float scale) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto k = op::Constant::create(element::f32, Shape{3}, {scale, scale, scale});
+        return make_shared<Function>(A * k, op::ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{3});
+    copy_data(a, vector<float>{1, 2, 3});
+    auto result = backend->create_tensor(element::f32, Shape{3});
+
+    vector<shared_ptr<Function>> tenants{make_function(2), make_function(2), make_function(5)};
+    vector<vector<float>> expected{{2, 4, 6}, {2, 4, 6}, {5, 10, 15}};
+    for (size_t i = 0; i < tenants.size(); i++)
+    {
+        backend->call(tenants[i], {result}, {a});
+        EXPECT_EQ(expected[i], read_vector<float>(result));
+    }
+}
@@ -73,3 +73,64 @@ TEST(INTERPRETER, nan_check_output)
     ibackend->set_nan_check(f, true);
     EXPECT_ANY_THROW(ibackend->call(f, {result}, {a, b}));
 }
+
+TEST(INTERPRETER, performance_data_op_cost)
+{
+    Shape shape_a{4, 8};
+    Shape shape_b{8, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    auto result = backend->create_tensor(element::f32, Shape{4, 16});
+
+    backend->enable_hardware_counters(f, true);
+    backend->call(f, {result}, {a, b});
+    backend->call(f, {result}, {a, b});
+
+    bool found_dot = false;
+    for (const runtime::PerformanceCounter& p : backend->get_performance_data(f))
+    {
+        if (p.name().find("Dot") == 0)
+        {
+            found_dot = true;
+            EXPECT_EQ(p.call_count(), 2);
+            EXPECT_EQ(p.op_cost().flops, 2 * 4 * 8 * 16);
+            EXPECT_EQ(p.op_cost().bytes, (4 * 8 + 8 * 16 + 4 * 16) * sizeof(float));
+            EXPECT_DOUBLE_EQ(p.arithmetic_intensity(), p.op_cost().flops / p.op_cost().bytes);
+            if (runtime::HardwareCounters::is_available())
+            {
+                EXPECT_GT(p.hardware_counters().cycles, 0);
+                EXPECT_GT(p.ipc(), 0);
+            }
+            else
+            {
+                EXPECT_EQ(p.hardware_counters().cycles, 0);
+            }
+        }
+    }
+    EXPECT_TRUE(found_dot);
+}
+
+TEST(INTERPRETER, op_cost_estimates)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 10, 10});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{5, 3, 3, 3});
+    auto convolution = make_shared<op::Convolution>(data, filters);
+    // output {2, 5, 8, 8}, each element a dot product over 3 * 3 * 3 values
+    EXPECT_EQ(runtime::estimate_op_cost(*convolution).flops, 2.0 * (2 * 5 * 8 * 8) * 27);
+
+    auto sum = make_shared<op::Sum>(data, AxisSet{1});
+    EXPECT_EQ(runtime::estimate_op_cost(*sum).flops, 600);
+    EXPECT_EQ(runtime::estimate_op_cost(*sum).bytes, (600 + 200) * sizeof(float));
+
+    auto add = make_shared<op::Add>(data, data);
+    EXPECT_EQ(runtime::estimate_op_cost(*add).flops, 600);
+
+    auto reshape = make_shared<op::Reshape>(data, AxisVector{0, 1, 2, 3}, Shape{600});
+    EXPECT_EQ(runtime::estimate_op_cost(*reshape).flops, 0);
+    EXPECT_EQ(runtime::estimate_op_cost(*reshape).bytes, 2 * 600 * sizeof(float));
+}
@@ -27,6 +27,9 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/kernel/reshape.hpp"
+#include "ngraph/runtime/cpu/kernel/transpose.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/benchmark.hpp"
@@ -195,3 +198,76 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Compares the N-d transpose kernel with the reference loop nest and the Eigen shuffle kernel
+// (ranks 3 and 4 only) that the CPU backend used before it, on some common layout changes.
+//
+TEST(benchmark, transpose_kernels)
+{
+    const int n_runs = 20;
+    vector<pair<Shape, AxisVector>> cases{{Shape{2048, 2048}, AxisVector{1, 0}},
+                                          {Shape{64, 256, 256}, AxisVector{0, 2, 1}},
+                                          {Shape{128, 128, 128}, AxisVector{2, 1, 0}},
+                                          {Shape{32, 64, 56, 56}, AxisVector{0, 2, 3, 1}},
+                                          {Shape{32, 56, 56, 64}, AxisVector{0, 3, 1, 2}}};
+
+    for (auto& c : cases)
+    {
+        const Shape& in_shape = c.first;
+        const AxisVector& order = c.second;
+        Shape out_shape;
+        for (auto axis : order)
+        {
+            out_shape.push_back(in_shape[axis]);
+        }
+
+        vector<float> input(shape_size(in_shape));
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = static_cast<float>(i);
+        }
+        vector<float> expected(input.size());
+        vector<float> result(input.size());
+
+        auto time = [&](const string& name, function<void()> kernel) {
+            kernel();
+            stopwatch sw;
+            sw.start();
+            for (int i = 0; i < n_runs; i++)
+            {
+                kernel();
+            }
+            sw.stop();
+            std::cout << "  " << name << ": " << (sw.get_microseconds() / n_runs) << " us"
+                      << std::endl;
+        };
+
+        std::cout << "transpose {" << join(in_shape) << "} by {" << join(order) << "}"
+                  << std::endl;
+        time("reference", [&]() {
+            runtime::reference::reshape(
+                input.data(), expected.data(), in_shape, order, out_shape);
+        });
+        if (in_shape.size() == 3)
+        {
+            time("eigen", [&]() {
+                runtime::cpu::kernel::reshape<float, 3, 3>(
+                    input.data(), result.data(), in_shape, order, out_shape);
+            });
+            EXPECT_EQ(expected, result);
+        }
+        else if (in_shape.size() == 4)
+        {
+            time("eigen", [&]() {
+                runtime::cpu::kernel::reshape<float, 4, 4>(
+                    input.data(), result.data(), in_shape, order, out_shape);
+            });
+            EXPECT_EQ(expected, result);
+        }
+        time("transpose", [&]() {
+            runtime::cpu::kernel::transpose(input.data(), result.data(), in_shape, order);
+        });
+        EXPECT_EQ(expected, result);
+    }
+}
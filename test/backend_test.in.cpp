@@ -175,6 +175,32 @@ NGRAPH_TEST(${BACKEND_NAME}, ab)
               (test::NDArray<float, 2>({{6, 8}, {10, 12}})).get_vector());
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, add_n)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::AddN>(NodeVector{A, B, C, A}),
+                                   op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> result = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, test::NDArray<float, 2>({{1, 2}, {3, 4}}).get_vector());
+    copy_data(b, test::NDArray<float, 2>({{5, 6}, {7, 8}}).get_vector());
+    copy_data(c, test::NDArray<float, 2>({{9, 10}, {11, 12}}).get_vector());
+
+    backend->call(f, {result}, {a, b, c});
+    EXPECT_EQ(read_vector<float>(result),
+              (test::NDArray<float, 2>({{16, 20}, {24, 28}})).get_vector());
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, abc)
 {
     Shape shape{2, 2};
@@ -1866,6 +1892,110 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bool)
     EXPECT_EQ((vector<char>{1, 2, 3, 4}), read_vector<char>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convert_float32_float16)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Convert>(A, element::f16),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2.5f, 65504, 1e-8f, 1.0009765625f, 70000});
+    auto result = backend->create_tensor(element::f16, shape);
+
+    backend->call(f, {result}, {a});
+    vector<float16> r = read_vector<float16>(result);
+    EXPECT_EQ(1, r[0]);
+    EXPECT_EQ(-2.5, r[1]);
+    EXPECT_EQ(65504, r[2]);
+    EXPECT_EQ(0, r[3]);
+    EXPECT_EQ(1.0009765625, r[4]);
+    EXPECT_TRUE(std::isinf(r[5]));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convert_bfloat16_float32)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::bf16, shape);
+    auto f = make_shared<Function>(make_shared<op::Convert>(A, element::f32),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::bf16, shape);
+    copy_data(a, vector<bfloat16>{1, -2.5f, 3.0e38f, 0.25f});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{1, -2.5f, bfloat16(3.0e38f), 0.25f}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, add_float16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f16, shape);
+    auto B = make_shared<op::Parameter>(element::f16, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape);
+    copy_data(a, vector<float16>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f16, shape);
+    copy_data(b, vector<float16>{0.5f, 6, 7, 8});
+    auto result = backend->create_tensor(element::f16, shape);
+
+    backend->call(f, {result}, {a, b});
+    vector<float16> r = read_vector<float16>(result);
+    EXPECT_EQ((vector<float>{1.5f, 8, 10, 12}), (vector<float>{r.begin(), r.end()}));
+}
+
+// 2048 + 1 is not representable in f16, so the sum only reaches 2050 if the
+// partial sums are carried in f32.
+NGRAPH_TEST(${BACKEND_NAME}, sum_float16_accumulates_in_float32)
+{
+    Shape shape_a{2050};
+    auto A = make_shared<op::Parameter>(element::f16, shape_a);
+    auto f = make_shared<Function>(make_shared<op::Sum>(A, AxisSet{0}), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape_a);
+    copy_data(a, vector<float16>(shape_size(shape_a), 1));
+    auto result = backend->create_tensor(element::f16, Shape{});
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ(2050, read_vector<float16>(result)[0]);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dot_bfloat16_accumulates_in_float32)
+{
+    Shape shape_a{2, 258};
+    Shape shape_b{258, 1};
+    auto A = make_shared<op::Parameter>(element::bf16, shape_a);
+    auto B = make_shared<op::Parameter>(element::bf16, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::bf16, shape_a);
+    copy_data(a, vector<bfloat16>(shape_size(shape_a), 1));
+    auto b = backend->create_tensor(element::bf16, shape_b);
+    copy_data(b, vector<bfloat16>(shape_size(shape_b), 1));
+    auto result = backend->create_tensor(element::bf16, Shape{2, 1});
+
+    backend->call(f, {result}, {a, b});
+    vector<bfloat16> r = read_vector<bfloat16>(result);
+    EXPECT_EQ((vector<float>{258, 258}), (vector<float>{r.begin(), r.end()}));
+}
+
 // Trivial case with no reduction axes.
 NGRAPH_TEST(${BACKEND_NAME}, reduce_trivial)
 {
@@ -3674,6 +3804,98 @@ NGRAPH_TEST(${BACKEND_NAME}, one_hot_vector_1_fp_nonint)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_matrix)
+{
+    Shape shape_i{2, 2};
+    auto I = make_shared<op::Parameter>(element::i32, shape_i);
+    Shape shape_t{4, 3};
+    auto T = make_shared<op::Parameter>(element::f32, shape_t);
+    Shape shape_r{2, 2, 3};
+    auto r = make_shared<op::EmbeddingLookup>(I, T);
+    auto f = make_shared<Function>(r, op::ParameterVector{I, T});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto i = backend->create_tensor(element::i32, shape_i);
+    copy_data(i, vector<int32_t>{3, 0, 1, 3});
+    auto t = backend->create_tensor(element::f32, shape_t);
+    copy_data(t, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    backend->call(f, {result}, {i, t});
+    EXPECT_EQ((vector<float>{10, 11, 12, 1, 2, 3, 4, 5, 6, 10, 11, 12}),
+              read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_fp_indices)
+{
+    Shape shape_i{3};
+    auto I = make_shared<op::Parameter>(element::f32, shape_i);
+    Shape shape_t{3, 2};
+    auto T = make_shared<op::Parameter>(element::i32, shape_t);
+    Shape shape_r{3, 2};
+    auto r = make_shared<op::EmbeddingLookup>(I, T);
+    auto f = make_shared<Function>(r, op::ParameterVector{I, T});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto i = backend->create_tensor(element::f32, shape_i);
+    copy_data(i, vector<float>{2, 0, 2});
+    auto t = backend->create_tensor(element::i32, shape_t);
+    copy_data(t, vector<int32_t>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::i32, shape_r);
+
+    backend->call(f, {result}, {i, t});
+    EXPECT_EQ((vector<int32_t>{5, 6, 1, 2, 5, 6}), read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_oob)
+{
+    Shape shape_i{2};
+    auto I = make_shared<op::Parameter>(element::i32, shape_i);
+    Shape shape_t{3, 2};
+    auto T = make_shared<op::Parameter>(element::f32, shape_t);
+    Shape shape_r{2, 2};
+    auto r = make_shared<op::EmbeddingLookup>(I, T);
+    auto f = make_shared<Function>(r, op::ParameterVector{I, T});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto i = backend->create_tensor(element::i32, shape_i);
+    copy_data(i, vector<int32_t>{1, 3});
+    auto t = backend->create_tensor(element::f32, shape_t);
+    copy_data(t, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    EXPECT_THROW(backend->call(f, {result}, {i, t}), std::range_error);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_backprop_repeated_indices)
+{
+    Shape shape_i{4};
+    auto I = make_shared<op::Parameter>(element::i32, shape_i);
+    Shape shape_d{4, 2};
+    auto D = make_shared<op::Parameter>(element::f32, shape_d);
+    Shape shape_r{3, 2};
+    auto r = make_shared<op::EmbeddingLookupBackprop>(I, D, shape_r);
+    auto f = make_shared<Function>(r, op::ParameterVector{I, D});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto i = backend->create_tensor(element::i32, shape_i);
+    copy_data(i, vector<int32_t>{1, 0, 1, 1});
+    auto d = backend->create_tensor(element::f32, shape_d);
+    copy_data(d, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    backend->call(f, {result}, {i, d});
+    EXPECT_EQ((vector<float>{3, 4, 13, 16, 0, 0}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, replace_slice_3d)
 {
     Shape shape_a{4, 4, 4};
@@ -7593,6 +7815,63 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_underflow)
     EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, softmax_cross_entropy_matrix)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::SoftmaxCrossEntropy>(A, B, AxisSet{1}),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, -1, 0, 1});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{0, 0, 1, 0.25f, 0.25f, 0.5f});
+    auto result = backend->create_tensor(element::f32, Shape{2});
+
+    auto log_d = logf(expf(1) + expf(2) + expf(3));
+    backend->call(f, {result}, {a, b});
+    vector<float> expected{log_d - 3, log_d - 2 - 0.25f};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_cross_entropy_large_logits)
+{
+    Shape shape{1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::SoftmaxCrossEntropy>(A, B, AxisSet{1}),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // exp of these logits overflows float; the loss and its gradient must not
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1000, 1001, 1002});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 0, 0});
+    auto result = backend->create_tensor(element::f32, Shape{1});
+
+    backend->call(f, {result}, {a, b});
+    vector<float> expected{logf(expf(-2) + expf(-1) + 1) + 2};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
+
+    auto C = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto g = make_shared<Function>(
+        make_shared<op::SoftmaxCrossEntropyBackprop>(A, B, C, AxisSet{1}),
+        op::ParameterVector{A, B, C});
+    auto c = backend->create_tensor(element::f32, Shape{1});
+    copy_data(c, vector<float>{2});
+    auto d_logits = backend->create_tensor(element::f32, shape);
+
+    backend->call(g, {d_logits}, {a, b, c});
+    auto d = expf(-2) + expf(-1) + 1;
+    vector<float> expected_d_logits{2 * (expf(-2) / d - 1), 2 * expf(-1) / d, 2 / d};
+    EXPECT_TRUE(test::all_close(expected_d_logits, read_vector<float>(d_logits)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, multiple_backends)
 {
     Shape shape{2, 2};
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "util/all_close.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// tanh(X W) for a batch of batch_size rows of 3 features.
+static shared_ptr<Function> make_layer(size_t batch_size)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{batch_size, 3});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto tanh = make_shared<op::Tanh>(make_shared<op::Dot>(X, W));
+    return make_shared<Function>(tanh, op::ParameterVector{X, W});
+}
+
+TEST(batching_executor, results_match_single_calls)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto w = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(w, vector<float>{0.5f, -1.0f, 0.25f, 0.75f, -0.5f, 0.125f});
+
+    runtime::BatchingConfig config;
+    config.max_batch = 4;
+    config.max_delay = chrono::milliseconds(20);
+    runtime::BatchingExecutor executor(backend, make_layer(4), config, {{1, w}});
+
+    const size_t count = 11;
+    vector<shared_ptr<runtime::TensorView>> inputs;
+    vector<shared_ptr<runtime::TensorView>> outputs;
+    vector<future<void>> futures;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto x = backend->create_tensor(element::f32, Shape{1, 3});
+        copy_data(x, vector<float>{0.1f * i, -0.2f * i, 1.0f});
+        auto y = backend->create_tensor(element::f32, Shape{1, 2});
+        futures.push_back(executor.submit({x}, {y}));
+        inputs.push_back(x);
+        outputs.push_back(y);
+    }
+
+    auto f = make_layer(1);
+    for (size_t i = 0; i < count; i++)
+    {
+        futures[i].get();
+        auto expected = backend->create_tensor(element::f32, Shape{1, 2});
+        backend->call(f, {expected}, {inputs[i], w});
+        EXPECT_TRUE(test::all_close(read_vector<float>(expected), read_vector<float>(outputs[i])))
+            << "request " << i;
+    }
+
+    runtime::BatchingStatistics statistics = executor.get_statistics();
+    EXPECT_EQ(count, statistics.requests);
+    EXPECT_GE(statistics.batches, 3u);
+    EXPECT_GT(statistics.mean_fill_ratio, 0);
+    EXPECT_LE(statistics.mean_fill_ratio, 1);
+    EXPECT_GE(statistics.max_queue_ms, statistics.mean_queue_ms);
+}
+
+TEST(batching_executor, rejects_bad_request)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto w = backend->create_tensor(element::f32, Shape{3, 2});
+    runtime::BatchingConfig config;
+    config.max_batch = 2;
+    runtime::BatchingExecutor executor(backend, make_layer(2), config, {{1, w}});
+
+    auto x = backend->create_tensor(element::f32, Shape{2, 3});
+    auto y = backend->create_tensor(element::f32, Shape{1, 2});
+    EXPECT_THROW(executor.submit({x}, {y}), runtime_error);
+    EXPECT_THROW(executor.submit({}, {y}), runtime_error);
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/bucketed_batch_function.hpp"
+#include "util/all_close.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// softmax(relu(X W + b)) for a batch of batch_size rows of 4 features.
+static shared_ptr<Function> make_classifier(size_t batch_size)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{batch_size, 4});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto b = op::Constant::create(element::f32, Shape{3}, {0.5f, -0.25f, 0.125f});
+    auto dot = make_shared<op::Dot>(X, W);
+    auto bias = make_shared<op::Broadcast>(b, Shape{batch_size, 3}, AxisSet{0});
+    auto relu = make_shared<op::Relu>(dot + bias);
+    auto softmax = make_shared<op::Softmax>(relu, AxisSet{1});
+    return make_shared<Function>(softmax, op::ParameterVector{X, W});
+}
+
+TEST(bucketed_batch, matches_fixed_shape)
+{
+    const size_t max_batch = 6;
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BucketedBatchFunction bbf(backend, make_classifier(max_batch), max_batch, {0});
+
+    default_random_engine engine(0);
+    uniform_real_distribution<float> dist(-1, 1);
+    vector<float> weights(12);
+    for (float& w : weights)
+    {
+        w = dist(engine);
+    }
+    auto w = backend->create_tensor(element::f32, Shape{4, 3});
+    copy_data(w, weights);
+
+    for (size_t batch_size = 1; batch_size <= max_batch; batch_size++)
+    {
+        vector<float> data(batch_size * 4);
+        for (float& x : data)
+        {
+            x = dist(engine);
+        }
+        auto x = backend->create_tensor(element::f32, Shape{batch_size, 4});
+        copy_data(x, data);
+
+        auto result = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        bbf.call({result}, {x, w});
+
+        auto f = make_classifier(batch_size);
+        auto expected = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        backend->call(f, {expected}, {x, w});
+
+        EXPECT_TRUE(test::all_close(read_vector<float>(expected), read_vector<float>(result)))
+            << "batch of " << batch_size;
+    }
+    EXPECT_EQ((vector<size_t>{1, 2, 4, 6}), bbf.get_compiled_batch_sizes());
+}
+
+TEST(bucketed_batch, specialization_shapes)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BucketedBatchFunction bbf(backend, make_classifier(16), 16);
+
+    auto f = bbf.get_function(4);
+    EXPECT_EQ((Shape{4, 4}), f->get_parameters()[0]->get_shape());
+    EXPECT_EQ((Shape{4, 3}), f->get_parameters()[1]->get_shape());
+    EXPECT_EQ((Shape{4, 3}), f->get_output_shape(0));
+    EXPECT_EQ((vector<size_t>{4}), bbf.get_compiled_batch_sizes());
+
+    EXPECT_THROW(bbf.get_function(3), ngraph_error);
+    EXPECT_THROW(bbf.get_function(32), ngraph_error);
+}
+
+TEST(bucketed_batch, rejects_batch_reduction)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto X = make_shared<op::Parameter>(element::f32, Shape{8, 4});
+
+    auto sum = make_shared<Function>(make_shared<op::Sum>(X, AxisSet{0}), op::ParameterVector{X});
+    EXPECT_THROW(runtime::BucketedBatchFunction(backend, sum, 8), ngraph_error);
+
+    auto softmax =
+        make_shared<Function>(make_shared<op::Softmax>(X, AxisSet{0}), op::ParameterVector{X});
+    EXPECT_THROW(runtime::BucketedBatchFunction(backend, softmax, 8), ngraph_error);
+
+    auto rows = make_shared<Function>(make_shared<op::Sum>(X, AxisSet{1}), op::ParameterVector{X});
+    EXPECT_NO_THROW(runtime::BucketedBatchFunction(backend, rows, 8));
+}
+
+TEST(bucketed_batch, rejects_bad_batch)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BucketedBatchFunction bbf(backend, make_classifier(4), 4, {0});
+
+    auto w = backend->create_tensor(element::f32, Shape{4, 3});
+    auto x = backend->create_tensor(element::f32, Shape{5, 4});
+    auto result = backend->create_tensor(element::f32, Shape{5, 3});
+    EXPECT_THROW(bbf.call({result}, {x, w}), runtime_error);
+
+    x = backend->create_tensor(element::f32, Shape{2, 4});
+    EXPECT_THROW(bbf.call({result}, {x, w}), runtime_error);
+}
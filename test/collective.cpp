@@ -0,0 +1,477 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/collective.hpp"
+#include "ngraph/runtime/shm_ring_collective.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Runs body for ranks 0 to size - 1, rank 0 in this process and the others in forked ones.
+// Returns whether body returned true in every process.
+static bool run_ranks(size_t size, const function<bool(size_t)>& body)
+{
+    vector<pid_t> children;
+    for (size_t rank = 1; rank < size; rank++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            bool ok = false;
+            try
+            {
+                ok = body(rank);
+            }
+            catch (const exception& e)
+            {
+                cerr << "rank " << rank << ": " << e.what() << endl;
+            }
+            _exit(ok ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+
+    bool ok = false;
+    try
+    {
+        ok = body(0);
+    }
+    catch (...)
+    {
+        // The others would wait for this process forever
+        for (pid_t pid : children)
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+        throw;
+    }
+    for (pid_t pid : children)
+    {
+        int status;
+        waitpid(pid, &status, 0);
+        ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    return ok;
+}
+
+static string get_segment_name(const string& test)
+{
+    return "/ngraph_" + test + "_" + to_string(getpid());
+}
+
+// Stands in for size processes that all hold the same data, so every sum is size times it.
+class ScaleCollective : public runtime::Collective
+{
+public:
+    ScaleCollective(size_t size)
+        : m_size(size)
+    {
+    }
+
+    size_t get_rank() const override { return 0; }
+    size_t get_size() const override { return m_size; }
+    size_t m_calls = 0;
+
+protected:
+    void do_allreduce(void* data, size_t count, const element::Type& element_type) override
+    {
+        m_calls++;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (element_type == element::f32)
+            {
+                static_cast<float*>(data)[i] *= m_size;
+            }
+            else
+            {
+                static_cast<double*>(data)[i] *= m_size;
+            }
+        }
+    }
+
+private:
+    size_t m_size;
+};
+
+// Waits for a value to appear at watched, as it does once the ops independent of the
+// AllReduce have run, and tracks how many allreduces run at once.
+class WatchingCollective : public ScaleCollective
+{
+public:
+    WatchingCollective(const volatile float* watched, float expected)
+        : ScaleCollective(1)
+        , m_watched(watched)
+        , m_expected(expected)
+    {
+    }
+
+    bool m_saw_expected = false;
+    atomic<size_t> m_running{0};
+    atomic<size_t> m_max_running{0};
+
+protected:
+    void do_allreduce(void* data, size_t count, const element::Type& element_type) override
+    {
+        size_t running = ++m_running;
+        if (running > m_max_running)
+        {
+            m_max_running = running;
+        }
+        auto deadline = chrono::steady_clock::now() + chrono::seconds(5);
+        while (m_watched && *m_watched != m_expected && chrono::steady_clock::now() < deadline)
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        m_saw_expected = m_watched && *m_watched == m_expected;
+        this_thread::sleep_for(chrono::milliseconds(10));
+        ScaleCollective::do_allreduce(data, count, element_type);
+        m_running--;
+    }
+
+private:
+    const volatile float* m_watched;
+    float m_expected;
+};
+
+static size_t count_all_reduces(const shared_ptr<Function>& f)
+{
+    size_t count = 0;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (node->description() == "AllReduce")
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Gradients of several shapes and types, each summed across processes and scaled.
+static shared_ptr<Function> make_gradients()
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{});
+    auto D = make_shared<op::Parameter>(element::f64, Shape{2});
+    auto two_f32 = op::Constant::create(element::f32, Shape{}, {2});
+    auto two_f64 = op::Constant::create(element::f64, Shape{2}, {2, 2});
+    auto scaled_c = make_shared<op::AllReduce>(C * two_f32);
+    return make_shared<Function>(NodeVector{make_shared<op::AllReduce>(A),
+                                            make_shared<op::AllReduce>(B),
+                                            scaled_c,
+                                            make_shared<op::AllReduce>(D) * two_f64},
+                                 op::ParameterVector{A, B, C, D});
+}
+
+TEST(collective, shm_ring_allreduce)
+{
+    string name = get_segment_name("shm_ring_allreduce");
+    EXPECT_TRUE(run_ranks(4, [&](size_t rank) {
+        // 64 floats a chunk, so 1000 floats take four pieces
+        runtime::ShmRingCollective collective(name, rank, 4, 256);
+
+        vector<float> data(1000);
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = rank * 1000 + i;
+        }
+        collective.allreduce(data.data(), data.size(), element::f32);
+
+        // Fewer elements than processes leaves some chunks empty
+        vector<int64_t> small{int64_t(rank), 1, -int64_t(rank)};
+        collective.allreduce(small.data(), small.size(), element::i64);
+
+        bool ok = small == vector<int64_t>{6, 4, -6};
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            ok = ok && data[i] == 6000 + 4 * i;
+        }
+        return ok;
+    }));
+}
+
+TEST(collective, shm_ring_invalid_rank)
+{
+    EXPECT_THROW(runtime::ShmRingCollective(get_segment_name("invalid_rank"), 2, 2),
+                 ngraph_error);
+}
+
+TEST(collective, allreduce_bucketing)
+{
+    auto f = make_gradients();
+    auto g = make_gradients();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(g);
+    // One bucket of f32 gradients and one of f64
+    EXPECT_EQ(count_all_reduces(g), 2);
+
+    // A bucket closes once it reaches 24 bytes, the size of A
+    auto h = make_gradients();
+    pass::Manager small_bucket_manager;
+    small_bucket_manager.register_pass<pass::AllReduceBucketing>(24);
+    small_bucket_manager.run_passes(h);
+    EXPECT_EQ(count_all_reduces(h), 3);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{2, 3});
+    auto b = backend->create_tensor(element::f32, Shape{4});
+    auto c = backend->create_tensor(element::f32, Shape{});
+    auto d = backend->create_tensor(element::f64, Shape{2});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{7, 8, 9, 10});
+    copy_data(c, vector<float>{11});
+    copy_data(d, vector<double>{12, 13});
+
+    auto collective = make_shared<ScaleCollective>(3);
+    runtime::set_collective(collective);
+    for (auto function : {f, g, h})
+    {
+        auto ra = backend->create_tensor(element::f32, Shape{2, 3});
+        auto rb = backend->create_tensor(element::f32, Shape{4});
+        auto rc = backend->create_tensor(element::f32, Shape{});
+        auto rd = backend->create_tensor(element::f64, Shape{2});
+        collective->m_calls = 0;
+        backend->call(function, {ra, rb, rc, rd}, {a, b, c, d});
+        EXPECT_EQ(collective->m_calls, count_all_reduces(function));
+        EXPECT_EQ(read_vector<float>(ra), (vector<float>{3, 6, 9, 12, 15, 18}));
+        EXPECT_EQ(read_vector<float>(rb), (vector<float>{21, 24, 27, 30}));
+        EXPECT_EQ(read_vector<float>(rc), (vector<float>{66}));
+        EXPECT_EQ(read_vector<double>(rd), (vector<double>{72, 78}));
+    }
+    runtime::set_collective(nullptr);
+}
+
+// Sync-BN style: one AllReduce feeds another, so they cannot share a bucket.
+TEST(collective, allreduce_bucketing_chained)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto two = op::Constant::create(element::f32, Shape{2}, {2, 2});
+    auto first = make_shared<op::AllReduce>(A);
+    auto second = make_shared<op::AllReduce>(first * two);
+    auto f = make_shared<Function>(NodeVector{first, make_shared<op::AllReduce>(B), second},
+                                   op::ParameterVector{A, B});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+    // The chained AllReduce is in its own bucket, and B shares one with either of the others
+    EXPECT_EQ(count_all_reduces(f), 2);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{2});
+    auto b = backend->create_tensor(element::f32, Shape{3});
+    copy_data(a, vector<float>{1, 2});
+    copy_data(b, vector<float>{3, 4, 5});
+    auto r0 = backend->create_tensor(element::f32, Shape{2});
+    auto r1 = backend->create_tensor(element::f32, Shape{3});
+    auto r2 = backend->create_tensor(element::f32, Shape{2});
+
+    auto collective = make_shared<ScaleCollective>(3);
+    runtime::set_collective(collective);
+    backend->call(f, {r0, r1, r2}, {a, b});
+    runtime::set_collective(nullptr);
+    EXPECT_EQ(collective->m_calls, 2);
+    EXPECT_EQ(read_vector<float>(r0), (vector<float>{3, 6}));
+    EXPECT_EQ(read_vector<float>(r1), (vector<float>{9, 12, 15}));
+    EXPECT_EQ(read_vector<float>(r2), (vector<float>{18, 36}));
+}
+
+TEST(collective, interpreter_overlap)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto reduced = make_shared<op::AllReduce>(A);
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::Negative>(make_shared<op::Negative>(reduced)),
+                   make_shared<op::Negative>(B)},
+        op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{2});
+    auto b = backend->create_tensor(element::f32, Shape{2});
+    copy_data(a, vector<float>{1, 2});
+    copy_data(b, vector<float>{3, 4});
+    auto r0 = backend->create_tensor(element::f32, Shape{2});
+    vector<float> independent(2, 0);
+    auto r1 = backend->create_tensor(element::f32, Shape{2}, independent.data());
+
+    // The AllReduce only finishes once Negative(B) has been written to r1
+    auto collective = make_shared<WatchingCollective>(independent.data(), -3);
+    runtime::set_collective(collective);
+    backend->call(f, {r0, r1}, {a, b});
+    runtime::set_collective(nullptr);
+    EXPECT_TRUE(collective->m_saw_expected);
+    EXPECT_EQ(read_vector<float>(r0), (vector<float>{1, 2}));
+    EXPECT_EQ(independent, (vector<float>{-3, -4}));
+}
+
+TEST(collective, concurrent_calls)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+        return make_shared<Function>(NodeVector{make_shared<op::AllReduce>(A)},
+                                     op::ParameterVector{A});
+    };
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto collective = make_shared<WatchingCollective>(nullptr, 0);
+    runtime::set_collective(collective);
+
+    // Calls of different functions run at the same time, but their allreduces do not
+    vector<future<bool>> calls;
+    vector<shared_ptr<runtime::TensorView>> results;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{2});
+        copy_data(a, vector<float>{float(i), 1});
+        results.push_back(backend->create_tensor(element::f32, Shape{2}));
+        calls.push_back(backend->async_call(make_function(), {results.back()}, {a}));
+    }
+    for (size_t i = 0; i < calls.size(); i++)
+    {
+        EXPECT_TRUE(calls[i].get());
+        EXPECT_EQ(read_vector<float>(results[i]), (vector<float>{float(i), 1}));
+    }
+    runtime::set_collective(nullptr);
+    EXPECT_EQ(collective->m_calls, 4);
+    EXPECT_EQ(collective->m_max_running, 1);
+}
+
+TEST(collective, interpreter_shm_ring)
+{
+    string name = get_segment_name("interpreter_shm_ring");
+    EXPECT_TRUE(run_ranks(2, [&](size_t rank) {
+        runtime::set_collective(make_shared<runtime::ShmRingCollective>(name, rank, 2));
+
+        auto f = make_gradients();
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AllReduceBucketing>();
+        pass_manager.run_passes(f);
+
+        auto backend = runtime::Backend::create("INTERPRETER");
+        float r = rank + 1;
+        auto a = backend->create_tensor(element::f32, Shape{2, 3});
+        auto b = backend->create_tensor(element::f32, Shape{4});
+        auto c = backend->create_tensor(element::f32, Shape{});
+        auto d = backend->create_tensor(element::f64, Shape{2});
+        copy_data(a, vector<float>{r, r, r, r, r, r});
+        copy_data(b, vector<float>{r, 2 * r, 3 * r, 4 * r});
+        copy_data(c, vector<float>{r});
+        copy_data(d, vector<double>{r, -r});
+
+        auto ra = backend->create_tensor(element::f32, Shape{2, 3});
+        auto rb = backend->create_tensor(element::f32, Shape{4});
+        auto rc = backend->create_tensor(element::f32, Shape{});
+        auto rd = backend->create_tensor(element::f64, Shape{2});
+        backend->call(f, {ra, rb, rc, rd}, {a, b, c, d});
+        runtime::set_collective(nullptr);
+
+        // The ranks contribute 1 and 2
+        return read_vector<float>(ra) == vector<float>{3, 3, 3, 3, 3, 3} &&
+               read_vector<float>(rb) == vector<float>{3, 6, 9, 12} &&
+               read_vector<float>(rc) == vector<float>{6} &&
+               read_vector<double>(rd) == vector<double>{6, -6};
+    }));
+}
+
+#ifdef NGRAPH_CPU_ENABLE
+// Data-parallel step of a stack of small layers, each output standing in for a gradient that
+// is summed over two processes. Compares an AllReduce per gradient with one per bucket.
+TEST(benchmark, allreduce_bucketing)
+{
+    const size_t layers = 200;
+    const size_t iterations = 20;
+    auto make_step = [&]() {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{8, 8});
+        op::ParameterVector parameters{X};
+        NodeVector gradients;
+        shared_ptr<Node> activation = X;
+        for (size_t i = 0; i < layers; i++)
+        {
+            auto W = make_shared<op::Parameter>(element::f32, Shape{8, 8});
+            parameters.push_back(W);
+            activation = make_shared<op::Tanh>(make_shared<op::Dot>(activation, W));
+            gradients.push_back(make_shared<op::AllReduce>(activation));
+        }
+        return make_shared<Function>(gradients, parameters);
+    };
+
+    for (size_t bucket_bytes : {size_t(0), size_t(64 * 1024), size_t(1024 * 1024)})
+    {
+        string name = get_segment_name("benchmark_" + to_string(bucket_bytes));
+        EXPECT_TRUE(run_ranks(2, [&](size_t rank) {
+            runtime::set_collective(make_shared<runtime::ShmRingCollective>(name, rank, 2));
+            auto f = make_step();
+            if (bucket_bytes > 0)
+            {
+                pass::Manager pass_manager;
+                pass_manager.register_pass<pass::AllReduceBucketing>(bucket_bytes);
+                pass_manager.run_passes(f);
+            }
+
+            auto backend = runtime::Backend::create("INTERPRETER");
+            vector<shared_ptr<runtime::TensorView>> inputs;
+            for (auto parameter : f->get_parameters())
+            {
+                auto tensor = backend->create_tensor(element::f32, parameter->get_shape());
+                copy_data(tensor, vector<float>(shape_size(parameter->get_shape()), 0.01f));
+                inputs.push_back(tensor);
+            }
+            vector<shared_ptr<runtime::TensorView>> outputs;
+            for (auto result : f->get_results())
+            {
+                outputs.push_back(backend->create_tensor(element::f32, result->get_shape()));
+            }
+
+            backend->call(f, outputs, inputs);
+            stopwatch timer;
+            timer.start();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                backend->call(f, outputs, inputs);
+            }
+            timer.stop();
+            if (rank == 0)
+            {
+                cout << "bucket bytes " << bucket_bytes << ": " << count_all_reduces(f)
+                     << " AllReduces, " << timer.get_microseconds() / iterations
+                     << "us per step" << endl;
+            }
+            runtime::set_collective(nullptr);
+            return true;
+        }));
+    }
+}
+#endif
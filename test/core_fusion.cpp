@@ -27,6 +27,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -36,6 +37,7 @@
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
+#include "util/all_close.hpp"
 #include "util/matcher.hpp"
 #include "util/test_tools.hpp"
 
@@ -55,3 +57,114 @@ TEST(core_fusion, core_fusion_pass_basic)
     pass_manager.run_passes(func);
     ASSERT_NE(std::dynamic_pointer_cast<op::Relu>(graph->get_argument(0)), nullptr);
 }
+
+// -Sum(labels * Log(Softmax(logits, {1})), sum_axes) on [3, 4] logits
+static shared_ptr<Function> make_softmax_cross_entropy_loss(const AxisSet& softmax_axes,
+                                                            const AxisSet& sum_axes)
+{
+    Shape shape{3, 4};
+    auto logits = make_shared<op::Parameter>(element::f32, shape);
+    auto labels = make_shared<op::Parameter>(element::f32, shape);
+    auto log_softmax = make_shared<op::Log>(make_shared<op::Softmax>(logits, softmax_axes));
+    auto loss = make_shared<op::Negative>(make_shared<op::Sum>(labels * log_softmax, sum_axes));
+    return make_shared<Function>(loss, op::ParameterVector{logits, labels});
+}
+
+TEST(core_fusion, softmax_cross_entropy)
+{
+    auto func = make_softmax_cross_entropy_loss(AxisSet{1}, AxisSet{1});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(func);
+    auto loss = std::dynamic_pointer_cast<op::SoftmaxCrossEntropy>(
+        func->get_results().at(0)->get_argument(0));
+    ASSERT_NE(loss, nullptr);
+    EXPECT_EQ(loss->get_axes(), AxisSet{1});
+    EXPECT_EQ(count_ops_of_type<op::Softmax>(func), 0);
+}
+
+TEST(core_fusion, softmax_cross_entropy_summed_over_batch)
+{
+    auto func = make_softmax_cross_entropy_loss(AxisSet{1}, AxisSet{0, 1});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(func);
+    auto sum = std::dynamic_pointer_cast<op::Sum>(func->get_results().at(0)->get_argument(0));
+    ASSERT_NE(sum, nullptr);
+    EXPECT_EQ(sum->get_reduction_axes(), AxisSet{0});
+    ASSERT_NE(std::dynamic_pointer_cast<op::SoftmaxCrossEntropy>(sum->get_argument(0)), nullptr);
+}
+
+TEST(core_fusion, softmax_cross_entropy_not_fused_softmax_over_batch)
+{
+    auto func = make_softmax_cross_entropy_loss(AxisSet{0}, AxisSet{0, 1});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::SoftmaxCrossEntropy>(func), 0);
+}
+
+TEST(core_fusion, softmax_cross_entropy_not_fused_class_axis_not_summed)
+{
+    auto func = make_softmax_cross_entropy_loss(AxisSet{1}, AxisSet{0});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::SoftmaxCrossEntropy>(func), 0);
+}
+
+// Softmax(x) written out as Exp(x) / Sum(Exp(x)), optionally with the maximum subtracted first
+static shared_ptr<Node> make_written_out_softmax(const shared_ptr<Node>& x,
+                                                 const AxisSet& axes,
+                                                 bool subtract_max)
+{
+    const Shape& shape = x->get_shape();
+    shared_ptr<Node> shifted = x;
+    if (subtract_max)
+    {
+        auto max = make_shared<op::Broadcast>(make_shared<op::Max>(x, axes), shape, axes);
+        shifted = x - max;
+    }
+    auto exp = make_shared<op::Exp>(shifted);
+    return exp / make_shared<op::Broadcast>(make_shared<op::Sum>(exp, axes), shape, axes);
+}
+
+TEST(core_fusion, softmax_cross_entropy_written_out)
+{
+    Shape shape{3, 4};
+    vector<float> logits_data{1, 2, 3, 4, -1, 0, 50, 2, 0.5f, 0.5f, 0.5f, 0.5f};
+    vector<float> labels_data{0, 0, 1, 0, 0.25f, 0.25f, 0.25f, 0.25f, 1, 0, 0, 0};
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    for (bool subtract_max : {false, true})
+    {
+        // -labels * log(softmax) summed over the classes, with the negation inside the Sum
+        auto logits = make_shared<op::Parameter>(element::f32, shape);
+        auto labels = make_shared<op::Parameter>(element::f32, shape);
+        auto log_softmax =
+            make_shared<op::Log>(make_written_out_softmax(logits, AxisSet{1}, subtract_max));
+        auto loss = make_shared<op::Sum>(make_shared<op::Negative>(labels * log_softmax),
+                                         AxisSet{1});
+        auto func = make_shared<Function>(loss, op::ParameterVector{logits, labels});
+        auto unfused = clone_function(*func);
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CoreFusion>();
+        pass_manager.run_passes(func);
+        ASSERT_NE(std::dynamic_pointer_cast<op::SoftmaxCrossEntropy>(
+                      func->get_results().at(0)->get_argument(0)),
+                  nullptr);
+        EXPECT_EQ(count_ops_of_type<op::Exp>(func), 0);
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(a, logits_data);
+        copy_data(b, labels_data);
+        auto fused_result = backend->create_tensor(element::f32, Shape{3});
+        auto unfused_result = backend->create_tensor(element::f32, Shape{3});
+        backend->call(func, {fused_result}, {a, b});
+        backend->call(unfused, {unfused_result}, {a, b});
+        EXPECT_TRUE(test::all_close(read_vector<float>(unfused_result),
+                                    read_vector<float>(fused_result)));
+    }
+}
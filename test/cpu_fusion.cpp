@@ -44,6 +44,7 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
@@ -1234,3 +1235,296 @@ TEST(cpu_fusion, backwards_maxpool_with_indices_n4_c1_hw4_2x2_max)
     backend->call(df, {output}, {input, ep});
     ASSERT_TRUE(read_vector<float>(output) == expected);
 }
+
+TEST(cpu_fusion, fuse_embedding_lookup)
+{
+    Shape shape_i{2, 2};
+    Shape shape_t{4, 3};
+    auto indices = make_shared<op::Parameter>(element::i32, shape_i);
+    auto table = make_shared<op::Parameter>(element::f32, shape_t);
+    auto one_hot = make_shared<op::OneHot>(make_shared<op::Convert>(indices, element::f32),
+                                           Shape{2, 2, 4},
+                                           2);
+    auto dot = make_shared<op::Dot>(one_hot, table);
+    auto func = make_shared<Function>(dot, op::ParameterVector{indices, table});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::EmbeddingLookup>(func), 1u);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(func), 0u);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto i = backend->create_tensor(element::i32, shape_i);
+    copy_data(i, vector<int32_t>{3, 0, 1, 3});
+    auto t = backend->create_tensor(element::f32, shape_t);
+    copy_data(t, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2, 3});
+
+    backend->call(func, {result}, {i, t});
+    EXPECT_EQ((vector<float>{10, 11, 12, 1, 2, 3, 4, 5, 6, 10, 11, 12}),
+              read_vector<float>(result));
+}
+
+TEST(cpu_fusion, embedding_lookup_not_fused_inner_one_hot_axis)
+{
+    auto indices = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto table = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto one_hot = make_shared<op::OneHot>(indices, Shape{2, 2}, 0);
+    auto dot = make_shared<op::Dot>(one_hot, table);
+    auto func = make_shared<Function>(dot, op::ParameterVector{indices, table});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::EmbeddingLookup>(func), 0u);
+}
+
+// h_t and c_t of one LSTM cell on a [N, 4H] gate matrix. With cpu_sigmoid the gates use
+// op::Sigmoid so that the cell fuses; otherwise they are spelled out for the INTERPRETER.
+static NodeVector make_lstm_outputs(shared_ptr<Node> gates,
+                                    shared_ptr<Node> c_prev,
+                                    bool cpu_sigmoid,
+                                    shared_ptr<Node>* forget_output = nullptr)
+{
+    size_t n = c_prev->get_shape()[0];
+    size_t h = c_prev->get_shape()[1];
+    Shape cell_shape{n, h};
+    auto gate = [&](size_t i) {
+        return make_shared<op::Slice>(gates, Coordinate{0, i * h}, Coordinate{n, (i + 1) * h});
+    };
+    auto sigmoid = [&](shared_ptr<Node> arg) -> shared_ptr<Node> {
+        if (cpu_sigmoid)
+        {
+            return make_shared<op::Sigmoid>(arg);
+        }
+        auto one = op::Constant::create(element::f32, cell_shape, vector<float>(n * h, 1));
+        return make_shared<op::Divide>(
+            one, make_shared<op::Add>(one, make_shared<op::Exp>(make_shared<op::Negative>(arg))));
+    };
+
+    auto input_gate = sigmoid(gate(0));
+    auto forget_gate = sigmoid(gate(1));
+    auto candidate = make_shared<op::Tanh>(gate(2));
+    auto output_gate = sigmoid(gate(3));
+    auto cell = make_shared<op::Multiply>(forget_gate, c_prev) +
+                make_shared<op::Multiply>(input_gate, candidate);
+    auto hidden = make_shared<op::Multiply>(output_gate, make_shared<op::Tanh>(cell));
+    if (forget_output)
+    {
+        *forget_output = forget_gate;
+    }
+    return NodeVector{hidden, cell};
+}
+
+// One LSTM cell whose output is h_t + c_t
+static shared_ptr<Function>
+    make_lstm_cell(size_t batch_size, size_t hidden_size, bool cpu_sigmoid, bool export_forget)
+{
+    size_t n = batch_size;
+    size_t h = hidden_size;
+    auto gates = make_shared<op::Parameter>(element::f32, Shape{n, 4 * h});
+    auto c_prev = make_shared<op::Parameter>(element::f32, Shape{n, h});
+    shared_ptr<Node> forget_gate;
+    NodeVector cell = make_lstm_outputs(gates, c_prev, cpu_sigmoid, &forget_gate);
+
+    NodeVector outputs{cell.at(0) + cell.at(1)};
+    if (export_forget)
+    {
+        outputs.push_back(forget_gate);
+    }
+    return make_shared<Function>(outputs, op::ParameterVector{gates, c_prev});
+}
+
+// Two steps of an LSTM layer, each adding h_{t-1} W^T + b to its input gates as the MXNet
+// models do, whose output is h_2 + c_2
+static shared_ptr<Function> make_lstm_layer(size_t batch_size, size_t hidden_size, bool cpu_sigmoid)
+{
+    size_t n = batch_size;
+    size_t h = hidden_size;
+    auto x_gates_1 = make_shared<op::Parameter>(element::f32, Shape{n, 4 * h});
+    auto x_gates_2 = make_shared<op::Parameter>(element::f32, Shape{n, 4 * h});
+    auto h_0 = make_shared<op::Parameter>(element::f32, Shape{n, h});
+    auto c_0 = make_shared<op::Parameter>(element::f32, Shape{n, h});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{4 * h, h});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{4 * h});
+    auto recurrent = [&](shared_ptr<Node> h_prev) {
+        auto weights_t = make_shared<op::Reshape>(weights, AxisVector{1, 0}, Shape{h, 4 * h});
+        return make_shared<op::Dot>(h_prev, weights_t) +
+               make_shared<op::Broadcast>(bias, Shape{n, 4 * h}, AxisSet{0});
+    };
+
+    NodeVector step_1 = make_lstm_outputs(x_gates_1 + recurrent(h_0), c_0, cpu_sigmoid);
+    NodeVector step_2 =
+        make_lstm_outputs(recurrent(step_1.at(0)) + x_gates_2, step_1.at(1), cpu_sigmoid);
+    return make_shared<Function>(
+        NodeVector{step_2.at(0) + step_2.at(1)},
+        op::ParameterVector{x_gates_1, x_gates_2, h_0, c_0, weights, bias});
+}
+
+static size_t count_recurrent_lstms(const shared_ptr<Function>& func)
+{
+    size_t count = 0;
+    for (auto node : func->get_ordered_ops())
+    {
+        auto lstm = dynamic_pointer_cast<op::Lstm>(node);
+        if (lstm && lstm->has_recurrent_weights())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+TEST(cpu_fusion, fuse_lstm_cell)
+{
+    auto func = make_lstm_cell(2, 3, true, false);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::Lstm>(func), 1u);
+    ASSERT_EQ(count_ops_of_type<op::Sigmoid>(func), 0u);
+    ASSERT_EQ(count_ops_of_type<op::Tanh>(func), 0u);
+}
+
+TEST(cpu_fusion, lstm_cell_not_fused_gate_used_outside)
+{
+    auto func = make_lstm_cell(2, 3, true, true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::Lstm>(func), 0u);
+}
+
+TEST(cpu_fusion, lstm_cell_n2h3)
+{
+    size_t n = 2;
+    size_t h = 3;
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<float> gates_val(n * 4 * h);
+    vector<float> c_prev_val(n * h);
+    vector<float> delta_val(n * h);
+    rng.initialize(gates_val);
+    rng.initialize(c_prev_val);
+    rng.initialize(delta_val);
+
+    // Forward and backward through the fused cell on CPU against the plain graph on the
+    // INTERPRETER
+    auto run = [&](const string& backend_name, shared_ptr<Function> func) {
+        auto backend = runtime::Backend::create(backend_name);
+        auto gates = backend->create_tensor(element::f32, Shape{n, 4 * h});
+        auto c_prev = backend->create_tensor(element::f32, Shape{n, h});
+        auto delta = backend->create_tensor(element::f32, Shape{n, h});
+        copy_data(gates, gates_val);
+        copy_data(c_prev, c_prev_val);
+        copy_data(delta, delta_val);
+
+        auto result = backend->create_tensor(element::f32, Shape{n, h});
+        backend->call(func, {result}, {gates, c_prev});
+
+        auto d_gates = backend->create_tensor(element::f32, Shape{n, 4 * h});
+        auto d_c_prev = backend->create_tensor(element::f32, Shape{n, h});
+        backend->call(
+            autodiff::backprop_function(func), {d_gates, d_c_prev}, {gates, c_prev, delta});
+        return vector<vector<float>>{read_vector<float>(result),
+                                     read_vector<float>(d_gates),
+                                     read_vector<float>(d_c_prev)};
+    };
+
+    auto fused = make_lstm_cell(n, h, true, false);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(fused);
+    ASSERT_EQ(count_ops_of_type<op::Lstm>(fused), 1u);
+
+    auto expected = run("INTERPRETER", make_lstm_cell(n, h, false, false));
+    auto actual = run("CPU", fused);
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(expected[i], actual[i]));
+    }
+}
+
+TEST(cpu_fusion, lstm_layer_n2h3)
+{
+    size_t n = 2;
+    size_t h = 3;
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args_val{vector<float>(n * 4 * h),
+                                   vector<float>(n * 4 * h),
+                                   vector<float>(n * h),
+                                   vector<float>(n * h),
+                                   vector<float>(4 * h * h),
+                                   vector<float>(4 * h)};
+    for (auto& arg_val : args_val)
+    {
+        rng.initialize(arg_val);
+    }
+    vector<float> delta_val(n * h);
+    rng.initialize(delta_val);
+
+    // Forward and backward through the cells on CPU against the plain graph on the INTERPRETER
+    auto run = [&](const string& backend_name, shared_ptr<Function> func) {
+        auto backend = runtime::Backend::create(backend_name);
+        vector<shared_ptr<runtime::TensorView>> args;
+        for (auto parameter : func->get_parameters())
+        {
+            args.push_back(backend->create_tensor(element::f32, parameter->get_shape()));
+            copy_data(args.back(), args_val.at(args.size() - 1));
+        }
+        auto result = backend->create_tensor(element::f32, Shape{n, h});
+        backend->call(func, {result}, args);
+
+        auto delta = backend->create_tensor(element::f32, Shape{n, h});
+        copy_data(delta, delta_val);
+        vector<shared_ptr<runtime::TensorView>> d_args;
+        for (auto parameter : func->get_parameters())
+        {
+            d_args.push_back(backend->create_tensor(element::f32, parameter->get_shape()));
+        }
+        args.push_back(delta);
+        backend->call(autodiff::backprop_function(func), d_args, args);
+
+        vector<vector<float>> values{read_vector<float>(result)};
+        for (auto d_arg : d_args)
+        {
+            values.push_back(read_vector<float>(d_arg));
+        }
+        return values;
+    };
+
+    auto fused = make_lstm_layer(n, h, true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(fused);
+    // The first step's h_{t-1} W^T is not from a fused cell
+    ASSERT_EQ(count_ops_of_type<op::Lstm>(fused), 2u);
+    ASSERT_EQ(count_recurrent_lstms(fused), 1u);
+
+    auto expected = run("INTERPRETER", make_lstm_layer(n, h, false));
+    auto actual = run("CPU", fused);
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(expected[i], actual[i]));
+    }
+}
+
+TEST(cpu_fusion, lstm_fusion_from_json_model)
+{
+    for (string model : {"mxnet/10_bucket_LSTM.json", "mxnet/rnn-10-step-fusion-test.json"})
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        const string json_string = file_util::read_file_to_string(json_path);
+        stringstream ss(json_string);
+        shared_ptr<Function> func = ngraph::deserialize(ss);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        pass_manager.run_passes(func);
+
+        // Two layers of 10 steps, where every step after the first takes over its recurrent GEMM
+        EXPECT_EQ(count_ops_of_type<op::Lstm>(func), 20u);
+        EXPECT_EQ(count_recurrent_lstms(func), 18u);
+        EXPECT_EQ(count_ops_of_type<op::Sigmoid>(func), 0u);
+        EXPECT_EQ(count_ops_of_type<op::Tanh>(func), 0u);
+    }
+}
@@ -16,9 +16,12 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <set>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -32,6 +35,9 @@
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -274,3 +280,587 @@ TEST(cpu_test, backwards_reverse_sequence_n4d2c3h2w2)
     backend->call(df, {da, db}, {a, b, c});
     ASSERT_EQ(read_vector<int>(da), expected);
 }
+
+TEST(cpu_test, concat_in_place_leading_axis)
+{
+    Shape shape{2, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto mul = make_shared<op::Multiply>(A, B);
+    auto concat = make_shared<op::Concat>(NodeVector{add, mul}, 0);
+    auto f = make_shared<Function>(make_shared<op::Negative>(concat), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto external = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    auto cf = external->make_call_frame();
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> result = backend->create_tensor(element::f32, Shape{4, 16});
+
+    vector<float> input_a(shape_size(shape));
+    vector<float> input_b(shape_size(shape));
+    for (size_t i = 0; i < input_a.size(); i++)
+    {
+        input_a[i] = static_cast<float>(i);
+        input_b[i] = static_cast<float>(i % 3 + 1);
+    }
+    copy_data(a, input_a);
+    copy_data(b, input_b);
+
+    // All of A + B followed by all of A * B, both written in place into the Concat
+    vector<float> expected;
+    for (size_t i = 0; i < input_a.size(); i++)
+    {
+        expected.push_back(-(input_a[i] + input_b[i]));
+    }
+    for (size_t i = 0; i < input_a.size(); i++)
+    {
+        expected.push_back(-(input_a[i] * input_b[i]));
+    }
+
+    cf->call({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), expected);
+    EXPECT_EQ(external->get_concat_bytes_eliminated(), 2 * 2 * 16 * sizeof(float));
+}
+
+TEST(cpu_test, concat_copies_inner_axis)
+{
+    Shape shape{2, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto mul = make_shared<op::Multiply>(A, B);
+    auto concat = make_shared<op::Concat>(NodeVector{add, mul}, 1);
+    auto f = make_shared<Function>(make_shared<op::Negative>(concat), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto external = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    auto cf = external->make_call_frame();
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> result = backend->create_tensor(element::f32, Shape{2, 32});
+
+    vector<float> input_a(shape_size(shape));
+    vector<float> input_b(shape_size(shape));
+    for (size_t i = 0; i < input_a.size(); i++)
+    {
+        input_a[i] = static_cast<float>(i);
+        input_b[i] = static_cast<float>(i % 3 + 1);
+    }
+    copy_data(a, input_a);
+    copy_data(b, input_b);
+
+    // Rows of A + B and A * B interleaved, so the Concat still copies
+    vector<float> expected;
+    for (size_t row = 0; row < 2; row++)
+    {
+        for (size_t i = row * 16; i < (row + 1) * 16; i++)
+        {
+            expected.push_back(-(input_a[i] + input_b[i]));
+        }
+        for (size_t i = row * 16; i < (row + 1) * 16; i++)
+        {
+            expected.push_back(-(input_a[i] * input_b[i]));
+        }
+    }
+
+    cf->call({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), expected);
+    EXPECT_EQ(external->get_concat_bytes_eliminated(), 0u);
+}
+
+TEST(cpu_test, slice_and_reshape_in_place)
+{
+    Shape shape{4, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    // The last two rows of A + B, flattened
+    auto slice = make_shared<op::Slice>(add, Coordinate{2, 0}, Coordinate{4, 16});
+    auto reshape = make_shared<op::Reshape>(slice, AxisVector{0, 1}, Shape{32});
+    auto f = make_shared<Function>(make_shared<op::Negative>(reshape), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto external = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    auto cf = external->make_call_frame();
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> result = backend->create_tensor(element::f32, Shape{32});
+
+    vector<float> input_a(shape_size(shape));
+    vector<float> input_b(shape_size(shape));
+    vector<float> expected;
+    for (size_t i = 0; i < input_a.size(); i++)
+    {
+        input_a[i] = static_cast<float>(i);
+        input_b[i] = static_cast<float>(i % 5);
+        if (i >= 32)
+        {
+            expected.push_back(-(input_a[i] + input_b[i]));
+        }
+    }
+    copy_data(a, input_a);
+    copy_data(b, input_b);
+
+    cf->call({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), expected);
+    EXPECT_EQ(external->get_eliminated_copies(), 2u);
+}
+
+TEST(cpu_test, broadcast_folded_into_elementwise)
+{
+    Shape shape{3, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{});
+    auto bias = make_shared<op::Add>(A, make_shared<op::Broadcast>(B, shape, AxisSet{0}));
+    auto scale = make_shared<op::Multiply>(make_shared<op::Broadcast>(C, shape, AxisSet{0, 1}),
+                                           bias);
+    auto f = make_shared<Function>(scale, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto external = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    auto cf = external->make_call_frame();
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, Shape{4});
+    copy_data(b, vector<float>{10, 20, 30, 40});
+    shared_ptr<runtime::TensorView> c = backend->create_tensor(element::f32, Shape{});
+    copy_data(c, vector<float>{2});
+    shared_ptr<runtime::TensorView> result = backend->create_tensor(element::f32, shape);
+
+    cf->call({result}, {a, b, c});
+    EXPECT_EQ((vector<float>{22, 44, 66, 88, 30, 52, 74, 96, 38, 60, 82, 104}),
+              read_vector<float>(result));
+    EXPECT_EQ(external->get_eliminated_copies(), 2u);
+}
+
+TEST(cpu_test, broadcast_folded_into_elementwise_empty)
+{
+    Shape shape{3, 0};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{0});
+    auto bias = make_shared<op::Add>(A, make_shared<op::Broadcast>(B, shape, AxisSet{0}));
+    auto f = make_shared<Function>(bias, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto external = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    auto cf = external->make_call_frame();
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, Shape{0});
+    shared_ptr<runtime::TensorView> result = backend->create_tensor(element::f32, shape);
+
+    cf->call({result}, {a, b});
+    EXPECT_EQ(vector<float>{}, read_vector<float>(result));
+    EXPECT_EQ(external->get_eliminated_copies(), 1u);
+}
+
+// Sets an environment variable for the lifetime of the guard, then restores it
+class EnvironmentGuard
+{
+public:
+    EnvironmentGuard(const string& name, const string& value)
+        : m_name(name)
+    {
+        const char* old_value = getenv(name.c_str());
+        m_was_set = old_value != nullptr;
+        if (m_was_set)
+        {
+            m_old_value = old_value;
+        }
+        setenv(name.c_str(), value.c_str(), 1);
+    }
+
+    ~EnvironmentGuard()
+    {
+        if (m_was_set)
+        {
+            setenv(m_name.c_str(), m_old_value.c_str(), 1);
+        }
+        else
+        {
+            unsetenv(m_name.c_str());
+        }
+    }
+
+private:
+    string m_name;
+    string m_old_value;
+    bool m_was_set;
+};
+
+TEST(cpu_test, convolution_tuning_db)
+{
+    Shape shape_b{4, 3, 3, 3};
+    auto make_function = [&](const Shape& shape_a) {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto B = make_shared<op::Parameter>(element::f32, shape_b);
+        return make_shared<Function>(make_shared<op::Convolution>(A, B),
+                                     op::ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> input_b(shape_size(shape_b));
+    rng.initialize(input_b);
+    auto run = [&](const string& backend_name, const Shape& shape_a) {
+        auto f = make_function(shape_a);
+        vector<float> input_a(shape_size(shape_a));
+        rng.initialize(input_a);
+        auto backend = runtime::Backend::create(backend_name);
+        auto a = backend->create_tensor(element::f32, shape_a);
+        auto b = backend->create_tensor(element::f32, shape_b);
+        auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+        copy_data(a, input_a);
+        copy_data(b, input_b);
+        backend->call(f, {result}, {a, b});
+        auto fused = read_vector<float>(result);
+
+        auto reference = runtime::Backend::create("INTERPRETER");
+        auto ra = reference->create_tensor(element::f32, shape_a);
+        auto rb = reference->create_tensor(element::f32, shape_b);
+        auto expected = reference->create_tensor(element::f32, f->get_output_shape(0));
+        copy_data(ra, input_a);
+        copy_data(rb, input_b);
+        reference->call(make_function(shape_a), {expected}, {ra, rb});
+        return test::all_close(read_vector<float>(expected), fused);
+    };
+
+    string db_path = file_util::tmp_filename(".json");
+    {
+        EnvironmentGuard guard("NGRAPH_CPU_CONV_TUNING_DB", db_path);
+        EXPECT_TRUE(run("CPU", Shape{2, 3, 8, 8}));
+
+        // The signature was tuned once and recorded
+        auto db = nlohmann::json::parse(file_util::read_file_to_string(db_path));
+        ASSERT_EQ(db.size(), 1u);
+        string choice = db.begin().value().get<string>();
+        EXPECT_TRUE(choice == "direct" || choice == "winograd");
+
+        // An entry another process records meanwhile is kept when this one records another
+        db["recorded elsewhere"] = "direct";
+        ofstream(db_path) << db.dump();
+        EXPECT_TRUE(run("CPU", Shape{2, 3, 10, 10}));
+        db = nlohmann::json::parse(file_util::read_file_to_string(db_path));
+        EXPECT_EQ(db.size(), 3u);
+        EXPECT_EQ(db["recorded elsewhere"], "direct");
+    }
+
+    // Another database that already has the signatures is used without tuning again
+    string recorded_path = file_util::tmp_filename(".json");
+    auto db = nlohmann::json::parse(file_util::read_file_to_string(db_path));
+    for (auto it = db.begin(); it != db.end(); ++it)
+    {
+        it.value() = "direct";
+    }
+    ofstream(recorded_path) << db.dump();
+    {
+        EnvironmentGuard guard("NGRAPH_CPU_CONV_TUNING_DB", recorded_path);
+        EXPECT_TRUE(run("CPU", Shape{2, 3, 8, 8}));
+        EXPECT_EQ(nlohmann::json::parse(file_util::read_file_to_string(recorded_path)), db);
+    }
+
+    for (string path : {db_path, recorded_path})
+    {
+        file_util::remove_file(path);
+        if (file_util::exists(path + ".lock"))
+        {
+            file_util::remove_file(path + ".lock");
+        }
+    }
+}
+
+TEST(cpu_test, parallel_reductions_match_interpreter)
+{
+    auto compare = [](const element::Type& type,
+                      const Shape& shape,
+                      function<shared_ptr<Node>(const shared_ptr<Node>&)> make_op) {
+        auto A = make_shared<op::Parameter>(type, shape);
+        auto make_function = [&]() {
+            return make_shared<Function>(make_op(A), op::ParameterVector{A});
+        };
+        auto out_shape = make_function()->get_output_shape(0);
+
+        // Small values keep products of many elements finite and integers exact
+        vector<double> input(shape_size(shape));
+        test::Uniform<double> rng(0.5, 1.5);
+        rng.initialize(input);
+        auto run = [&](const string& backend_name) {
+            auto backend = runtime::Backend::create(backend_name);
+            auto a = backend->create_tensor(type, shape);
+            auto result = backend->create_tensor(type, out_shape);
+            if (type == element::f32)
+            {
+                copy_data(a, vector<float>(input.begin(), input.end()));
+            }
+            else
+            {
+                vector<int32_t> ints;
+                for (double x : input)
+                {
+                    ints.push_back(static_cast<int32_t>(x * 2));
+                }
+                copy_data(a, ints);
+            }
+            backend->call(make_function(), {result}, {a});
+            return result;
+        };
+
+        auto expected = run("INTERPRETER");
+        auto result = run("CPU");
+        if (type == element::f32)
+        {
+            auto expected_values = read_vector<float>(expected);
+            EXPECT_TRUE(test::all_close(expected_values, read_vector<float>(result), 1e-4f, 1e-4f));
+        }
+        else
+        {
+            EXPECT_EQ(read_vector<int32_t>(expected), read_vector<int32_t>(result));
+        }
+    };
+
+    vector<pair<Shape, AxisSet>> cases{{Shape{2, 3, 4, 5}, AxisSet{0, 2}},
+                                       {Shape{2, 3, 4, 5}, AxisSet{1, 3}},
+                                       {Shape{2, 3, 4, 5}, AxisSet{0, 1, 2, 3}},
+                                       {Shape{2, 1, 3, 1, 4, 2}, AxisSet{1, 2, 3, 5}},
+                                       {Shape{3000, 40}, AxisSet{0}},
+                                       {Shape{40, 3000}, AxisSet{1}},
+                                       {Shape{3, 0, 4}, AxisSet{1}}};
+    for (auto& c : cases)
+    {
+        AxisSet axes = c.second;
+        for (auto type : {element::f32, element::i32})
+        {
+            compare(type, c.first, [&](const shared_ptr<Node>& arg) {
+                return make_shared<op::Sum>(arg, axes);
+            });
+            compare(type, c.first, [&](const shared_ptr<Node>& arg) {
+                return make_shared<op::Max>(arg, axes);
+            });
+            compare(type, c.first, [&](const shared_ptr<Node>& arg) {
+                return make_shared<op::Min>(arg, axes);
+            });
+        }
+        if (shape_size(c.first) < 200)
+        {
+            compare(element::f32, c.first, [&](const shared_ptr<Node>& arg) {
+                return make_shared<op::Product>(arg, axes);
+            });
+        }
+    }
+
+    compare(element::f32, Shape{4, 5, 6}, [](const shared_ptr<Node>& arg) {
+        return make_shared<op::Softmax>(arg, AxisSet{1, 2});
+    });
+    compare(element::f32, Shape{4, 5, 6}, [](const shared_ptr<Node>& arg) {
+        return make_shared<op::Softmax>(arg, AxisSet{0});
+    });
+}
+
+template <typename T>
+static void compare_transpose(const element::Type& type,
+                              const Shape& shape,
+                              const AxisVector& input_order)
+{
+    Shape out_shape;
+    for (auto axis : input_order)
+    {
+        out_shape.push_back(shape[axis]);
+    }
+    auto A = make_shared<op::Parameter>(type, shape);
+    auto make_function = [&]() {
+        auto reshape = make_shared<op::Reshape>(A, input_order, out_shape);
+        return make_shared<Function>(reshape, op::ParameterVector{A});
+    };
+
+    vector<T> input(shape_size(shape));
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<T>(i);
+    }
+    auto run = [&](const string& backend_name) {
+        auto backend = runtime::Backend::create(backend_name);
+        auto a = backend->create_tensor(type, shape);
+        auto result = backend->create_tensor(type, out_shape);
+        copy_data(a, input);
+        backend->call(make_function(), {result}, {a});
+        return read_vector<T>(result);
+    };
+    EXPECT_EQ(run("INTERPRETER"), run("CPU")) << vector_to_string(shape) << " / "
+                                              << vector_to_string(input_order);
+}
+
+TEST(cpu_test, transpose_matches_interpreter)
+{
+    vector<pair<Shape, AxisVector>> cases{{Shape{37, 45}, AxisVector{1, 0}},
+                                          {Shape{2, 3, 4, 5}, AxisVector{0, 2, 3, 1}},
+                                          {Shape{2, 3, 4, 5}, AxisVector{3, 2, 1, 0}},
+                                          {Shape{2, 3, 4, 5}, AxisVector{1, 0, 2, 3}},
+                                          {Shape{2, 1, 3, 1, 4, 2}, AxisVector{5, 1, 4, 0, 3, 2}},
+                                          {Shape{3, 70, 2, 33}, AxisVector{2, 3, 0, 1}},
+                                          {Shape{3, 0, 4}, AxisVector{2, 0, 1}}};
+    for (auto& c : cases)
+    {
+        compare_transpose<int8_t>(element::i8, c.first, c.second);
+        compare_transpose<int16_t>(element::i16, c.first, c.second);
+        compare_transpose<float>(element::f32, c.first, c.second);
+        compare_transpose<int64_t>(element::i64, c.first, c.second);
+    }
+}
+
+TEST(cpu_test, identical_functions_keep_separate_state)
+{
+    // Tanh(Broadcast(Constant)) only depends on constants, so it runs on the first call of each
+    // call frame and its result stays in that frame's temporary pool. The functions share one
+    // compiled module, and each frame must still run it.
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto c = op::Constant::create(element::f32, Shape{3}, vector<float>{0.5f, 1, 2});
+        auto k = make_shared<op::Broadcast>(c, shape, AxisSet{0});
+        return make_shared<Function>(A * make_shared<op::Tanh>(k), op::ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    vector<shared_ptr<Function>> functions{make_function(), make_function()};
+    vector<shared_ptr<runtime::TensorView>> inputs;
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<vector<float>> expected;
+    for (size_t i = 0; i < functions.size(); i++)
+    {
+        float x = i + 1.0f;
+        inputs.push_back(backend->create_tensor(element::f32, Shape{2, 3}));
+        copy_data(inputs[i], vector<float>{x, x, x, -x, -x, -x});
+        results.push_back(backend->create_tensor(element::f32, Shape{2, 3}));
+        expected.push_back({x * tanhf(0.5f),
+                            x * tanhf(1),
+                            x * tanhf(2),
+                            -x * tanhf(0.5f),
+                            -x * tanhf(1),
+                            -x * tanhf(2)});
+    }
+
+    for (size_t call = 0; call < 2; call++)
+    {
+        for (size_t i = 0; i < functions.size(); i++)
+        {
+            backend->call(functions[i], {results[i]}, {inputs[i]});
+            EXPECT_TRUE(test::all_close(expected[i], read_vector<float>(results[i])));
+        }
+    }
+
+    for (size_t round = 0; round < 20; round++)
+    {
+        vector<future<bool>> calls;
+        for (size_t i = 0; i < functions.size(); i++)
+        {
+            calls.push_back(backend->async_call(functions[i], {results[i]}, {inputs[i]}));
+        }
+        for (size_t i = 0; i < functions.size(); i++)
+        {
+            calls[i].get();
+            EXPECT_TRUE(test::all_close(expected[i], read_vector<float>(results[i])));
+        }
+    }
+}
+
+TEST(cpu_test, trace_records_ops_on_demand)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Tanh>(A + B) * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{1, 2, 3, 4, 5, 6});
+
+    const string trace_file = file_util::tmp_filename(".json");
+    auto count_op_events = [&]() {
+        backend->write_trace(trace_file);
+        auto trace = nlohmann::json::parse(file_util::read_file_to_string(trace_file));
+        size_t count = 0;
+        for (auto& event : trace["traceEvents"])
+        {
+            if (event["ph"] == "X")
+            {
+                EXPECT_GE(event["dur"].get<double>(), 0);
+                count++;
+            }
+        }
+        return count;
+    };
+
+    backend->enable_tracing(true);
+    backend->call(f, {result}, {a, b});
+    // At least Add, Tanh and Multiply
+    size_t ops_per_call = count_op_events();
+    EXPECT_GE(ops_per_call, 3);
+    backend->call(f, {result}, {a, b});
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(count_op_events(), 2 * ops_per_call);
+
+    backend->enable_tracing(false);
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(count_op_events(), 0);
+    file_util::remove_file(trace_file);
+}
+
+TEST(cpu_test, trace_written_per_function)
+{
+    vector<runtime::cpu::OpAttributes> ops{runtime::cpu::OpAttributes("Add", {"out"}, {"a", "b"})};
+    size_t f = runtime::cpu::register_traced_function("f", ops);
+    size_t g = runtime::cpu::register_traced_function("g", ops);
+    size_t h = runtime::cpu::register_traced_function("h", ops);
+    EXPECT_NE(f, 0);
+    EXPECT_NE(f, g);
+
+    const string trace_file = file_util::tmp_filename(".json");
+    auto functions_in_trace = [&](const vector<size_t>& functions) {
+        if (functions.empty())
+        {
+            runtime::cpu::write_trace(trace_file);
+        }
+        for (size_t function : functions)
+        {
+            runtime::cpu::write_trace(trace_file, function);
+        }
+        auto trace = nlohmann::json::parse(file_util::read_file_to_string(trace_file));
+        multiset<string> names;
+        for (auto& event : trace["traceEvents"])
+        {
+            if (event["ph"] == "X")
+            {
+                names.insert(event["args"]["Function"].get<string>());
+            }
+        }
+        return names;
+    };
+
+    runtime::cpu::trace_op(f, 0, 10, 20);
+    runtime::cpu::trace_op(g, 0, 30, 40);
+    runtime::cpu::trace_op(g, 0, 50, 60);
+    runtime::cpu::trace_op(h, 0, 70, 80);
+    // Writing f leaves the events of g and h to be written later
+    EXPECT_EQ(functions_in_trace({f}), multiset<string>{"f"});
+    EXPECT_EQ(functions_in_trace({g}), (multiset<string>{"g", "g"}));
+    EXPECT_EQ(functions_in_trace({g}), multiset<string>{});
+
+    // Unregistering h drops its pending events, and later ones are ignored
+    runtime::cpu::unregister_traced_function(h);
+    runtime::cpu::trace_op(h, 0, 90, 100);
+    runtime::cpu::trace_op(f, 0, 110, 120);
+    EXPECT_EQ(functions_in_trace({}), multiset<string>{"f"});
+
+    runtime::cpu::unregister_traced_function(f);
+    runtime::cpu::unregister_traced_function(g);
+    file_util::remove_file(trace_file);
+}
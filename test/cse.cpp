@@ -51,6 +51,24 @@ TEST(CSE, abs_abs)
     ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
 }
 
+TEST(CSE, abs_abs_control_dependency)
+{
+    Shape zero_shape{0};
+    auto A = std::make_shared<op::Parameter>(element::i32, zero_shape);
+    auto B = std::make_shared<op::Parameter>(element::i32, zero_shape);
+    auto abs1 = std::make_shared<op::Abs>(A);
+    auto abs2 = std::make_shared<op::Abs>(A);
+    auto abs_b = std::make_shared<op::Abs>(B);
+    abs2->add_control_dependency(abs_b);
+    auto f = std::make_shared<Function>(NodeVector{abs1, abs2, abs_b}, op::ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), abs1);
+    ASSERT_EQ(f->get_results().at(1)->get_argument(0), abs2);
+}
+
 TEST(CSE, abs_abs_negative)
 {
     Shape zero_shape{0};
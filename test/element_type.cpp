@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <map>
 
 #include "gtest/gtest.h"
 
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/type/float16.hpp"
 
 using namespace ngraph;
 
@@ -26,6 +29,8 @@ TEST(element_type, from)
 {
     EXPECT_EQ(element::from<char>(), element::boolean);
     EXPECT_EQ(element::from<bool>(), element::boolean);
+    EXPECT_EQ(element::from<bfloat16>(), element::bf16);
+    EXPECT_EQ(element::from<float16>(), element::f16);
     EXPECT_EQ(element::from<float>(), element::f32);
     EXPECT_EQ(element::from<double>(), element::f64);
     EXPECT_EQ(element::from<int8_t>(), element::i8);
@@ -45,6 +50,58 @@ TEST(element_type, mapable)
     test_map.insert({element::f32, "float"});
 }
 
+TEST(element_type, sixteen_bit_real_types_are_distinct)
+{
+    EXPECT_EQ(2, element::bf16.size());
+    EXPECT_EQ(2, element::f16.size());
+    EXPECT_NE(element::bf16, element::f16);
+    EXPECT_TRUE(element::bf16 < element::f16 || element::f16 < element::bf16);
+
+    std::map<element::Type, std::string> test_map;
+    test_map.insert({element::bf16, "bfloat16"});
+    test_map.insert({element::f16, "float16"});
+    EXPECT_EQ(2, test_map.size());
+}
+
+TEST(element_type, float16_conversion)
+{
+    EXPECT_EQ(0x3c00, float16(1.0f).to_bits());
+    EXPECT_EQ(0xc000, float16(-2.0f).to_bits());
+    EXPECT_EQ(0x7bff, float16(65504.0f).to_bits());
+    EXPECT_EQ(0x7c00, float16(65520.0f).to_bits());
+    EXPECT_EQ(0x0001, float16(5.9604645e-8f).to_bits());
+    EXPECT_EQ(0x0000, float16(2.0e-8f).to_bits());
+    // 1 + 2^-11 is halfway between two f16 values and rounds to even
+    EXPECT_EQ(0x3c00, float16(1.00048828125f).to_bits());
+    EXPECT_EQ(0x3c02, float16(1.00146484375f).to_bits());
+    EXPECT_TRUE(std::isnan(static_cast<float>(float16(NAN))));
+
+    for (uint32_t bits = 0; bits < 0x7c00; bits++)
+    {
+        float16 value = float16::from_bits(static_cast<uint16_t>(bits));
+        EXPECT_EQ(bits, float16(static_cast<float>(value)).to_bits());
+    }
+    EXPECT_EQ(6.103515625e-05f, std::numeric_limits<float16>::min());
+    EXPECT_EQ(65504.0f, std::numeric_limits<float16>::max());
+}
+
+TEST(element_type, bfloat16_conversion)
+{
+    EXPECT_EQ(0x3f80, bfloat16(1.0f).to_bits());
+    EXPECT_EQ(0xc000, bfloat16(-2.0f).to_bits());
+    // 1 + 2^-8 is halfway between two bf16 values and rounds to even
+    EXPECT_EQ(0x3f80, bfloat16(1.00390625f).to_bits());
+    EXPECT_EQ(0x3f82, bfloat16(1.01171875f).to_bits());
+    EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(NAN))));
+    EXPECT_TRUE(std::isinf(static_cast<float>(bfloat16(INFINITY))));
+
+    bfloat16 sum = 0;
+    sum += 1.5f;
+    sum *= 2;
+    EXPECT_EQ(3.0f, sum);
+    EXPECT_EQ(0.0078125f, std::numeric_limits<bfloat16>::epsilon());
+}
+
 TEST(element_type, size)
 {
     {
@@ -26,8 +26,10 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/assign_placement.hpp"
+#include "ngraph/pass/cost_model_placement.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/host_tensor_view.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
 #include "ngraph/util.hpp"
 #include "util/ndarray.hpp"
 #include "util/test_tools.hpp"
@@ -50,157 +52,7 @@ static function<Placement(shared_ptr<Node>)> int_with_cpu_mul_policy = [](shared
     return placement;
 };
 
-// HybridCallFrame servers 2 purposes:
-// 1. HybridBackend's main use case is to test device placement and graph partition routines.
-// 2. It also shows how glued-hybrid runtime can be built by combining different runtimes.
-//
-// By default, HybridBackend operates on INTERPRETER (for example, the primary tensor view is
-// INTERPRETER tensor view). It falls back to CPU when requested by placement.
-class HybridBackend
-{
-public:
-    HybridBackend(const function<Placement(shared_ptr<Node>)>& placement_policy)
-        : m_placement_policy(placement_policy)
-    {
-    }
-
-    ~HybridBackend() {}
-    shared_ptr<runtime::TensorView> create_tensor(const element::Type& element_type,
-                                                  const Shape& shape)
-    {
-        return get_cached_backend(Placement::INTERPRETER)->create_tensor(element_type, shape);
-    }
-
-    bool compile(const shared_ptr<Function>& func)
-    {
-        if (!contains_key(m_function_map, func))
-        {
-            // Clone function
-            FunctionInstance instance;
-            instance.m_function = clone_function(*func);
-
-            // Run placement pass
-            pass::Manager pass_manager;
-            pass_manager.register_pass<pass::AssignPlacement>(int_with_cpu_mul_policy);
-            pass_manager.run_passes(instance.m_function);
-
-            // Split function to sub_functions
-            tie(instance.m_sub_functions, instance.m_map_parameter_to_result) =
-                split_function_by_placement(instance.m_function);
-            m_function_map.insert({func, instance});
-
-            // Compile subfunctions in corresponding backends
-            for (shared_ptr<Function>& sub_function : instance.m_sub_functions)
-            {
-                Placement placement = get_colocated_function_placement(sub_function);
-                auto backend = get_cached_backend(placement);
-                backend->compile(sub_function);
-            }
-        }
-        return true;
-    }
-
-    bool call(const shared_ptr<Function>& func,
-              const vector<shared_ptr<runtime::TensorView>>& outputs,
-              const vector<shared_ptr<runtime::TensorView>>& inputs)
-    {
-        // Get FunctionInstance
-        bool rc = true;
-        auto it = m_function_map.find(func);
-        if (it == m_function_map.end())
-        {
-            compile(func);
-            it = m_function_map.find(func);
-        }
-        if (it == m_function_map.end())
-        {
-            throw runtime_error("Error constructing backend.");
-        }
-        FunctionInstance& instance = it->second;
-
-        // Parameter and result node in sub_function maps to one TensorView
-        unordered_map<shared_ptr<Node>, shared_ptr<runtime::TensorView>> map_node_to_tensor_view;
-        for (size_t i = 0; i < inputs.size(); ++i)
-        {
-            map_node_to_tensor_view[instance.m_function->get_parameters()[i]] = inputs[i];
-        }
-        for (size_t i = 0; i < outputs.size(); ++i)
-        {
-            map_node_to_tensor_view[instance.m_function->get_results()[i]] = outputs[i];
-        }
-
-        // Call subfunctions
-        for (shared_ptr<Function>& sub_function : instance.m_sub_functions)
-        {
-            // Init backend
-            Placement placement = get_colocated_function_placement(sub_function);
-            auto backend = get_cached_backend(placement);
-
-            // Prepare parameter TensorViews
-            vector<shared_ptr<runtime::TensorView>> parameter_tvs;
-            for (auto parameter_node : sub_function->get_parameters())
-            {
-                if (map_node_to_tensor_view.find(parameter_node) != map_node_to_tensor_view.end())
-                {
-                    parameter_tvs.push_back(map_node_to_tensor_view.at(parameter_node));
-                }
-                else
-                {
-                    auto result_node = instance.m_map_parameter_to_result.at(parameter_node);
-                    auto result_tv = map_node_to_tensor_view.at(result_node);
-                    auto parameter_tv = backend->create_tensor(parameter_node->get_element_type(),
-                                                               parameter_node->get_shape());
-                    copy_data(parameter_tv, read_vector<float>(result_tv));
-                    map_node_to_tensor_view[parameter_node] = parameter_tv;
-                    parameter_tvs.push_back(parameter_tv);
-                }
-            }
-
-            // Prepare result TensorViews
-            vector<shared_ptr<runtime::TensorView>> result_tvs;
-            for (auto result_node : sub_function->get_results())
-            {
-                if (map_node_to_tensor_view.find(result_node) != map_node_to_tensor_view.end())
-                {
-                    result_tvs.push_back(map_node_to_tensor_view.at(result_node));
-                }
-                else
-                {
-                    auto result_tv = backend->create_tensor(result_node->get_element_type(),
-                                                            result_node->get_shape());
-                    map_node_to_tensor_view[result_node] = result_tv;
-                    result_tvs.push_back(result_tv);
-                }
-            }
-
-            // Call
-            backend->call(sub_function, result_tvs, parameter_tvs);
-        }
-        return rc;
-    }
-
-protected:
-    class FunctionInstance
-    {
-    public:
-        shared_ptr<Function> m_function;
-        vector<shared_ptr<Function>> m_sub_functions;
-        unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> m_map_parameter_to_result;
-    };
-
-    shared_ptr<runtime::Backend> get_cached_backend(Placement placement)
-    {
-        if (m_cached_backends.find(placement) == m_cached_backends.end())
-        {
-            m_cached_backends[placement] = runtime::Backend::create(placement_to_string(placement));
-        }
-        return m_cached_backends.at(placement);
-    }
-
-    map<Placement, shared_ptr<runtime::Backend>> m_cached_backends;
-    map<shared_ptr<Function>, FunctionInstance> m_function_map;
-    function<Placement(shared_ptr<Node>)> m_placement_policy;
-};
+using runtime::hybrid::HybridBackend;
 
 TEST(graph_partition, placement_all_cpu_policy)
 {
@@ -526,3 +378,151 @@ TEST(graph_partition, hybrid_no_split)
     backend->call(f, {c}, {a, b});
     EXPECT_EQ(read_vector<float>(c), (test::NDArray<float, 2>({{6, 8}, {10, 12}})).get_vector());
 }
+
+TEST(graph_partition, hybrid_shared_boundary)
+{
+    //   A   B
+    //    \ /
+    // C  E*   D
+    //  \ / \ /
+    //  F+  G+
+    //    \ /
+    //    H+
+    //
+    // E crosses into the INTERPRETER cluster once, however many of its ops read it. CPU is
+    // served by a second INTERPRETER backend, so the split runs without the CPU backend.
+    Shape shape = Shape{2, 2};
+    shared_ptr<op::Parameter> A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<op::Parameter> B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<op::Parameter> C = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<op::Parameter> D = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> E = A * B;
+    shared_ptr<Node> F = C + E;
+    shared_ptr<Node> G = E + D;
+    shared_ptr<Node> H = F + G;
+    shared_ptr<Function> f = make_shared<Function>(H, op::ParameterVector{A, B, C, D});
+
+    auto backend = make_shared<HybridBackend>(
+        int_with_cpu_mul_policy,
+        HybridBackend::BackendMap{{Placement::CPU, runtime::Backend::create("INTERPRETER")}});
+
+    auto sub_functions = backend->get_sub_functions(f);
+    ASSERT_EQ(sub_functions.size(), 3);
+    EXPECT_EQ(get_colocated_function_placement(sub_functions[1]), Placement::CPU);
+    EXPECT_EQ(sub_functions[1]->get_results().size(), 1);
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> d = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> r = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, test::NDArray<float, 2>({{1, 2}, {3, 4}}).get_vector());
+    copy_data(b, test::NDArray<float, 2>({{5, 6}, {7, 8}}).get_vector());
+    copy_data(c, test::NDArray<float, 2>({{9, 10}, {11, 12}}).get_vector());
+    copy_data(d, test::NDArray<float, 2>({{13, 14}, {15, 16}}).get_vector());
+
+    backend->call(f, {r}, {a, b, c, d});
+    EXPECT_EQ(read_vector<float>(r), (test::NDArray<float, 2>({{32, 48}, {68, 92}})).get_vector());
+
+    // Calls reuse the compiled sub-functions and their boundary buffers
+    copy_data(a, test::NDArray<float, 2>({{2, 4}, {6, 8}}).get_vector());
+    backend->call(f, {r}, {a, b, c, d});
+    EXPECT_EQ(read_vector<float>(r),
+              (test::NDArray<float, 2>({{42, 72}, {110, 156}})).get_vector());
+}
+
+TEST(graph_partition, cost_model_placement)
+{
+    Shape shape = Shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto D = make_shared<op::Dot>(A, B);
+    auto E = make_shared<op::Tanh>(D + C);
+    auto f = make_shared<Function>(E, op::ParameterVector{A, B, C});
+
+    // The fast device runs everything but Tanh; the slow one everything
+    pass::DeviceModel fast{Placement::CPU, 100, 20, 1, [](const Node& node) {
+                               return node.description() != "Tanh";
+                           }};
+    pass::DeviceModel slow{Placement::INTERPRETER, 0.5, 2, 5, nullptr};
+
+    pass::CostModelPlacement placement({fast, slow});
+    placement.run_on_function(f);
+
+    for (auto node : f->get_ordered_ops())
+    {
+        if (node->description() == "Dot" || node->description() == "Add")
+        {
+            EXPECT_EQ(node->get_placement(), Placement::CPU);
+        }
+        else if (node->description() == "Tanh")
+        {
+            EXPECT_EQ(node->get_placement(), Placement::INTERPRETER);
+        }
+    }
+    EXPECT_GT(placement.get_estimated_time_us(), 0);
+
+    // A crossing dearer than the whole graph keeps everything on the slow device
+    pass::TransferModel transfer;
+    transfer.boundary_us = 1e9;
+    pass::CostModelPlacement expensive_placement({fast, slow}, transfer);
+    expensive_placement.run_on_function(f);
+    for (auto node : f->get_ordered_ops())
+    {
+        EXPECT_EQ(node->get_placement(), Placement::INTERPRETER);
+    }
+}
+
+TEST(graph_partition, hybrid_cost_model)
+{
+    Shape shape = Shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    // Only INTERPRETER can run Multiply, so the function splits
+    vector<pass::DeviceModel> devices = pass::CostModelPlacement::get_host_devices();
+    for (pass::DeviceModel& device : devices)
+    {
+        if (device.placement == Placement::CPU)
+        {
+            device.supports = [](const Node& node) { return node.description() != "Multiply"; };
+        }
+    }
+    pass::TransferModel transfer;
+    transfer.boundary_us = 1;
+    auto backend = make_shared<HybridBackend>(
+        devices,
+        transfer,
+        HybridBackend::BackendMap{{Placement::CPU, runtime::Backend::create("INTERPRETER")}});
+
+    shared_ptr<runtime::TensorView> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::TensorView> r = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, test::NDArray<float, 2>({{1, 2}, {3, 4}}).get_vector());
+    copy_data(b, test::NDArray<float, 2>({{5, 6}, {7, 8}}).get_vector());
+    copy_data(c, test::NDArray<float, 2>({{9, 10}, {11, 12}}).get_vector());
+
+    backend->call(f, {r}, {a, b, c});
+    EXPECT_EQ(read_vector<float>(r),
+              (test::NDArray<float, 2>({{54, 80}, {110, 144}})).get_vector());
+    for (auto sub_function : backend->get_sub_functions(f))
+    {
+        for (auto node : sub_function->get_ops())
+        {
+            if (node->description() == "Add")
+            {
+                EXPECT_EQ(node->get_placement(), Placement::CPU);
+            }
+            else if (node->description() == "Multiply")
+            {
+                EXPECT_EQ(node->get_placement(), Placement::INTERPRETER);
+            }
+        }
+    }
+}
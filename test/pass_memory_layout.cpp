@@ -236,3 +236,40 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, checkpointed_backprop)
+{
+    Shape shape{1024};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto W = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> Y = X;
+    for (size_t i = 0; i < 16; i++)
+    {
+        Y = make_shared<op::Tanh>(make_shared<op::Multiply>(Y, W));
+    }
+
+    auto backprop_pool_size = [&](const autodiff::CheckpointPolicy& policy) {
+        autodiff::Adjoints adjoints(NodeVector{Y}, NodeVector{C}, policy);
+        auto f = make_shared<Function>(
+            NodeVector{adjoints.backprop_node(X), adjoints.backprop_node(W)},
+            op::ParameterVector{X, W, C});
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>();
+        pass_manager.run_passes(f);
+        return make_pair(f->get_temporary_pool_size(), adjoints.get_recomputed_node_count());
+    };
+
+    auto plain = backprop_pool_size(autodiff::CheckpointPolicy());
+    auto sqrt_n = backprop_pool_size(
+        autodiff::CheckpointPolicy(autodiff::CheckpointPolicy::Strategy::SQRT_N));
+    auto budget = backprop_pool_size(autodiff::CheckpointPolicy(
+        autodiff::CheckpointPolicy::Strategy::MEMORY_BUDGET, 4 * shape_size(shape) * 4));
+
+    EXPECT_EQ(plain.second, 0);
+    EXPECT_GT(sqrt_n.second, 0);
+    EXPECT_GT(budget.second, 0);
+    EXPECT_LT(sqrt_n.first, plain.first);
+    EXPECT_LT(budget.first, plain.first);
+}
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reduce_lowering.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+template <typename OP>
+static shared_ptr<Function> make_reduction_function(bool swap_args = false)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{});
+    auto op = swap_args ? make_shared<OP>(y, x) : make_shared<OP>(x, y);
+    return make_shared<Function>(op, op::ParameterVector{x, y});
+}
+
+// Runs the pass on a clone of f and checks on the interpreter that the lowered clone still
+// computes what the generic reduction does.
+static shared_ptr<Function> lower_and_compare(const shared_ptr<Function>& f)
+{
+    auto lowered = clone_function(*f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReduceLowering>();
+    pass_manager.run_passes(lowered);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto param : f->get_parameters())
+    {
+        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+        rng.initialize(tensor);
+        args.push_back(tensor);
+    }
+    auto expected = backend->create_tensor(element::f32, f->get_output_shape(0));
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    backend->call(f, {expected}, args);
+    backend->call(lowered, {result}, args);
+    EXPECT_TRUE(test::all_close(read_vector<float>(expected), read_vector<float>(result)));
+
+    return lowered;
+}
+
+TEST(reduce_lowering, reduce_add_identity_init)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 5, 6});
+    auto init = op::Constant::create(element::f32, Shape{}, {0});
+    auto f = make_shared<Function>(
+        make_shared<op::Reduce>(A, init, make_reduction_function<op::Add>(), AxisSet{0, 2}),
+        op::ParameterVector{A});
+
+    auto lowered = lower_and_compare(f);
+    ASSERT_EQ(count_ops_of_type<op::Reduce>(lowered), 0);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Add>(lowered), 0);
+}
+
+TEST(reduce_lowering, reduce_folds_init)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 5});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{});
+
+    auto f_max = make_shared<Function>(
+        make_shared<op::Reduce>(A, B, make_reduction_function<op::Maximum>(), AxisSet{1}),
+        op::ParameterVector{A, B});
+    auto lowered = lower_and_compare(f_max);
+    ASSERT_EQ(count_ops_of_type<op::Max>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Maximum>(lowered), 1);
+
+    auto f_min = make_shared<Function>(
+        make_shared<op::Reduce>(A, B, make_reduction_function<op::Minimum>(true), AxisSet{0}),
+        op::ParameterVector{A, B});
+    lowered = lower_and_compare(f_min);
+    ASSERT_EQ(count_ops_of_type<op::Min>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Minimum>(lowered), 1);
+
+    auto f_product = make_shared<Function>(
+        make_shared<op::Reduce>(A, B, make_reduction_function<op::Multiply>(), AxisSet{0, 1}),
+        op::ParameterVector{A, B});
+    lowered = lower_and_compare(f_product);
+    ASSERT_EQ(count_ops_of_type<op::Product>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(lowered), 1);
+}
+
+TEST(reduce_lowering, reduce_unknown_function)
+{
+    // f(x,y) = x + x*y is not a plain binary op of the parameters.
+    auto x = make_shared<op::Parameter>(element::f32, Shape{});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{});
+    auto rf = make_shared<Function>(make_shared<op::Add>(x, make_shared<op::Multiply>(x, y)),
+                                    op::ParameterVector{x, y});
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 5});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::Reduce>(A, B, rf, AxisSet{1}),
+                                   op::ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReduceLowering>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Reduce>(f), 1);
+}
+
+TEST(reduce_lowering, reduce_window_max)
+{
+    // A window over every axis goes through a reshape to a single-item, single-channel batch.
+    auto A = make_shared<op::Parameter>(element::f32, Shape{7, 9});
+    auto init = op::Constant::create(element::f32, Shape{}, {-INFINITY});
+    auto f = make_shared<Function>(
+        make_shared<op::ReduceWindow>(
+            A, init, make_reduction_function<op::Maximum>(), Shape{2, 3}, Strides{2, 1}),
+        op::ParameterVector{A});
+
+    auto lowered = lower_and_compare(f);
+    ASSERT_EQ(count_ops_of_type<op::ReduceWindow>(lowered), 0);
+    ASSERT_EQ(count_ops_of_type<op::MaxPool>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(lowered), 2);
+    ASSERT_EQ(count_ops_of_type<op::Maximum>(lowered), 0);
+}
+
+TEST(reduce_lowering, reduce_window_pooling_layout)
+{
+    // A window that leaves the first two axes alone maps straight onto the pooling ops.
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{});
+    Shape window{1, 1, 3, 2};
+    Strides strides{1, 1, 2, 2};
+
+    auto f_max = make_shared<Function>(
+        make_shared<op::ReduceWindow>(
+            A, B, make_reduction_function<op::Maximum>(), window, strides),
+        op::ParameterVector{A, B});
+    auto lowered = lower_and_compare(f_max);
+    ASSERT_EQ(count_ops_of_type<op::MaxPool>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(lowered), 0);
+    ASSERT_EQ(count_ops_of_type<op::Maximum>(lowered), 1);
+
+    auto f_min = make_shared<Function>(
+        make_shared<op::ReduceWindow>(
+            A, B, make_reduction_function<op::Minimum>(), window, strides),
+        op::ParameterVector{A, B});
+    lowered = lower_and_compare(f_min);
+    ASSERT_EQ(count_ops_of_type<op::MaxPool>(lowered), 1);
+    ASSERT_EQ(count_ops_of_type<op::Negative>(lowered), 2);
+
+    auto f_sum = make_shared<Function>(
+        make_shared<op::ReduceWindow>(A, B, make_reduction_function<op::Add>(), window, strides),
+        op::ParameterVector{A, B});
+    lowered = lower_and_compare(f_sum);
+    ASSERT_EQ(count_ops_of_type<op::ReduceWindow>(lowered), 1);
+
+    // There is no sum or product pooling kernel, so those stay generic.
+    auto f_product = make_shared<Function>(
+        make_shared<op::ReduceWindow>(
+            A, B, make_reduction_function<op::Multiply>(), window, strides),
+        op::ParameterVector{A, B});
+    lowered = lower_and_compare(f_product);
+    ASSERT_EQ(count_ops_of_type<op::ReduceWindow>(lowered), 1);
+}
@@ -0,0 +1,242 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/util.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<float> random_vector(const Shape& shape, float seed)
+{
+    vector<float> v(shape_size(shape));
+    test::Uniform<float>(-1.0f, 1.0f, seed).initialize(v);
+    return v;
+}
+
+static void check_dot(const Shape& arg0_shape, const Shape& arg1_shape, size_t reduction_axes)
+{
+    Shape out_shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes);
+    out_shape.insert(out_shape.end(), arg1_shape.begin() + reduction_axes, arg1_shape.end());
+
+    vector<float> a = random_vector(arg0_shape, 1);
+    vector<float> b = random_vector(arg1_shape, 2);
+    vector<float> expected(shape_size(out_shape));
+    vector<float> result(shape_size(out_shape), 42.0f);
+
+    runtime::reference::dot_generic(
+        a.data(), b.data(), expected.data(), arg0_shape, arg1_shape, out_shape, reduction_axes);
+    runtime::reference::dot(
+        a.data(), b.data(), result.data(), arg0_shape, arg1_shape, out_shape, reduction_axes);
+    EXPECT_TRUE(test::all_close(expected, result)) << vector_to_string(arg0_shape) << " . "
+                                                 << vector_to_string(arg1_shape);
+}
+
+TEST(reference, dot_matches_generic)
+{
+    check_dot(Shape{37, 70}, Shape{70, 300}, 1);
+    check_dot(Shape{200, 130}, Shape{130}, 1);
+    check_dot(Shape{130}, Shape{130, 3}, 1);
+    check_dot(Shape{3, 4, 5}, Shape{4, 5, 6}, 2);
+    check_dot(Shape{2, 3}, Shape{4, 5}, 0);
+    check_dot(Shape{}, Shape{5, 6}, 0);
+    check_dot(Shape{5, 0}, Shape{0, 3}, 1);
+}
+
+static void check_convolution(const Shape& data_spatial,
+                              const Shape& filter_spatial,
+                              const Strides& movement,
+                              const Strides& dilation,
+                              const CoordinateDiff& below,
+                              const CoordinateDiff& above,
+                              const Strides& data_dilation,
+                              bool backprop_layout)
+{
+    size_t batch = 2;
+    size_t c_in = 3;
+    size_t c_out = 4;
+
+    Shape out_spatial;
+    for (size_t i = 0; i < data_spatial.size(); i++)
+    {
+        ptrdiff_t padded =
+            below[i] + ptrdiff_t((data_spatial[i] - 1) * data_dilation[i] + 1) + above[i];
+        ptrdiff_t window = (filter_spatial[i] - 1) * dilation[i] + 1;
+        out_spatial.push_back((padded - window) / movement[i] + 1);
+    }
+
+    // The backprop layout has the batch and channel axes swapped, as the interpreter uses for
+    // ConvolutionBackpropFilters, and reverses the filters as for ConvolutionBackpropData.
+    Shape data_shape = backprop_layout ? Shape{c_in, batch} : Shape{batch, c_in};
+    Shape filter_shape = backprop_layout ? Shape{c_in, c_out} : Shape{c_out, c_in};
+    Shape out_shape = backprop_layout ? Shape{c_out, batch} : Shape{batch, c_out};
+    data_shape.insert(data_shape.end(), data_spatial.begin(), data_spatial.end());
+    filter_shape.insert(filter_shape.end(), filter_spatial.begin(), filter_spatial.end());
+    out_shape.insert(out_shape.end(), out_spatial.begin(), out_spatial.end());
+
+    size_t a = backprop_layout ? 1 : 0;
+    size_t b = backprop_layout ? 0 : 1;
+
+    vector<float> data = random_vector(data_shape, 3);
+    vector<float> filters = random_vector(filter_shape, 4);
+    vector<float> expected(shape_size(out_shape));
+    vector<float> result(shape_size(out_shape), 42.0f);
+
+    runtime::reference::convolution_generic(data.data(),
+                                            filters.data(),
+                                            expected.data(),
+                                            data_shape,
+                                            filter_shape,
+                                            out_shape,
+                                            movement,
+                                            dilation,
+                                            below,
+                                            above,
+                                            data_dilation,
+                                            a,
+                                            b,
+                                            b,
+                                            a,
+                                            a,
+                                            b,
+                                            backprop_layout);
+    runtime::reference::convolution(data.data(),
+                                    filters.data(),
+                                    result.data(),
+                                    data_shape,
+                                    filter_shape,
+                                    out_shape,
+                                    movement,
+                                    dilation,
+                                    below,
+                                    above,
+                                    data_dilation,
+                                    a,
+                                    b,
+                                    b,
+                                    a,
+                                    a,
+                                    b,
+                                    backprop_layout);
+    EXPECT_TRUE(test::all_close(expected, result)) << vector_to_string(data_shape) << " * "
+                                                 << vector_to_string(filter_shape);
+}
+
+TEST(reference, convolution_matches_generic)
+{
+    for (bool backprop_layout : {false, true})
+    {
+        check_convolution(
+            Shape{17}, Shape{3}, Strides{1}, Strides{1}, {0}, {0}, Strides{1}, backprop_layout);
+        check_convolution(Shape{9, 11},
+                          Shape{3, 2},
+                          Strides{2, 1},
+                          Strides{1, 2},
+                          {1, 2},
+                          {2, 0},
+                          Strides{1, 1},
+                          backprop_layout);
+        check_convolution(Shape{8, 7},
+                          Shape{2, 3},
+                          Strides{1, 2},
+                          Strides{2, 1},
+                          {-1, 1},
+                          {2, -2},
+                          Strides{2, 3},
+                          backprop_layout);
+        check_convolution(Shape{5, 6, 4},
+                          Shape{2, 3, 2},
+                          Strides{1, 2, 1},
+                          Strides{1, 1, 2},
+                          {1, 0, 1},
+                          {0, 1, 1},
+                          Strides{1, 2, 1},
+                          backprop_layout);
+    }
+}
+
+TEST(reference, pooling_matches_generic)
+{
+    Shape arg_shape{2, 3, 10, 9};
+    Shape window_shape{3, 2};
+    Strides movement{2, 1};
+    Shape below{1, 0};
+    Shape above{2, 1};
+    Shape out_shape{2, 3, 6, 9};
+
+    vector<float> arg = random_vector(arg_shape, 5);
+    vector<float> expected(shape_size(out_shape));
+    vector<float> result(shape_size(out_shape), 42.0f);
+
+    runtime::reference::max_pool_generic(arg.data(),
+                                         expected.data(),
+                                         arg_shape,
+                                         out_shape,
+                                         window_shape,
+                                         movement,
+                                         below,
+                                         above);
+    runtime::reference::max_pool(
+        arg.data(), result.data(), arg_shape, out_shape, window_shape, movement, below, above);
+    EXPECT_TRUE(test::all_close(expected, result));
+
+    for (bool include_padding : {false, true})
+    {
+        runtime::reference::avg_pool_generic(arg.data(),
+                                             expected.data(),
+                                             arg_shape,
+                                             out_shape,
+                                             window_shape,
+                                             movement,
+                                             below,
+                                             above,
+                                             include_padding);
+        runtime::reference::avg_pool(arg.data(),
+                                     result.data(),
+                                     arg_shape,
+                                     out_shape,
+                                     window_shape,
+                                     movement,
+                                     below,
+                                     above,
+                                     include_padding);
+        EXPECT_TRUE(test::all_close(expected, result));
+    }
+}
+
+TEST(reference, softmax_matches_generic)
+{
+    Shape shape{4, 5, 6, 7};
+    vector<float> arg = random_vector(shape, 6);
+    for (const AxisSet& axes : vector<AxisSet>{{3}, {2, 3}, {1}, {0}, {0, 1, 2, 3}, {0, 2}})
+    {
+        vector<float> expected(shape_size(shape));
+        vector<float> result(shape_size(shape), 42.0f);
+        runtime::reference::softmax_generic(arg.data(), expected.data(), shape, axes);
+        runtime::reference::softmax(arg.data(), result.data(), shape, axes);
+        EXPECT_TRUE(test::all_close(expected, result)) << vector_to_string(axes);
+    }
+}
@@ -155,6 +155,37 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_float16)
+{
+    const string tmp_file = "serialize_constant_float16.cpio";
+    Shape shape{2, 2};
+    auto A = op::Constant::create(element::f16, shape, {1.5, -2.0, 0.25, 65504.0});
+    auto B = make_shared<op::Parameter>(element::bf16, shape);
+    auto C = make_shared<op::Convert>(A, element::bf16);
+    auto f = make_shared<Function>(C + B, op::ParameterVector{B});
+
+    serialize(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    file_util::remove_file(tmp_file);
+    EXPECT_EQ(element::bf16, g->get_parameters().at(0)->get_element_type());
+    EXPECT_EQ(element::bf16, g->get_output_element_type(0));
+    bool found = false;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        shared_ptr<op::Constant> c = dynamic_pointer_cast<op::Constant>(node);
+        if (c)
+        {
+            found = true;
+            EXPECT_EQ(element::f16, c->get_element_type());
+            vector<float16> values = c->get_vector<float16>();
+            EXPECT_EQ((vector<float>{1.5, -2, 0.25, 65504}),
+                      (vector<float>{values.begin(), values.end()}));
+            break;
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -170,3 +201,26 @@ TEST(benchmark, serialize)
     timer.stop();
     cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
 }
+
+static shared_ptr<Function> make_scaled_sum(float scale, size_t axis)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto k = op::Constant::create(element::f32, Shape{2, 3}, vector<float>(6, scale));
+    auto sum = make_shared<op::Sum>(A * k, AxisSet{axis});
+    return make_shared<Function>(sum, op::ParameterVector{A});
+}
+
+TEST(serialize, structural_signature)
+{
+    string signature = get_structural_signature(make_scaled_sum(2, 0));
+    EXPECT_FALSE(signature.empty());
+    EXPECT_EQ(signature, get_structural_signature(make_scaled_sum(2, 0)));
+    EXPECT_NE(signature, get_structural_signature(make_scaled_sum(3, 0)));
+    EXPECT_NE(signature, get_structural_signature(make_scaled_sum(2, 1)));
+
+    const string file_name("mxnet/mnist_mlp_forward.json");
+    const string json_path = file_util::path_join(SERIALIZED_ZOO, file_name);
+    const string json_string = file_util::read_file_to_string(json_path);
+    EXPECT_EQ(get_structural_signature(deserialize(json_string)),
+              get_structural_signature(deserialize(json_string)));
+}
@@ -576,6 +576,56 @@ TEST(type_prop, add_bad_arguments)
                 });
 }
 
+TEST(type_prop, add_n_deduce)
+{
+    auto param0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto param1 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto sum = make_shared<op::AddN>(NodeVector{param0, param1, param0});
+    ASSERT_EQ(sum->get_element_type(), element::f32);
+    ASSERT_EQ(sum->get_shape(), (Shape{2, 3}));
+}
+
+TEST(type_prop, add_n_deduce_wrong_shape)
+{
+    auto param0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto param1 = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    try
+    {
+        auto sum = make_shared<op::AddN>(NodeVector{param0, param1});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Mismatched shapes not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(), std::string("Arguments must have the same tensor view shape"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, add_n_deduce_wrong_element_type)
+{
+    auto param0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto param1 = make_shared<op::Parameter>(element::i32, Shape{2, 3});
+    try
+    {
+        auto sum = make_shared<op::AddN>(NodeVector{param0, param1});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Mismatched element types not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(),
+                  std::string("Arguments must have the same tensor view element type"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, divide_bad_arguments)
 {
     test_binary("Divide",
@@ -2012,6 +2062,116 @@ TEST(type_prop, one_hot_deduce_shape_incompatible)
     }
 }
 
+TEST(type_prop, embedding_lookup_deduce)
+{
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{4, 5});
+    auto table = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    auto lookup = make_shared<op::EmbeddingLookup>(indices, table);
+    ASSERT_EQ(lookup->get_element_type(), element::f32);
+    ASSERT_EQ(lookup->get_shape(), (Shape{4, 5, 16}));
+
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{4, 5, 16});
+    auto backprop = make_shared<op::EmbeddingLookupBackprop>(indices, delta, Shape{100, 16});
+    ASSERT_EQ(backprop->get_element_type(), element::f32);
+    ASSERT_EQ(backprop->get_shape(), (Shape{100, 16}));
+}
+
+TEST(type_prop, embedding_lookup_deduce_boolean_indices)
+{
+    auto indices = make_shared<op::Parameter>(element::boolean, Shape{4});
+    auto table = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    try
+    {
+        auto lookup = make_shared<op::EmbeddingLookup>(indices, table);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Boolean embedding lookup indices not detected.";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(), std::string("Embedding lookup indices must not be boolean"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, embedding_lookup_backprop_deduce_delta_shape_incompatible)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{4, 15});
+    try
+    {
+        auto backprop = make_shared<op::EmbeddingLookupBackprop>(indices, delta, Shape{100, 16});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Incompatible embedding lookup delta shape not detected.";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(
+            error.what(),
+            std::string("Embedding lookup delta shape does not match indices and table shapes"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, softmax_cross_entropy_deduce)
+{
+    auto logits = make_shared<op::Parameter>(element::f32, Shape{4, 5, 6});
+    auto labels = make_shared<op::Parameter>(element::f32, Shape{4, 5, 6});
+    auto loss = make_shared<op::SoftmaxCrossEntropy>(logits, labels, AxisSet{2});
+    EXPECT_EQ(loss->get_element_type(), element::f32);
+    EXPECT_EQ(loss->get_shape(), (Shape{4, 5}));
+
+    auto loss_all = make_shared<op::SoftmaxCrossEntropy>(logits, labels, AxisSet{});
+    EXPECT_EQ(loss_all->get_shape(), (Shape{}));
+    EXPECT_EQ(loss_all->get_axes(), (AxisSet{0, 1, 2}));
+}
+
+TEST(type_prop, softmax_cross_entropy_deduce_outer_axis)
+{
+    auto logits = make_shared<op::Parameter>(element::f32, Shape{4, 6});
+    auto labels = make_shared<op::Parameter>(element::f32, Shape{4, 6});
+    try
+    {
+        auto loss = make_shared<op::SoftmaxCrossEntropy>(logits, labels, AxisSet{0});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Outer softmax cross entropy axis not detected.";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(),
+                  std::string("Softmax cross entropy axes must be the innermost axes"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, softmax_cross_entropy_deduce_labels_shape_incompatible)
+{
+    auto logits = make_shared<op::Parameter>(element::f32, Shape{4, 6});
+    auto labels = make_shared<op::Parameter>(element::f32, Shape{4, 5});
+    try
+    {
+        auto loss = make_shared<op::SoftmaxCrossEntropy>(logits, labels, AxisSet{1});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Incompatible softmax cross entropy labels not detected.";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(), std::string("Softmax cross entropy labels must match the logits"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, conv_1d_deduce)
 {
     // Deduce type
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -296,6 +297,35 @@ TEST(graph_util, clone_multiple_results)
     auto copy = clone_function(*f);
 }
 
+TEST(graph_util, control_dependency)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto A_abs = make_shared<op::Abs>(A);
+    auto B_abs = make_shared<op::Abs>(B);
+    auto B_abs_neg = make_shared<op::Negative>(B_abs);
+    A_abs->add_control_dependency(B_abs_neg);
+    auto f = make_shared<Function>(NodeVector{A_abs, B_abs_neg}, op::ParameterVector{A, B});
+
+    auto ops = f->get_ordered_ops();
+    auto position = [&ops](const shared_ptr<Node>& node) {
+        return distance(ops.begin(), find(ops.begin(), ops.end(), node));
+    };
+    EXPECT_LT(position(B_abs_neg), position(A_abs));
+
+    NodeMap node_map;
+    auto copy = clone_function(*f, node_map);
+    auto dependencies = node_map.get(A_abs)->get_control_dependencies();
+    ASSERT_EQ(dependencies.size(), 1);
+    EXPECT_EQ(*dependencies.begin(), node_map.get(B_abs_neg));
+
+    auto A_neg = make_shared<op::Negative>(A);
+    replace_node(A_abs, A_neg);
+    EXPECT_EQ(A_neg->get_control_dependencies().count(B_abs_neg), 1);
+    EXPECT_EQ(B_abs_neg->get_control_dependents().count(A_neg.get()), 1);
+}
+
 TEST(util, round_up)
 {
     EXPECT_EQ(0, round_up(0, 4));
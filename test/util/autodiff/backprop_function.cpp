@@ -33,11 +33,17 @@
 using namespace ngraph;
 
 std::shared_ptr<Function> autodiff::backprop_function(const std::shared_ptr<Function>& f)
+{
+    return backprop_function(f, CheckpointPolicy());
+}
+
+std::shared_ptr<Function> autodiff::backprop_function(const std::shared_ptr<Function>& f,
+                                                      const CheckpointPolicy& policy)
 {
     auto Y_out = f->get_output_op(0);
     auto Xs = f->get_parameters();
     auto C = std::make_shared<op::Parameter>(Y_out->get_element_type(), Y_out->get_shape());
-    Adjoints adjoints(NodeVector{Y_out}, NodeVector{C});
+    Adjoints adjoints(NodeVector{Y_out}, NodeVector{C}, policy);
     std::vector<std::shared_ptr<Node>> dYdXs(Xs.size());
     transform(Xs.begin(), Xs.end(), dYdXs.begin(), [C, &adjoints](const std::shared_ptr<Node>& X) {
         return adjoints.backprop_node(X);
@@ -19,6 +19,8 @@
 #include <memory>
 #include <unordered_map>
 
+#include "ngraph/autodiff/adjoints.hpp"
+
 namespace ngraph
 {
     class Function;
@@ -29,5 +31,10 @@ namespace ngraph
         /// @param f is f(X_i...)
         /// @returns f'(X_i..., c) where f'(x_i, ..., c)_j is backprop for X_j
         std::shared_ptr<Function> backprop_function(const std::shared_ptr<Function>& f);
+
+        /// @brief Same as backprop_function(f), recomputing activations that are not
+        /// checkpoints under policy.
+        std::shared_ptr<Function> backprop_function(const std::shared_ptr<Function>& f,
+                                                    const CheckpointPolicy& policy);
     }
 }
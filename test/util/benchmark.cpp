@@ -14,13 +14,23 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
 #include <iomanip>
+#include <thread>
+
+#include <sys/resource.h>
 
 #include "benchmark.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 #include "random.hpp"
 
@@ -125,10 +135,10 @@ void init_int_tv(shared_ptr<runtime::TensorView> tv, T min, T max)
     write_vector(tv, vec);
 }
 
-template <typename T>
+template <typename T, typename DIST_T = T>
 void init_real_tv(shared_ptr<runtime::TensorView> tv, T min, T max)
 {
-    uniform_real_distribution<T> dist(min, max);
+    uniform_real_distribution<DIST_T> dist(min, max);
     std::vector<T> vec = read_vector<T>(tv);
     for (T& element : vec)
     {
@@ -144,6 +154,14 @@ static void random_init(shared_ptr<runtime::TensorView> tv)
     {
         init_int_tv<char>(tv, 0, 1);
     }
+    else if (et == element::bf16)
+    {
+        init_real_tv<bfloat16, float>(tv, -1, 1);
+    }
+    else if (et == element::f16)
+    {
+        init_real_tv<float16, float>(tv, -1, 1);
+    }
     else if (et == element::f32)
     {
         init_real_tv<float>(tv, -1, 1);
@@ -190,15 +208,50 @@ static void random_init(shared_ptr<runtime::TensorView> tv)
     }
 }
 
+// Per-op roofline data: achieved rate, arithmetic intensity and, with hardware counters, IPC
+// and an estimate of the bytes fetched from memory
+static void print_op_efficiency(const vector<runtime::PerformanceCounter>& perf_data)
+{
+    size_t name_width = 4;
+    for (const runtime::PerformanceCounter& p : perf_data)
+    {
+        name_width = max(name_width, p.name().size());
+    }
+    cout << setw(name_width + 2) << left << "op" << right << setw(10) << "us/call" << setw(10)
+         << "GFLOP/s" << setw(10) << "FLOP/B" << setw(8) << "IPC" << setw(14) << "LLC miss/call"
+         << setw(14) << "mem MB/call" << endl;
+    auto flags = cout.flags();
+    cout << fixed << setprecision(2);
+    for (const runtime::PerformanceCounter& p : perf_data)
+    {
+        double calls = max(p.call_count(), size_t(1));
+        cout << setw(name_width + 2) << left << p.name() << right << setw(10)
+             << p.total_microseconds() / calls << setw(10) << p.gflops() << setw(10)
+             << p.arithmetic_intensity() << setw(8) << p.ipc() << setw(14)
+             << p.hardware_counters().llc_misses / calls << setw(14)
+             << p.memory_bytes() / 1048576 << endl;
+    }
+    cout.flags(flags);
+}
+
 void run_benchmark(shared_ptr<Function> f,
                    const string& backend_name,
                    size_t iterations,
-                   bool timing_detail)
+                   bool timing_detail,
+                   bool hardware_counters)
 {
     stopwatch timer;
     timer.start();
     auto backend = runtime::Backend::create(backend_name);
     backend->enable_performance_data(f, timing_detail);
+    if (hardware_counters)
+    {
+        if (!runtime::HardwareCounters::is_available())
+        {
+            cout << "hardware counters are not available on this machine" << endl;
+        }
+        backend->enable_hardware_counters(f, true);
+    }
     backend->compile(f);
     timer.stop();
     cout.imbue(locale(""));
@@ -251,4 +304,181 @@ void run_benchmark(shared_ptr<Function> f,
 
     cout << "\n---- Aggregate times per op type/shape ----\n";
     print_times(timing_details);
+
+    if (hardware_counters)
+    {
+        cout << "\n---- Efficiency per op ----\n";
+        print_op_efficiency(perf_data);
+    }
+}
+
+size_t get_peak_rss()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+static double percentile(const vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    // nearest-rank
+    size_t rank = static_cast<size_t>(ceil(p / 100 * sorted.size()));
+    return sorted[max(rank, size_t(1)) - 1];
+}
+
+BenchmarkStatistics measure_benchmark(shared_ptr<Function> f,
+                                      const string& backend_name,
+                                      const BenchmarkConfig& config)
+{
+    BenchmarkStatistics stats;
+    stats.concurrency = max(config.concurrency, size_t(1));
+    auto backend = runtime::Backend::create(backend_name);
+
+    // A compiled function owns its temporaries, so concurrent callers each need their own.
+    struct Caller
+    {
+        shared_ptr<Function> function;
+        vector<shared_ptr<runtime::TensorView>> args;
+        vector<shared_ptr<runtime::TensorView>> results;
+        vector<double> latencies;
+    };
+    vector<Caller> callers(stats.concurrency);
+    for (size_t i = 0; i < callers.size(); i++)
+    {
+        Caller& caller = callers[i];
+        caller.function = (i == 0 ? f : clone_function(*f));
+
+        stopwatch timer;
+        timer.start();
+        backend->compile(caller.function);
+        timer.stop();
+        if (i == 0)
+        {
+            stats.compile_ms = timer.get_microseconds() / 1000.0;
+        }
+
+        for (shared_ptr<op::Parameter> param : caller.function->get_parameters())
+        {
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            random_init(tensor);
+            if (param->get_cacheable())
+            {
+                tensor->set_stale(false);
+            }
+            caller.args.push_back(tensor);
+        }
+        for (shared_ptr<Node> out : caller.function->get_results())
+        {
+            caller.results.push_back(
+                backend->create_tensor(out->get_element_type(), out->get_shape()));
+        }
+        caller.latencies.reserve(config.iterations);
+    }
+    stats.temporary_pool_size = f->get_temporary_pool_size();
+
+    auto in_parallel = [&](function<void(Caller&)> body) {
+        if (callers.size() == 1)
+        {
+            body(callers[0]);
+            return;
+        }
+        vector<thread> threads;
+        for (Caller& caller : callers)
+        {
+            threads.emplace_back(body, ref(caller));
+        }
+        for (thread& t : threads)
+        {
+            t.join();
+        }
+    };
+
+    // All callers finish warming up before the timed window opens.
+    in_parallel([&](Caller& caller) {
+        for (size_t i = 0; i < config.warmup_iterations; i++)
+        {
+            backend->call(caller.function, caller.results, caller.args);
+        }
+    });
+
+    auto start = chrono::steady_clock::now();
+    in_parallel([&](Caller& caller) {
+        for (size_t i = 0; i < config.iterations; i++)
+        {
+            auto call_start = chrono::steady_clock::now();
+            backend->call(caller.function, caller.results, caller.args);
+            auto call_end = chrono::steady_clock::now();
+            caller.latencies.push_back(
+                chrono::duration<double, milli>(call_end - call_start).count());
+        }
+    });
+    auto end = chrono::steady_clock::now();
+    stats.wall_ms = chrono::duration<double, milli>(end - start).count();
+
+    vector<double> latencies;
+    for (const Caller& caller : callers)
+    {
+        latencies.insert(latencies.end(), caller.latencies.begin(), caller.latencies.end());
+    }
+    sort(latencies.begin(), latencies.end());
+    stats.calls = latencies.size();
+    if (stats.calls > 0)
+    {
+        double total = 0;
+        for (double latency : latencies)
+        {
+            total += latency;
+        }
+        stats.mean_ms = total / stats.calls;
+        stats.p50_ms = percentile(latencies, 50);
+        stats.p95_ms = percentile(latencies, 95);
+        stats.p99_ms = percentile(latencies, 99);
+        stats.max_ms = latencies.back();
+    }
+    if (stats.wall_ms > 0)
+    {
+        stats.calls_per_second = stats.calls * 1000.0 / stats.wall_ms;
+    }
+    stats.peak_rss = get_peak_rss();
+
+    for (size_t i = 1; i < callers.size(); i++)
+    {
+        backend->remove_compiled_function(callers[i].function);
+    }
+    return stats;
+}
+
+shared_ptr<Function> set_batch_size(shared_ptr<Function> f, size_t batch_size)
+{
+    const op::ParameterVector& params = f->get_parameters();
+    if (params.empty() || params[0]->get_shape().empty())
+    {
+        throw ngraph_error("The first parameter has no batch dimension");
+    }
+    size_t old_batch_size = params[0]->get_shape()[0];
+
+    NodeMap node_map;
+    for (shared_ptr<op::Parameter> param : params)
+    {
+        Shape shape = param->get_shape();
+        if (!shape.empty() && shape[0] == old_batch_size)
+        {
+            shape[0] = batch_size;
+        }
+        node_map.add(param,
+                     make_shared<op::Parameter>(
+                         param->get_element_type(), shape, param->get_cacheable()));
+    }
+    return clone_function(*f, node_map);
 }
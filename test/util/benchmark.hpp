@@ -17,6 +17,9 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <ngraph/function.hpp>
 
@@ -30,9 +33,50 @@ std::multimap<size_t, std::string>
 void run_benchmark(std::shared_ptr<ngraph::Function> f,
                    const std::string& backend_name,
                    size_t iterations,
-                   bool timing_detail);
+                   bool timing_detail,
+                   bool hardware_counters = false);
 
 void run_benchmark(const std::string& json_path,
                    const std::string& backend_name,
                    size_t iterations,
                    bool timing_detail = false);
+
+/// Settings for measure_benchmark
+struct BenchmarkConfig
+{
+    size_t warmup_iterations = 0; // untimed calls made by each caller before measuring
+    size_t iterations = 10;       // timed calls made by each caller
+    size_t concurrency = 1;       // callers running the function at the same time
+};
+
+/// Latency distribution and resource usage of one measure_benchmark run
+struct BenchmarkStatistics
+{
+    size_t calls = 0; // timed calls over all callers
+    size_t concurrency = 1;
+    double compile_ms = 0;
+    double wall_ms = 0;
+    double mean_ms = 0;
+    double p50_ms = 0;
+    double p95_ms = 0;
+    double p99_ms = 0;
+    double max_ms = 0;
+    double calls_per_second = 0;
+    size_t temporary_pool_size = 0; // bytes, 0 if the backend does not plan a pool
+    size_t peak_rss = 0;            // bytes, for the whole process
+};
+
+/// Runs f on the backend from config.concurrency threads, each with its own compiled copy of
+/// f and its own tensors, and records the latency of every call.
+BenchmarkStatistics measure_benchmark(std::shared_ptr<ngraph::Function> f,
+                                      const std::string& backend_name,
+                                      const BenchmarkConfig& config);
+
+/// Returns a copy of f in which every parameter whose leading dimension matches that of the
+/// first parameter has it replaced by batch_size. Throws if an op cannot be rebuilt for the
+/// new shapes, e.g. a Reshape with a hard-coded output shape.
+std::shared_ptr<ngraph::Function> set_batch_size(std::shared_ptr<ngraph::Function> f,
+                                                 size_t batch_size);
+
+/// Peak resident set size of the process in bytes
+size_t get_peak_rss();